@@ -118,8 +118,8 @@ AnalogIQEditor::AnalogIQEditor(AnalogIQProcessor &processor,
     // This is critical - make sure this component is configured as the DragAndDropContainer
     setInterceptsMouseClicks(false, true);
 
-    // Load the gear library data now that the plugin is ready
-    gearLibrary.loadLibrary();
+    // Load the gear library data now that the plugin is ready, without blocking the UI
+    gearLibrary.loadLibraryAsync();
 }
 
 /**
@@ -11,6 +11,9 @@
 #include "AnalogIQProcessor.h"
 #include "AnalogIQEditor.h"
 #include "CacheManager.h"
+#include "BundledNetworkFetcher.h"
+
+#include "StarterPackData.h"
 
 /**
  * @brief Constructs a new AnalogIQProcessor.
@@ -27,11 +30,16 @@ AnalogIQProcessor::AnalogIQProcessor(INetworkFetcher &networkFetcher, IFileSyste
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       state(*this, &undoManager, "Parameters", {}),
       networkFetcher(networkFetcher),
-      fileSystem(std::make_unique<FileSystem>()),
+      fileSystem(std::make_unique<FileSystem>(FileSystem::DEFAULT_METADATA_CACHE_TTL_MS)),
+      directoryWatcher(std::make_unique<DirectoryWatcher>(*this->fileSystem)),
       cacheManager(std::make_unique<CacheManager>(*this->fileSystem)),
       presetManager(std::make_unique<PresetManager>(*this->fileSystem, *cacheManager)),
       gearLibrary(std::make_unique<GearLibrary>(networkFetcher, *this->fileSystem, *cacheManager, *presetManager))
 {
+    // Pick up presets and favorites written by other instances without rescanning
+    cacheManager->attachWatcher(*directoryWatcher);
+    presetManager->attachWatcher(*directoryWatcher);
+
     initializeLogging();
     logToFile("=== AnalogIQProcessor Constructor ===");
 }
@@ -364,16 +372,19 @@ juce::AudioProcessorEditor *AnalogIQProcessor::createEditor()
 
         // Load instance state after the editor is created and gear library is loaded
         // We'll defer this to after the gear library is ready
-        juce::MessageManager::callAsync([this, rackEditor]()
-                                        {
-            // Wait a bit more to ensure gear library is fully loaded
-            juce::Timer::callAfterDelay(100, [this, rackEditor]()
+        juce::Component::SafePointer<AnalogIQEditor> safeEditor(rackEditor);
+        auto restoreState = [this, safeEditor]()
+        {
+            if (safeEditor != nullptr)
             {
-                if (auto *rack = rackEditor->getRack())
+                if (auto *rack = safeEditor->getRack())
                 {
                     loadInstanceState(rack);
                 }
-            }); });
+            }
+        };
+        juce::MessageManager::callAsync([this, restoreState]()
+                                        { gearLibrary->callWhenLoaded(restoreState); });
     }
     return editor;
 }
@@ -583,17 +594,17 @@ void AnalogIQProcessor::saveInstanceStateFromRack(Rack *rack, juce::ValueTree &i
                         logToFile("Processing control " + juce::String(j) + " in slot " + juce::String(i));
                         logToFile("  Control name: " + control.name);
                         logToFile("  Control type: " + juce::String(static_cast<int>(control.type)));
-                        logToFile("  Control value: " + juce::String(control.value));
+                        logToFile("  Control value: " + juce::String(item->getControlValue(j)));
                         logToFile("  Control initial value: " + juce::String(control.initialValue));
 
                         auto controlTree = controlsTree.getOrCreateChildWithName("control_" + juce::String(j), &undoManager);
-                        controlTree.setProperty("value", control.value, &undoManager);
+                        controlTree.setProperty("value", item->getControlValue(j), &undoManager);
                         controlTree.setProperty("initialValue", control.initialValue, &undoManager);
 
                         if (control.type == GearControl::Type::Switch || control.type == GearControl::Type::Button)
                         {
-                            controlTree.setProperty("currentIndex", control.currentIndex, &undoManager);
-                            logToFile("  Control current index: " + juce::String(control.currentIndex));
+                            controlTree.setProperty("currentIndex", item->getControlCurrentIndex(j), &undoManager);
+                            logToFile("  Control current index: " + juce::String(item->getControlCurrentIndex(j)));
                         }
 
                         logToFile("Control " + juce::String(j) + " saved successfully");
@@ -672,13 +683,10 @@ void AnalogIQProcessor::loadInstanceState(Rack *rack)
                 auto sourceUnitId = slotTree.getProperty("sourceUnitId").toString();
                 if (!sourceUnitId.isEmpty())
                 {
-                    // Load the gear item from the gear library using the source unit ID
-                    auto gearItem = gearLibrary->getGearItemByUnitId(sourceUnitId);
-                    if (gearItem != nullptr)
+                    // Create a new instance of the source gear from the gear library
+                    auto *item = rack->adoptGearItem(gearLibrary->createGearItemByUnitId(sourceUnitId, networkFetcher, *fileSystem, *cacheManager));
+                    if (item != nullptr)
                     {
-                        // Create a new instance from the source gear using proper copy constructor
-                        auto *item = new GearItem(*gearItem, networkFetcher, *fileSystem, *cacheManager);
-
                         // Set the gear item in the slot (this automatically creates an instance)
                         if (auto *slot = rack->getSlot(i))
                         {
@@ -721,7 +729,7 @@ void AnalogIQProcessor::loadInstanceState(Rack *rack)
 
                                     // Trigger faceplate and control image loading
                                     // We'll load the schema and then restore control values after
-                                    rack->fetchSchemaForGearItem(loadedItem, [savedControls, loadedItem]()
+                                    rack->fetchSchemaForGearItem(loadedItem, [savedControls = std::move(savedControls), loadedItem]()
                                                                  {
                                 // Apply saved control values after schema parsing (following PresetManager pattern)
                                 // Note: initialValue is preserved from schema, not restored from saved state
@@ -732,13 +740,13 @@ void AnalogIQProcessor::loadInstanceState(Rack *rack)
                                     {
                                         if (saved.index >= 0 && saved.index < loadedItem->controls.size())
                                         {
-                                            auto &control = loadedItem->controls.getReference(saved.index);
-                                            control.value = saved.value;
+                                            const auto &control = loadedItem->controls.getReference(saved.index);
+                                            loadedItem->setControlValue(saved.index, saved.value);
                                             // Don't restore initialValue - keep the schema default
 
                                             if (control.type == GearControl::Type::Switch || control.type == GearControl::Type::Button)
                                             {
-                                                control.currentIndex = saved.currentIndex;
+                                                loadedItem->setControlCurrentIndex(saved.index, saved.currentIndex);
                                             }
                                         }
                                     }
@@ -813,6 +821,58 @@ void AnalogIQProcessor::resetAllInstances()
     }
 }
 
+/**
+ * @brief Gets the memory the plugin holds, counting shared images once.
+ *
+ * The rack is counted before the cache manager, so control assets that unit
+ * definitions share with the cache are reported as the rack's.
+ *
+ * @return The memory in use
+ */
+MemoryUsage AnalogIQProcessor::getMemoryUsage() const
+{
+    MemoryUsage::ImageCounter images;
+    MemoryUsage usage;
+
+    if (auto *currentRack = getCurrentRack())
+        usage += currentRack->getMemoryUsage(images);
+
+    usage += cacheManager->getMemoryUsage(images);
+    usage += gearLibrary->getMemoryUsage(images);
+    usage += presetManager->getMemoryUsage();
+    return usage;
+}
+
+/**
+ * @brief Gets the memory the instance in a rack slot refers to.
+ *
+ * @param slotIndex The index of the slot
+ * @return The slot's usage, or nothing if there is no rack or the slot is empty
+ */
+MemoryUsage AnalogIQProcessor::getSlotMemoryUsage(int slotIndex) const
+{
+    if (auto *currentRack = getCurrentRack())
+        return currentRack->getSlotMemoryUsage(slotIndex);
+
+    return {};
+}
+
+/**
+ * @brief Gets the rack of the active editor, or the stored rack if there is none.
+ *
+ * @return The rack, or nullptr if no editor has created one
+ */
+Rack *AnalogIQProcessor::getCurrentRack() const
+{
+    if (auto *editor = dynamic_cast<AnalogIQEditor *>(getActiveEditor()))
+    {
+        if (auto *editorRack = editor->getRack())
+            return editorRack;
+    }
+
+    return rack;
+}
+
 void AnalogIQProcessor::clearRackReference()
 {
     logToFile("Clearing stored rack reference to prevent dangling pointer usage");
@@ -828,5 +888,12 @@ juce::AudioProcessor *JUCE_CALLTYPE createPluginFilter()
 {
     static NetworkFetcher networkFetcher;
     static FileSystem fileSystem;
-    return new AnalogIQProcessor(networkFetcher, fileSystem);
+
+    // Serve the embedded starter catalogue first; the index is refreshed from the network in the background
+    static BundledNetworkFetcher bundledFetcher(networkFetcher,
+                                                StarterPackData::starter_pack_zip,
+                                                (size_t)StarterPackData::starter_pack_zipSize,
+                                                RemoteResources::BASE_URL,
+                                                {RemoteResources::LIBRARY_PATH});
+    return new AnalogIQProcessor(bundledFetcher, fileSystem);
 }
\ No newline at end of file
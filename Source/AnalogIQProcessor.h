@@ -16,6 +16,7 @@
 #include "CacheManager.h"
 #include "PresetManager.h"
 #include "FileSystem.h"
+#include "DirectoryWatcher.h"
 
 // Forward declare the test class
 class AnalogIQProcessorTests;
@@ -227,6 +228,25 @@ public:
      */
     GearLibrary &getGearLibrary() { return *gearLibrary; }
 
+    /**
+     * @brief Gets the memory the plugin holds, counting shared images once.
+     *
+     * Covers the rack of the open editor, if any, the library's thumbnails
+     * and catalogue, the decoded control assets and the preset listings.
+     * Must be called on the message thread.
+     *
+     * @return The memory in use
+     */
+    MemoryUsage getMemoryUsage() const;
+
+    /**
+     * @brief Gets the memory the instance in a rack slot refers to.
+     *
+     * @param slotIndex The index of the slot
+     * @return The slot's usage, or nothing if there is no rack or the slot is empty
+     */
+    MemoryUsage getSlotMemoryUsage(int slotIndex) const;
+
     /**
      * @brief Saves the current state of all gear instances.
      */
@@ -268,8 +288,17 @@ private:
     juce::UndoManager undoManager;                           ///< Undo manager for state changes
     juce::AudioProcessorEditor *lastCreatedEditor = nullptr; ///< Pointer to the last created editor (for testing)
     Rack *rack = nullptr;                                    ///< Pointer to the rack (for testing)
+
+    /**
+     * @brief Gets the rack of the active editor, or the stored rack if there is none.
+     *
+     * @return The rack, or nullptr if no editor has created one
+     */
+    Rack *getCurrentRack() const;
+
     INetworkFetcher &networkFetcher;                         ///< Reference to the network fetcher for making HTTP requests
     std::unique_ptr<IFileSystem> fileSystem;
+    std::unique_ptr<DirectoryWatcher> directoryWatcher;      ///< Watches presets and cache metadata; outlives its listeners
     std::unique_ptr<CacheManager> cacheManager;
     std::unique_ptr<PresetManager> presetManager;
     std::unique_ptr<GearLibrary> gearLibrary;
@@ -0,0 +1,256 @@
+/**
+ * @file BundledNetworkFetcher.cpp
+ * @brief Implementation of the BundledNetworkFetcher class.
+ *
+ * This file provides an INetworkFetcher that answers requests from a zip
+ * archive embedded with JUCE BinaryData before going to the network, so the
+ * starter catalogue loads instantly and works without a connection, and
+ * refreshes changeable resources such as the library index in the background.
+ */
+
+#include "BundledNetworkFetcher.h"
+#include <JuceHeader.h>
+
+BundledNetworkFetcher::BundledNetworkFetcher(INetworkFetcher &fallback,
+                                             const void *packData,
+                                             size_t packSize,
+                                             const juce::String &baseUrl,
+                                             const juce::StringArray &refreshedPaths)
+    : juce::Thread("AnalogIQ Bundle Refresh"),
+      fallback(fallback),
+      baseUrl(baseUrl),
+      refreshedPaths(refreshedPaths)
+{
+    if (packData != nullptr && packSize > 0)
+    {
+        pack = std::make_unique<juce::ZipFile>(new juce::MemoryInputStream(packData, packSize, false), true);
+    }
+}
+
+BundledNetworkFetcher::~BundledNetworkFetcher()
+{
+    cancelPendingUpdate();
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+}
+
+juce::String BundledNetworkFetcher::fetchJsonBlocking(const juce::URL &url, bool &success)
+{
+    juce::MemoryBlock data;
+    if (fetchWithoutNetwork(url, true, data))
+    {
+        success = true;
+        return data.toString();
+    }
+
+    return fallback.fetchJsonBlocking(url, success);
+}
+
+juce::MemoryBlock BundledNetworkFetcher::fetchBinaryBlocking(const juce::URL &url, bool &success)
+{
+    juce::MemoryBlock data;
+    if (fetchWithoutNetwork(url, false, data))
+    {
+        success = true;
+        return data;
+    }
+
+    return fallback.fetchBinaryBlocking(url, success);
+}
+
+juce::String BundledNetworkFetcher::fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort)
+{
+    juce::MemoryBlock data;
+    if (fetchWithoutNetwork(url, true, data))
+    {
+        success = true;
+        return data.toString();
+    }
+
+    return fallback.fetchJsonAbortable(url, success, shouldAbort);
+}
+
+void BundledNetworkFetcher::addListener(INetworkFetcher::Listener *listener)
+{
+    listeners.add(listener);
+}
+
+void BundledNetworkFetcher::removeListener(INetworkFetcher::Listener *listener)
+{
+    listeners.remove(listener);
+}
+
+bool BundledNetworkFetcher::fetchWithoutNetwork(const juce::URL &url, bool isJson, juce::MemoryBlock &data)
+{
+    juce::String relativePath = getRelativePath(url);
+    if (!refreshedPaths.contains(relativePath))
+        return readBundledEntry(relativePath, data);
+
+    {
+        const juce::ScopedLock sl(refreshLock);
+
+        // Once the network has answered, its copy supersedes the bundle
+        auto it = refreshedData.find(relativePath);
+        if (it != refreshedData.end())
+        {
+            data = it->second;
+            return true;
+        }
+    }
+
+    // With nothing bundled there is nothing to serve meanwhile, so the caller waits for the network
+    if (!readBundledEntry(relativePath, data))
+        return false;
+
+    {
+        const juce::ScopedLock sl(refreshLock);
+        if (startedRefreshes.contains(relativePath))
+            return true;
+
+        startedRefreshes.add(relativePath);
+        queuedRefreshes.push_back({url, relativePath, isJson});
+        ++numRefreshesRunning;
+    }
+
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+
+    notify();
+    return true;
+}
+
+bool BundledNetworkFetcher::waitForRefreshes(int timeoutMs)
+{
+    const auto startTime = juce::Time::getMillisecondCounter();
+
+    for (;;)
+    {
+        {
+            const juce::ScopedLock sl(refreshLock);
+            if (numRefreshesRunning == 0)
+                return true;
+        }
+
+        if (timeoutMs >= 0 && (int)(juce::Time::getMillisecondCounter() - startTime) >= timeoutMs)
+            return false;
+
+        juce::Thread::sleep(1);
+    }
+}
+
+void BundledNetworkFetcher::deliverPendingNotifications()
+{
+    handleUpdateNowIfNeeded();
+}
+
+void BundledNetworkFetcher::run()
+{
+    while (!threadShouldExit())
+    {
+        Refresh refresh;
+        {
+            const juce::ScopedLock sl(refreshLock);
+            if (!queuedRefreshes.empty())
+            {
+                refresh = queuedRefreshes.front();
+                queuedRefreshes.pop_front();
+            }
+        }
+
+        if (refresh.relativePath.isEmpty())
+        {
+            wait(-1);
+            continue;
+        }
+
+        bool success = false;
+        juce::MemoryBlock fresh;
+        if (refresh.isJson)
+        {
+            juce::String text = fallback.fetchJsonBlocking(refresh.url, success);
+            fresh.append(text.toRawUTF8(), text.getNumBytesAsUTF8());
+        }
+        else
+        {
+            fresh = fallback.fetchBinaryBlocking(refresh.url, success);
+        }
+
+        juce::MemoryBlock bundled;
+        const bool changed = success && fresh.getSize() > 0
+                             && !(readBundledEntry(refresh.relativePath, bundled) && bundled == fresh);
+
+        const juce::ScopedLock sl(refreshLock);
+        --numRefreshesRunning;
+
+        if (!success || fresh.getSize() == 0)
+        {
+            // Offline: keep serving the bundle and try again on the next fetch
+            startedRefreshes.removeString(refresh.relativePath);
+            continue;
+        }
+
+        refreshedData[refresh.relativePath] = std::move(fresh);
+        if (changed)
+        {
+            updatedPaths.addIfNotAlreadyThere(refresh.relativePath);
+            triggerAsyncUpdate();
+        }
+    }
+}
+
+void BundledNetworkFetcher::handleAsyncUpdate()
+{
+    juce::StringArray paths;
+    {
+        const juce::ScopedLock sl(refreshLock);
+        paths.swapWith(updatedPaths);
+    }
+
+    for (const auto &path : paths)
+    {
+        juce::URL url(baseUrl + path);
+        listeners.call([&url](INetworkFetcher::Listener &listener)
+                       { listener.resourceUpdated(url); });
+    }
+}
+
+bool BundledNetworkFetcher::hasBundledEntry(const juce::String &relativePath) const
+{
+    return pack != nullptr && relativePath.isNotEmpty() && pack->getIndexOfFileName(relativePath) >= 0;
+}
+
+int BundledNetworkFetcher::getNumBundledEntries() const
+{
+    return pack != nullptr ? pack->getNumEntries() : 0;
+}
+
+juce::String BundledNetworkFetcher::getRelativePath(const juce::URL &url) const
+{
+    juce::String urlString = url.toString(false);
+    if (baseUrl.isEmpty() || !urlString.startsWith(baseUrl))
+        return {};
+
+    return urlString.substring(baseUrl.length()).trimCharactersAtStart("/");
+}
+
+bool BundledNetworkFetcher::readBundledEntry(const juce::String &relativePath, juce::MemoryBlock &data) const
+{
+    if (!hasBundledEntry(relativePath))
+        return false;
+
+    try
+    {
+        std::unique_ptr<juce::InputStream> stream(pack->createStreamForEntry(pack->getIndexOfFileName(relativePath)));
+        if (stream == nullptr)
+            return false;
+
+        data.reset();
+        stream->readIntoMemoryBlock(data);
+        return data.getSize() > 0;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file BundledNetworkFetcher.h
+ * @brief Header file for the BundledNetworkFetcher class.
+ *
+ * This file defines the BundledNetworkFetcher class, an INetworkFetcher that
+ * serves a read-only starter catalogue embedded in the plugin binary and only
+ * falls back to the network for resources the bundle does not contain.
+ */
+
+#pragma once
+
+#include "INetworkFetcher.h"
+#include <deque>
+#include <map>
+
+/**
+ * @brief Serves remote resources from a zip archive compiled into the binary.
+ *
+ * The archive mirrors the remote layout relative to the base URL (for example
+ * "units/index.json" or "assets/faceplates/la2a-compressor-1.0.0.jpg").
+ * Versioned resources such as schemas and images never change, so the bundle
+ * is consulted before the network for them.
+ *
+ * Paths registered as refreshed (such as the library index) can change
+ * remotely. The bundled copy is served at once and the network copy is
+ * fetched on a background thread; once it arrives it is served instead, and
+ * listeners are told on the message thread if it differs from the bundle.
+ */
+class BundledNetworkFetcher : public INetworkFetcher,
+                              private juce::Thread,
+                              private juce::AsyncUpdater
+{
+public:
+    /**
+     * @brief Constructs a bundled fetcher over an in-memory zip archive.
+     *
+     * @param fallback The fetcher used for resources missing from the bundle and for refreshes
+     * @param packData Pointer to the zip archive data, which must outlive this object
+     * @param packSize Size of the zip archive in bytes
+     * @param baseUrl The remote base URL that bundled paths are relative to
+     * @param refreshedPaths Relative paths served from the bundle and refreshed from the network in the background
+     */
+    BundledNetworkFetcher(INetworkFetcher &fallback,
+                          const void *packData,
+                          size_t packSize,
+                          const juce::String &baseUrl,
+                          const juce::StringArray &refreshedPaths = {});
+
+    /**
+     * @brief Destructor. Stops the refresh thread.
+     */
+    ~BundledNetworkFetcher() override;
+
+    juce::String fetchJsonBlocking(const juce::URL &url, bool &success) override;
+    juce::MemoryBlock fetchBinaryBlocking(const juce::URL &url, bool &success) override;
+    juce::String fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort) override;
+    void addListener(INetworkFetcher::Listener *listener) override;
+    void removeListener(INetworkFetcher::Listener *listener) override;
+
+    /**
+     * @brief Checks whether the bundle contains a resource.
+     *
+     * @param relativePath The path relative to the base URL
+     * @return true if the bundle has an entry for the path, false otherwise
+     */
+    bool hasBundledEntry(const juce::String &relativePath) const;
+
+    /**
+     * @brief Gets the number of entries in the bundle.
+     *
+     * @return The number of bundled resources, or 0 if the archive could not be opened
+     */
+    int getNumBundledEntries() const;
+
+    /**
+     * @brief Waits until every background refresh has finished.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if no refresh is left running
+     */
+    bool waitForRefreshes(int timeoutMs);
+
+    /**
+     * @brief Tells listeners about refreshed resources now instead of waiting for the message loop.
+     *
+     * Must be called on the message thread.
+     */
+    void deliverPendingNotifications();
+
+private:
+    /**
+     * @brief A refreshed path waiting for the background thread.
+     */
+    struct Refresh
+    {
+        juce::URL url;             ///< The URL to fetch from the network
+        juce::String relativePath; ///< The path relative to the base URL
+        bool isJson = false;       ///< Whether to fetch through the JSON overload
+    };
+
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    /**
+     * @brief Gets the copy of a resource to serve without the network, if there is one.
+     *
+     * Starts a background refresh the first time a refreshed path is served.
+     *
+     * @param url The URL being fetched
+     * @param isJson Whether the caller fetches through the JSON overload
+     * @param data Receives the content
+     * @return true if the content was found, false if only the network has it
+     */
+    bool fetchWithoutNetwork(const juce::URL &url, bool isJson, juce::MemoryBlock &data);
+
+    /**
+     * @brief Converts a URL into a path relative to the base URL.
+     *
+     * @param url The URL being fetched
+     * @return The relative path, or empty string if the URL is outside the base URL
+     */
+    juce::String getRelativePath(const juce::URL &url) const;
+
+    /**
+     * @brief Reads a bundled entry into memory.
+     *
+     * @param relativePath The path relative to the base URL
+     * @param data Receives the entry contents
+     * @return true if the entry was found and read, false otherwise
+     */
+    bool readBundledEntry(const juce::String &relativePath, juce::MemoryBlock &data) const;
+
+    INetworkFetcher &fallback;             ///< Fetcher used when the bundle has no copy
+    std::unique_ptr<juce::ZipFile> pack;   ///< The embedded starter catalogue
+    juce::String baseUrl;                  ///< Remote base URL the bundle mirrors
+    juce::StringArray refreshedPaths;      ///< Paths refreshed from the network after the bundle is served
+
+    juce::CriticalSection refreshLock;                       ///< Guards the refresh state below
+    std::deque<Refresh> queuedRefreshes;                     ///< Refreshes waiting for the background thread
+    juce::StringArray startedRefreshes;                      ///< Paths queued, running or refreshed this session
+    std::map<juce::String, juce::MemoryBlock> refreshedData; ///< Relative path -> content fetched from the network
+    juce::StringArray updatedPaths;                          ///< Refreshed paths listeners have not heard about
+    int numRefreshesRunning = 0;                             ///< Refreshes queued or being fetched
+
+    juce::ListenerList<INetworkFetcher::Listener> listeners; ///< Told about refreshed resources on the message thread
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BundledNetworkFetcher)
+};
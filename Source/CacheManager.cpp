@@ -16,6 +16,7 @@
 #include <juce_core/juce_core.h>
 #include <juce_graphics/juce_graphics.h>
 #include <juce_data_structures/juce_data_structures.h>
+#include <unordered_set>
 
 CacheManager::CacheManager(IFileSystem &fileSystem, const juce::String &cacheRootPath)
     : fileSystem(fileSystem)
@@ -33,6 +34,38 @@ CacheManager::CacheManager(IFileSystem &fileSystem, const juce::String &cacheRoo
     }
 }
 
+CacheManager::~CacheManager()
+{
+    cancelPendingUpdate();
+    flushControlAssetIndex();
+
+    if (directoryWatcher != nullptr)
+        directoryWatcher->removeListener(this);
+}
+
+void CacheManager::attachWatcher(DirectoryWatcher &watcher)
+{
+    if (directoryWatcher != nullptr)
+        directoryWatcher->removeListener(this);
+
+    directoryWatcher = &watcher;
+    favoritesCacheValid = false;
+    recentlyUsedCacheValid = false;
+    watcher.addWatch(cacheRoot, this);
+}
+
+void CacheManager::directoryChanged(const juce::String &directory, const juce::StringArray &changedNames)
+{
+    juce::ignoreUnused(directory);
+
+    // Called on the watcher thread, so only flip the flags
+    if (changedNames.isEmpty() || changedNames.contains("favorites.json"))
+        favoritesCacheValid = false;
+
+    if (changedNames.isEmpty() || changedNames.contains("recently_used.json"))
+        recentlyUsedCacheValid = false;
+}
+
 bool CacheManager::initializeCache()
 {
     try
@@ -69,6 +102,9 @@ bool CacheManager::initializeCache()
         if (!createDirectoryIfNeeded(fileSystem.joinPath(getControlsDirectory(), "switches")))
             return false;
 
+        if (!createDirectoryIfNeeded(getBlobsDirectory()))
+            return false;
+
         return true;
     }
     catch (...)
@@ -108,10 +144,55 @@ bool CacheManager::isThumbnailCached(const juce::String &unitId, const juce::Str
 
 bool CacheManager::isControlAssetCached(const juce::String &assetPath) const
 {
+    juce::String hash = getControlAssetHash(assetPath);
+    if (hash.isNotEmpty())
+    {
+        const juce::ScopedLock lock(controlAssetLock);
+        if (controlAssetImages.find(hash) != controlAssetImages.end())
+            return true;
+
+        if (fileSystem.fileExists(fileSystem.joinPath(getBlobsDirectory(), hash)))
+            return true;
+    }
+
+    // Fall back to assets cached per path before the blob store existed
     juce::String assetFilePath = getCachedControlAssetPath(assetPath);
     return fileSystem.fileExists(assetFilePath);
 }
 
+juce::String CacheManager::getControlAssetHash(const juce::String &assetPath) const
+{
+    try
+    {
+        const juce::ScopedLock lock(controlAssetLock);
+        ensureControlAssetIndexLoaded();
+
+        auto it = controlAssetHashes.find(getControlAssetKey(assetPath));
+        if (it != controlAssetHashes.end())
+            return it->second;
+
+        return juce::String();
+    }
+    catch (...)
+    {
+        return juce::String();
+    }
+}
+
+juce::String CacheManager::computeContentHash(const juce::MemoryBlock &data)
+{
+    // 64-bit FNV-1a; the size suffix makes accidental collisions even less likely
+    juce::uint64 hash = 14695981039346656037ULL;
+    auto *bytes = static_cast<const juce::uint8 *>(data.getData());
+    for (size_t i = 0; i < data.getSize(); ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return juce::String::toHexString((juce::int64)hash).paddedLeft('0', 16) + "-" + juce::String((juce::int64)data.getSize());
+}
+
 /**
  * @brief Gets the cached file path for a unit JSON.
  *
@@ -184,7 +265,7 @@ bool CacheManager::saveUnitToCache(const juce::String &unitId, const juce::Strin
             return false;
 
         // Write the JSON data to file
-        return fileSystem.writeFile(unitFilePath, jsonData);
+        return fileSystem.writeFileAsync(unitFilePath, jsonData);
     }
     catch (...)
     {
@@ -209,7 +290,7 @@ bool CacheManager::saveFaceplateToCache(const juce::String &unitId, const juce::
 
         if (jpegFormat.writeImageToStream(image, stream))
         {
-            return fileSystem.writeFile(faceplateFilePath, imageData);
+            return fileSystem.writeFileAsync(faceplateFilePath, imageData);
         }
 
         return false;
@@ -237,7 +318,7 @@ bool CacheManager::saveThumbnailToCache(const juce::String &unitId, const juce::
 
         if (jpegFormat.writeImageToStream(image, stream))
         {
-            return fileSystem.writeFile(thumbnailFilePath, imageData);
+            return fileSystem.writeFileAsync(thumbnailFilePath, imageData);
         }
 
         return false;
@@ -252,15 +333,39 @@ bool CacheManager::saveControlAssetToCache(const juce::String &assetPath, const
 {
     try
     {
-        juce::String assetFilePath = getCachedControlAssetPath(assetPath);
-
-        // Ensure the parent directory exists
-        juce::String parentDir = fileSystem.getParentDirectory(assetFilePath);
-        if (!createDirectoryIfNeeded(parentDir))
+        if (imageData.getSize() == 0)
             return false;
 
-        // Write the image data to file
-        return fileSystem.writeFile(assetFilePath, imageData);
+        juce::String hash = computeContentHash(imageData);
+        juce::String blobPath = fileSystem.joinPath(getBlobsDirectory(), hash);
+
+        const juce::ScopedLock lock(controlAssetLock);
+        ensureControlAssetIndexLoaded();
+
+        // Only write the blob the first time this content is seen
+        if (!fileSystem.fileExists(blobPath))
+        {
+            if (!createDirectoryIfNeeded(getBlobsDirectory()))
+                return false;
+
+            if (!fileSystem.writeFileAsync(blobPath, imageData))
+                return false;
+        }
+
+        juce::String key = getControlAssetKey(assetPath);
+        auto it = controlAssetHashes.find(key);
+        if (it != controlAssetHashes.end() && it->second == hash)
+            return true;
+
+        juce::String previousHash = it != controlAssetHashes.end() ? it->second : juce::String();
+        controlAssetHashes[key] = hash;
+        if (previousHash.isNotEmpty())
+            removeControlAssetIfUnused(previousHash);
+
+        // Aliases saved in a burst share a single index write
+        controlAssetIndexDirty = true;
+        triggerAsyncUpdate();
+        return true;
     }
     catch (...)
     {
@@ -274,9 +379,11 @@ juce::String CacheManager::loadUnitFromCache(const juce::String &unitId) const
     {
         juce::String unitFilePath = getCachedUnitPath(unitId);
 
-        if (fileSystem.fileExists(unitFilePath))
+        // Parse source for schemas comes straight from the mapped file
+        FileView jsonData = fileSystem.mapFile(unitFilePath);
+        if (jsonData.isValid())
         {
-            return fileSystem.readFile(unitFilePath);
+            return jsonData.toString();
         }
 
         return juce::String();
@@ -295,16 +402,12 @@ juce::Image CacheManager::loadFaceplateFromCache(const juce::String &unitId, con
 
         if (fileSystem.fileExists(faceplateFilePath))
         {
-            juce::MemoryBlock imageData = fileSystem.readBinaryFile(faceplateFilePath);
-            if (imageData.getSize() > 0)
+            FileView imageData = fileSystem.mapFile(faceplateFilePath);
+            if (imageData.isValid())
             {
-                juce::MemoryInputStream stream(imageData, false);
-                juce::Image result = juce::ImageFileFormat::loadFrom(stream);
-
-                // Clear the memory block to free resources
-                imageData = juce::MemoryBlock();
-
-                return result;
+                // Decode straight from the mapped bytes rather than copying them first
+                juce::MemoryInputStream stream(imageData.getData(), imageData.getSize(), false);
+                return juce::ImageFileFormat::loadFrom(stream);
             }
         }
 
@@ -323,16 +426,11 @@ juce::Image CacheManager::loadThumbnailFromCache(const juce::String &unitId, con
         juce::String thumbnailFilePath = getCachedThumbnailPath(unitId, filename);
 
         // No need to check fileExists again - if isThumbnailCached() returned true, we know it exists
-        juce::MemoryBlock imageData = fileSystem.readBinaryFile(thumbnailFilePath);
-        if (imageData.getSize() > 0)
+        FileView imageData = fileSystem.mapFile(thumbnailFilePath);
+        if (imageData.isValid())
         {
-            juce::MemoryInputStream stream(imageData, false);
-            juce::Image result = juce::ImageFileFormat::loadFrom(stream);
-
-            // Clear the memory block to free resources
-            imageData = juce::MemoryBlock();
-
-            return result;
+            juce::MemoryInputStream stream(imageData.getData(), imageData.getSize(), false);
+            return juce::ImageFileFormat::loadFrom(stream);
         }
 
         return juce::Image();
@@ -347,19 +445,36 @@ juce::Image CacheManager::loadControlAssetFromCache(const juce::String &assetPat
 {
     try
     {
+        juce::String hash = getControlAssetHash(assetPath);
+        if (hash.isNotEmpty())
+        {
+            const juce::ScopedLock lock(controlAssetLock);
+
+            // Every alias of the same content shares one decoded image
+            auto it = controlAssetImages.find(hash);
+            if (it != controlAssetImages.end())
+                return it->second;
+
+            FileView blobData = fileSystem.mapFile(fileSystem.joinPath(getBlobsDirectory(), hash));
+            if (blobData.isValid())
+            {
+                juce::MemoryInputStream stream(blobData.getData(), blobData.getSize(), false);
+                juce::Image result = juce::ImageFileFormat::loadFrom(stream);
+                if (result.isValid())
+                    controlAssetImages[hash] = result;
+
+                return result;
+            }
+        }
+
         juce::String assetFilePath = getCachedControlAssetPath(assetPath);
 
         // No need to check fileExists again - if isControlAssetCached() returned true, we know it exists
-        juce::MemoryBlock imageData = fileSystem.readBinaryFile(assetFilePath);
-        if (imageData.getSize() > 0)
+        FileView imageData = fileSystem.mapFile(assetFilePath);
+        if (imageData.isValid())
         {
-            juce::MemoryInputStream stream(imageData, false);
-            juce::Image result = juce::ImageFileFormat::loadFrom(stream);
-
-            // Clear the memory block to free resources
-            imageData = juce::MemoryBlock();
-
-            return result;
+            juce::MemoryInputStream stream(imageData.getData(), imageData.getSize(), false);
+            return juce::ImageFileFormat::loadFrom(stream);
         }
 
         return juce::Image();
@@ -370,10 +485,33 @@ juce::Image CacheManager::loadControlAssetFromCache(const juce::String &assetPat
     }
 }
 
+MemoryUsage CacheManager::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    const juce::ScopedLock lock(controlAssetLock);
+
+    MemoryUsage usage;
+    for (const auto &entry : controlAssetImages)
+        usage.controlImages += images.count(entry.second);
+
+    return usage;
+}
+
 bool CacheManager::clearCache()
 {
     try
     {
+        // Let queued saves land before the directory goes, so none resurrect it
+        fileSystem.flushPendingWrites();
+
+        {
+            const juce::ScopedLock lock(controlAssetLock);
+            controlAssetHashes.clear();
+            controlAssetImages.clear();
+            controlAssetIndexDirty = false;
+            controlAssetIndexLoaded = true;
+            fileSystem.deleteFile(getControlAssetIndexPath());
+        }
+
         if (fileSystem.directoryExists(cacheRoot))
         {
             return fileSystem.deleteDirectory(cacheRoot);
@@ -391,6 +529,10 @@ juce::int64 CacheManager::getCacheSize() const
 {
     try
     {
+        // Directory listings only see what has reached disk
+        flushControlAssetIndex();
+        fileSystem.flushPendingWrites();
+
         if (fileSystem.directoryExists(cacheRoot))
         {
             return calculateDirectorySize(cacheRoot);
@@ -408,23 +550,13 @@ juce::int64 CacheManager::calculateDirectorySize(const juce::String &directory)
 {
     juce::int64 totalSize = 0;
 
-    if (fileSystem.directoryExists(directory))
+    // One listing per directory supplies every file size; only subdirectories recurse
+    for (const auto &entry : fileSystem.listDirectory(directory))
     {
-        // Get all files in the directory
-        auto files = fileSystem.getFiles(directory);
-        for (const auto &filename : files)
-        {
-            juce::String fullPath = directory + "/" + filename;
-            totalSize += fileSystem.getFileSize(fullPath);
-        }
-
-        // Recursively calculate size of subdirectories
-        auto subdirs = fileSystem.getDirectories(directory);
-        for (const auto &dirname : subdirs)
-        {
-            juce::String fullPath = directory + "/" + dirname;
-            totalSize += calculateDirectorySize(fullPath);
-        }
+        if (entry.isDirectory)
+            totalSize += calculateDirectorySize(directory + "/" + entry.name);
+        else if (entry.size > 0)
+            totalSize += entry.size;
     }
 
     return totalSize;
@@ -480,6 +612,142 @@ juce::String CacheManager::getControlsDirectory() const
     return result;
 }
 
+juce::String CacheManager::getBlobsDirectory() const
+{
+    juce::String assetsDir = getAssetsDirectory();
+    juce::String result = fileSystem.joinPath(assetsDir, "blobs");
+    return result;
+}
+
+juce::String CacheManager::getControlAssetIndexPath() const
+{
+    return fileSystem.joinPath(getAssetsDirectory(), "control_index.json");
+}
+
+juce::String CacheManager::getControlAssetKey(const juce::String &assetPath) const
+{
+    // Key on the path relative to the controls directory so prefixed and bare paths alias
+    juce::String key = assetPath.replaceCharacter('\\', '/');
+    if (key.startsWith("assets/controls/"))
+        key = key.substring(16);
+    else if (key.startsWith("controls/"))
+        key = key.substring(9);
+
+    return key;
+}
+
+void CacheManager::ensureControlAssetIndexLoaded() const
+{
+    if (controlAssetIndexLoaded)
+        return;
+
+    controlAssetIndexLoaded = true;
+    controlAssetHashes.clear();
+    mergeControlAssetIndexFromDisk();
+}
+
+void CacheManager::mergeControlAssetIndexFromDisk() const
+{
+    juce::String indexPath = getControlAssetIndexPath();
+    if (!fileSystem.fileExists(indexPath))
+        return;
+
+    auto json = juce::JSON::parse(fileSystem.readFile(indexPath));
+    if (auto *assets = json["assets"].getDynamicObject())
+    {
+        for (const auto &property : assets->getProperties())
+            controlAssetHashes.emplace(property.name.toString(), property.value.toString());
+    }
+}
+
+bool CacheManager::saveControlAssetIndex() const
+{
+    if (!createDirectoryIfNeeded(getAssetsDirectory()))
+        return false;
+
+    // Other instances sharing the cache may have indexed paths since this one loaded
+    mergeControlAssetIndexFromDisk();
+
+    juce::DynamicObject::Ptr assets = new juce::DynamicObject();
+    for (const auto &entry : controlAssetHashes)
+        assets->setProperty(entry.first, entry.second);
+
+    juce::DynamicObject::Ptr jsonObj = new juce::DynamicObject();
+    jsonObj->setProperty("assets", juce::var(assets.get()));
+
+    return fileSystem.writeFileAsync(getControlAssetIndexPath(), juce::JSON::toString(juce::var(jsonObj)));
+}
+
+bool CacheManager::removeControlAssetIfUnused(const juce::String &hash)
+{
+    mergeControlAssetIndexFromDisk();
+
+    for (const auto &entry : controlAssetHashes)
+    {
+        if (entry.second == hash)
+            return false;
+    }
+
+    controlAssetImages.erase(hash);
+    return fileSystem.deleteFile(fileSystem.joinPath(getBlobsDirectory(), hash));
+}
+
+bool CacheManager::flushControlAssetIndex() const
+{
+    try
+    {
+        const juce::ScopedLock lock(controlAssetLock);
+        if (!controlAssetIndexDirty)
+            return true;
+
+        controlAssetIndexDirty = false;
+        return saveControlAssetIndex();
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+int CacheManager::removeOrphanedControlAssets(int gracePeriodMs)
+{
+    try
+    {
+        const juce::ScopedLock lock(controlAssetLock);
+        ensureControlAssetIndexLoaded();
+        mergeControlAssetIndexFromDisk();
+
+        std::unordered_set<juce::String> referencedHashes;
+        for (const auto &entry : controlAssetHashes)
+            referencedHashes.insert(entry.second);
+
+        // A young blob may belong to another instance that has not written its index yet
+        juce::Time cutoff = juce::Time::getCurrentTime() - juce::RelativeTime::milliseconds(gracePeriodMs);
+
+        int numRemoved = 0;
+        for (const auto &entry : fileSystem.listDirectory(getBlobsDirectory()))
+        {
+            if (entry.isDirectory || referencedHashes.count(entry.name) > 0 || entry.modificationTime > cutoff)
+                continue;
+
+            controlAssetImages.erase(entry.name);
+            if (fileSystem.deleteFile(fileSystem.joinPath(getBlobsDirectory(), entry.name)))
+                ++numRemoved;
+        }
+
+        return numRemoved;
+    }
+    catch (...)
+    {
+        return 0;
+    }
+}
+
+void CacheManager::handleAsyncUpdate()
+{
+    flushControlAssetIndex();
+}
+
 // Recently Used functionality
 bool CacheManager::addToRecentlyUsed(const juce::String &unitId)
 {
@@ -524,7 +792,8 @@ bool CacheManager::addToRecentlyUsed(const juce::String &unitId)
         }
         jsonObj->setProperty("recentlyUsed", array);
 
-        return fileSystem.writeFile(recentlyUsedFilePath, juce::JSON::toString(juce::var(jsonObj)));
+        recentlyUsedCacheValid = false;
+        return fileSystem.writeFileAsync(recentlyUsedFilePath, juce::JSON::toString(juce::var(jsonObj)));
     }
     catch (...)
     {
@@ -532,26 +801,42 @@ bool CacheManager::addToRecentlyUsed(const juce::String &unitId)
     }
 }
 
-juce::StringArray CacheManager::getRecentlyUsed(int maxCount) const
+juce::StringArray CacheManager::loadRecentlyUsedList() const
 {
-    try
-    {
-        juce::String recentlyUsedFilePath = fileSystem.joinPath(cacheRoot, "recently_used.json");
+    if (directoryWatcher != nullptr && recentlyUsedCacheValid)
+        return recentlyUsedCache;
 
-        juce::StringArray recentlyUsed;
+    // Mark valid before reading so a change reported mid-read is not lost
+    if (directoryWatcher != nullptr)
+        recentlyUsedCacheValid = true;
 
-        if (fileSystem.fileExists(recentlyUsedFilePath))
+    juce::String recentlyUsedFilePath = fileSystem.joinPath(cacheRoot, "recently_used.json");
+    juce::StringArray recentlyUsed;
+
+    if (fileSystem.fileExists(recentlyUsedFilePath))
+    {
+        auto json = juce::JSON::parse(fileSystem.readFile(recentlyUsedFilePath));
+        if (json.hasProperty("recentlyUsed") && json["recentlyUsed"].isArray())
         {
-            auto json = juce::JSON::parse(fileSystem.readFile(recentlyUsedFilePath));
-            if (json.hasProperty("recentlyUsed") && json["recentlyUsed"].isArray())
+            auto array = json["recentlyUsed"].getArray();
+            for (const auto &item : *array)
             {
-                auto array = json["recentlyUsed"].getArray();
-                for (const auto &item : *array)
-                {
-                    recentlyUsed.add(item.toString());
-                }
+                recentlyUsed.add(item.toString());
             }
         }
+    }
+
+    if (directoryWatcher != nullptr)
+        recentlyUsedCache = recentlyUsed;
+
+    return recentlyUsed;
+}
+
+juce::StringArray CacheManager::getRecentlyUsed(int maxCount) const
+{
+    try
+    {
+        juce::StringArray recentlyUsed = loadRecentlyUsedList();
 
         // Limit the returned list to maxCount
         if (recentlyUsed.size() > maxCount)
@@ -606,7 +891,8 @@ bool CacheManager::removeFromRecentlyUsed(const juce::String &unitId)
             }
             jsonObj->setProperty("recentlyUsed", array);
 
-            return fileSystem.writeFile(recentlyUsedFilePath, juce::JSON::toString(juce::var(jsonObj)));
+            recentlyUsedCacheValid = false;
+            return fileSystem.writeFileAsync(recentlyUsedFilePath, juce::JSON::toString(juce::var(jsonObj)));
         }
 
         return true; // Unit wasn't in the list, so "successfully" removed
@@ -625,6 +911,7 @@ bool CacheManager::clearRecentlyUsed()
 
         if (fileSystem.fileExists(recentlyUsedFilePath))
         {
+            recentlyUsedCacheValid = false;
             return fileSystem.deleteFile(recentlyUsedFilePath);
         }
 
@@ -640,25 +927,7 @@ bool CacheManager::isRecentlyUsed(const juce::String &unitId) const
 {
     try
     {
-        juce::String recentlyUsedFilePath = fileSystem.joinPath(cacheRoot, "recently_used.json");
-
-        if (fileSystem.fileExists(recentlyUsedFilePath))
-        {
-            auto json = juce::JSON::parse(fileSystem.readFile(recentlyUsedFilePath));
-            if (json.hasProperty("recentlyUsed") && json["recentlyUsed"].isArray())
-            {
-                auto array = json["recentlyUsed"].getArray();
-                for (const auto &item : *array)
-                {
-                    if (item.toString() == unitId)
-                    {
-                        return true;
-                    }
-                }
-            }
-        }
-
-        return false;
+        return loadRecentlyUsedList().contains(unitId);
     }
     catch (...)
     {
@@ -703,7 +972,7 @@ bool CacheManager::addToFavorites(const juce::String &unitId)
         }
         jsonObj->setProperty("favorites", array);
 
-        bool result = fileSystem.writeFile(favoritesFilePath, juce::JSON::toString(juce::var(jsonObj)));
+        bool result = fileSystem.writeFileAsync(favoritesFilePath, juce::JSON::toString(juce::var(jsonObj)));
         if (result)
         {
             favoritesCacheValid = false; // Invalidate cache
@@ -726,6 +995,9 @@ juce::StringArray CacheManager::getFavorites() const
 
     try
     {
+        // Mark valid before reading so a change reported mid-read is not lost
+        favoritesCacheValid = true;
+
         juce::String favoritesFilePath = fileSystem.joinPath(cacheRoot, "favorites.json");
         juce::StringArray favorites;
 
@@ -744,7 +1016,6 @@ juce::StringArray CacheManager::getFavorites() const
 
         // Update the cache
         favoritesCache = favorites;
-        favoritesCacheValid = true;
 
         return favorites;
     }
@@ -795,7 +1066,7 @@ bool CacheManager::removeFromFavorites(const juce::String &unitId)
             }
             jsonObj->setProperty("favorites", array);
 
-            bool result = fileSystem.writeFile(favoritesFilePath, juce::JSON::toString(juce::var(jsonObj)));
+            bool result = fileSystem.writeFileAsync(favoritesFilePath, juce::JSON::toString(juce::var(jsonObj)));
             if (result)
             {
                 favoritesCacheValid = false; // Invalidate cache
@@ -840,6 +1111,7 @@ void CacheManager::refreshFavoritesCache() const
     try
     {
         favoritesCache.clear();
+        favoritesCacheValid = true;
         juce::String favoritesFilePath = fileSystem.joinPath(cacheRoot, "favorites.json");
 
         if (fileSystem.fileExists(favoritesFilePath))
@@ -854,7 +1126,6 @@ void CacheManager::refreshFavoritesCache() const
                 }
             }
         }
-        favoritesCacheValid = true;
     }
     catch (...)
     {
@@ -3,8 +3,13 @@
 #include <juce_core/juce_core.h>
 #include <juce_graphics/juce_graphics.h>
 #include <juce_data_structures/juce_data_structures.h>
+#include <juce_events/juce_events.h>
+#include <unordered_map>
+#include <atomic>
 #include "IFileSystem.h"
 #include "FileSystem.h"
+#include "DirectoryWatcher.h"
+#include "MemoryUsage.h"
 
 /**
  * @brief Manages local caching of unit data and assets for the Analogiq plugin.
@@ -13,8 +18,13 @@
  * thumbnails, and control assets to improve performance and enable offline usage.
  * The cache is stored in the user's application data directory and mirrors the
  * remote structure for consistency.
+ *
+ * When a DirectoryWatcher is attached, the favorites and recently used lists
+ * are re-read only after their files change on disk, which also picks up
+ * changes written by other plugin instances.
  */
-class CacheManager
+class CacheManager : public DirectoryWatcher::Listener,
+                     private juce::AsyncUpdater
 {
 public:
     /**
@@ -22,6 +32,14 @@ public:
      */
     static constexpr int MAX_RECENTLY_USED = 20;
 
+    /**
+     * @brief Minimum age of an unreferenced control asset blob before it is deleted.
+     *
+     * Another plugin instance sharing the cache writes a blob before the index
+     * entry that refers to it, so a young blob may simply not be indexed yet.
+     */
+    static constexpr int ORPHANED_BLOB_GRACE_PERIOD_MS = 60 * 60 * 1000;
+
     /**
      * @brief Constructor for CacheManager.
      *
@@ -31,9 +49,9 @@ public:
     CacheManager(IFileSystem &fileSystem, const juce::String &cacheRootPath = "");
 
     /**
-     * @brief Destructor.
+     * @brief Destructor. Detaches from the directory watcher, if any.
      */
-    ~CacheManager() = default;
+    ~CacheManager() override;
 
     // Prevent copying and assignment
     CacheManager(const CacheManager &) = delete;
@@ -131,6 +149,25 @@ public:
      */
     juce::String getCachedControlAssetPath(const juce::String &assetPath) const;
 
+    /**
+     * @brief Gets the content hash that a control asset path resolves to.
+     *
+     * Control assets are stored once per unique content; any number of asset
+     * paths may alias the same blob.
+     *
+     * @param assetPath The relative path to the control asset
+     * @return The content hash, or empty string if the path is not in the index
+     */
+    juce::String getControlAssetHash(const juce::String &assetPath) const;
+
+    /**
+     * @brief Computes the content hash used to address cached blobs.
+     *
+     * @param data The data to hash
+     * @return A hex string combining a 64-bit FNV-1a digest and the data size
+     */
+    static juce::String computeContentHash(const juce::MemoryBlock &data);
+
     /**
      * @brief Saves unit JSON data to the cache.
      *
@@ -163,12 +200,43 @@ public:
     /**
      * @brief Saves a control asset to the cache.
      *
+     * The data is stored under its content hash, so identical assets referenced
+     * from different paths occupy a single blob on disk. The path index is
+     * written once for all the aliases saved before the message thread next
+     * runs; see flushControlAssetIndex(). A blob the path no longer refers to
+     * is deleted unless another path shares it.
+     *
      * @param assetPath The relative path to the control asset
      * @param imageData The image data to cache
      * @return true if saving was successful, false otherwise
      */
     bool saveControlAssetToCache(const juce::String &assetPath, const juce::MemoryBlock &imageData);
 
+    /**
+     * @brief Writes the control asset path index if aliases were saved since it was last written.
+     *
+     * Saving a control asset only marks the index as changed and schedules one
+     * write, so loading a unit's controls serializes the index once rather than
+     * once per alias. Call this before another CacheManager reads the index
+     * from the same cache; the destructor calls it too.
+     *
+     * @return true if the index was queued for writing or had no changes, false otherwise
+     */
+    bool flushControlAssetIndex() const;
+
+    /**
+     * @brief Deletes control asset blobs that no asset path refers to.
+     *
+     * Blobs can be left behind when the process exits after writing a blob
+     * but before the index that refers to it. The index on disk is merged in
+     * first, so blobs indexed by other instances sharing the cache are kept,
+     * and blobs younger than the grace period are never deleted.
+     *
+     * @param gracePeriodMs Minimum age in milliseconds of a blob before it can be deleted
+     * @return The number of blobs deleted
+     */
+    int removeOrphanedControlAssets(int gracePeriodMs = ORPHANED_BLOB_GRACE_PERIOD_MS);
+
     /**
      * @brief Loads unit JSON data from the cache.
      *
@@ -198,15 +266,27 @@ public:
     /**
      * @brief Loads a control asset from the cache.
      *
+     * Decoded images are kept per content hash, so every path aliasing the
+     * same blob shares a single juce::Image.
+     *
      * @param assetPath The relative path to the control asset
      * @return The cached image, or invalid image if not found
      */
     juce::Image loadControlAssetFromCache(const juce::String &assetPath) const;
 
+    /**
+     * @brief Gets the memory held by the decoded control assets kept in memory.
+     *
+     * @param images Counts each image once across holders, such as the rack's definitions
+     * @return The control images
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
+
     /**
      * @brief Clears all cached data.
      *
-     * Removes all files and directories in the cache.
+     * Removes all files and directories in the cache, including every control
+     * asset blob, and discards an index write that has not happened yet.
      *
      * @return true if clearing was successful, false otherwise
      */
@@ -303,6 +383,22 @@ public:
      */
     juce::StringArray getFavorites() const;
 
+    /**
+     * @brief Watches the cache root so the favorites and recently used caches
+     * are invalidated when their files change.
+     *
+     * @param watcher The watcher to register with, which must outlive this object
+     */
+    void attachWatcher(DirectoryWatcher &watcher);
+
+    /**
+     * @brief Invalidates the in-memory lists whose files changed.
+     *
+     * @param directory The cache root directory
+     * @param changedNames The changed filenames, or empty if anything may have changed
+     */
+    void directoryChanged(const juce::String &directory, const juce::StringArray &changedNames) override;
+
     /**
      * @brief Returns a reference to a dummy cache manager (Null Object Pattern).
      *
@@ -316,7 +412,20 @@ private:
 
     // In-memory cache for favorites to avoid repeated file reads
     mutable juce::StringArray favoritesCache;
-    mutable bool favoritesCacheValid = false;
+    mutable std::atomic<bool> favoritesCacheValid{false};
+
+    // In-memory cache for recently used items, only trusted while a watcher is attached
+    mutable juce::StringArray recentlyUsedCache;
+    mutable std::atomic<bool> recentlyUsedCacheValid{false};
+
+    DirectoryWatcher *directoryWatcher = nullptr; ///< Watcher invalidating the caches above, if any
+
+    // Content-addressed control asset store
+    mutable juce::CriticalSection controlAssetLock;                          ///< Guards the control asset maps
+    mutable std::unordered_map<juce::String, juce::String> controlAssetHashes; ///< Asset path -> content hash
+    mutable std::unordered_map<juce::String, juce::Image> controlAssetImages;  ///< Content hash -> decoded image
+    mutable bool controlAssetIndexLoaded = false;                            ///< Whether the index has been read from disk
+    mutable bool controlAssetIndexDirty = false;                             ///< Whether the index has changes not yet written
 
     // Directory path getters
     juce::String getUnitsDirectory() const;
@@ -324,6 +433,64 @@ private:
     juce::String getFaceplatesDirectory() const;
     juce::String getThumbnailsDirectory() const;
     juce::String getControlsDirectory() const;
+    juce::String getBlobsDirectory() const;
+    juce::String getControlAssetIndexPath() const;
+
+    /**
+     * @brief Loads the full recently used list, from memory when it is known to be current.
+     *
+     * @return Array of recently used unit identifiers, most recent first
+     */
+    juce::StringArray loadRecentlyUsedList() const;
+
+    /**
+     * @brief Normalizes a control asset path into its index key.
+     *
+     * @param assetPath The relative path to the control asset
+     * @return The path relative to the controls directory
+     */
+    juce::String getControlAssetKey(const juce::String &assetPath) const;
+
+    /**
+     * @brief Reads the path-to-hash index from disk if not already loaded.
+     *
+     * Must be called with controlAssetLock held.
+     */
+    void ensureControlAssetIndexLoaded() const;
+
+    /**
+     * @brief Adds the entries other instances have written to the on-disk index.
+     *
+     * Paths this instance already maps keep their hash. Must be called with
+     * controlAssetLock held.
+     */
+    void mergeControlAssetIndexFromDisk() const;
+
+    /**
+     * @brief Writes the path-to-hash index to disk.
+     *
+     * The on-disk index is merged in first so entries written by other
+     * instances are not lost. Must be called with controlAssetLock held.
+     *
+     * @return true if the index was written successfully, false otherwise
+     */
+    bool saveControlAssetIndex() const;
+
+    /**
+     * @brief Deletes a blob and its decoded image once no asset path refers to it.
+     *
+     * Paths indexed on disk by other instances count as references. Must be
+     * called with controlAssetLock held.
+     *
+     * @param hash The content hash of the blob
+     * @return true if the blob was unused and deleted, false otherwise
+     */
+    bool removeControlAssetIfUnused(const juce::String &hash);
+
+    /**
+     * @brief Writes the control asset index scheduled by saveControlAssetToCache().
+     */
+    void handleAsyncUpdate() override;
 
     /**
      * @brief Creates a directory if it doesn't exist.
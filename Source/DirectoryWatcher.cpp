@@ -0,0 +1,333 @@
+/**
+ * @file DirectoryWatcher.cpp
+ * @brief Implementation of the DirectoryWatcher class.
+ *
+ * This file implements directory change notification using inotify on Linux,
+ * with a polling fallback built on IFileSystem::listDirectory for other
+ * platforms and for directories that cannot be watched natively.
+ */
+
+#include "DirectoryWatcher.h"
+
+#if JUCE_LINUX
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#if JUCE_LINUX
+namespace
+{
+    /** Events that mean the contents of a watched directory changed. */
+    constexpr juce::uint32 nativeWatchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MODIFY |
+                                             IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB |
+                                             IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+}
+#endif
+
+DirectoryWatcher::DirectoryWatcher(IFileSystem &fileSystem, int pollIntervalMs)
+    : juce::Thread("AnalogIQ Directory Watcher"),
+      fileSystem(fileSystem),
+      pollIntervalMs(pollIntervalMs)
+{
+#if JUCE_LINUX
+    nativeNotifier = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+    signalThreadShouldExit();
+    notify();
+    stopThread(juce::jmax(pollIntervalMs, 0) + 1000);
+
+    const juce::ScopedLock lock(watchLock);
+    for (auto *watch : watches)
+        removeNativeWatch(*watch);
+    watches.clear();
+
+#if JUCE_LINUX
+    if (nativeNotifier >= 0)
+        ::close(nativeNotifier);
+#endif
+}
+
+void DirectoryWatcher::addWatch(const juce::String &directory, Listener *listener)
+{
+    if (directory.isEmpty() || listener == nullptr)
+        return;
+
+    {
+        const juce::ScopedLock lock(watchLock);
+
+        Watch *existing = nullptr;
+        for (auto *watch : watches)
+            if (watch->directory == directory)
+                existing = watch;
+
+        if (existing == nullptr)
+        {
+            existing = watches.add(new Watch());
+            existing->directory = directory;
+
+            if (!tryAddNativeWatch(*existing))
+                existing->snapshot = takeSnapshot(directory);
+        }
+
+        existing->listeners.addIfNotAlreadyThere(listener);
+    }
+
+    if (pollIntervalMs > 0 && !isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+}
+
+void DirectoryWatcher::removeListener(Listener *listener)
+{
+    const juce::ScopedLock lock(watchLock);
+
+    for (int i = watches.size(); --i >= 0;)
+    {
+        auto *watch = watches.getUnchecked(i);
+        watch->listeners.removeAllInstancesOf(listener);
+
+        if (watch->listeners.isEmpty())
+        {
+            removeNativeWatch(*watch);
+            watches.remove(i);
+        }
+    }
+}
+
+bool DirectoryWatcher::isUsingNativeEvents(const juce::String &directory) const
+{
+    const juce::ScopedLock lock(watchLock);
+
+    for (auto *watch : watches)
+        if (watch->directory == directory)
+            return watch->nativeHandle >= 0;
+
+    return false;
+}
+
+void DirectoryWatcher::checkForChanges()
+{
+    const juce::ScopedLock lock(watchLock);
+    readNativeEvents();
+    pollWatches();
+}
+
+void DirectoryWatcher::run()
+{
+    lastPollTime = juce::Time::getMillisecondCounter();
+
+    while (!threadShouldExit())
+    {
+        bool eventsReady = false;
+
+#if JUCE_LINUX
+        if (nativeNotifier >= 0)
+        {
+            pollfd descriptor{nativeNotifier, POLLIN, 0};
+            eventsReady = ::poll(&descriptor, 1, pollIntervalMs) > 0 && (descriptor.revents & POLLIN) != 0;
+        }
+        else
+#endif
+        {
+            wait(pollIntervalMs);
+        }
+
+        if (threadShouldExit())
+            break;
+
+        const juce::ScopedLock lock(watchLock);
+
+        if (eventsReady)
+            readNativeEvents();
+
+        // Steady native events must not starve the polled directories
+        auto now = juce::Time::getMillisecondCounter();
+        if (now - lastPollTime >= (juce::uint32)pollIntervalMs)
+        {
+            lastPollTime = now;
+            pollWatches();
+        }
+    }
+}
+
+bool DirectoryWatcher::tryAddNativeWatch(Watch &watch)
+{
+#if JUCE_LINUX
+    if (nativeNotifier < 0 || !juce::File::isAbsolutePath(watch.directory))
+        return false;
+
+    if (!juce::File(watch.directory).isDirectory())
+        return false;
+
+    watch.nativeHandle = inotify_add_watch(nativeNotifier, watch.directory.toRawUTF8(), nativeWatchMask);
+    if (watch.nativeHandle >= 0)
+    {
+        watch.snapshot.clear();
+        return true;
+    }
+#else
+    juce::ignoreUnused(watch);
+#endif
+
+    return false;
+}
+
+void DirectoryWatcher::removeNativeWatch(Watch &watch)
+{
+#if JUCE_LINUX
+    if (watch.nativeHandle >= 0 && nativeNotifier >= 0)
+        inotify_rm_watch(nativeNotifier, watch.nativeHandle);
+#endif
+
+    watch.nativeHandle = -1;
+}
+
+void DirectoryWatcher::readNativeEvents()
+{
+#if JUCE_LINUX
+    if (nativeNotifier < 0)
+        return;
+
+    std::map<int, juce::StringArray> changedNamesByHandle;
+    juce::Array<int> fullyChangedHandles;
+    juce::Array<int> lostHandles;
+    bool overflowed = false;
+
+    alignas(inotify_event) char buffer[4096];
+    for (;;)
+    {
+        auto bytesRead = ::read(nativeNotifier, buffer, sizeof(buffer));
+        if (bytesRead <= 0)
+            break;
+
+        for (char *position = buffer; position < buffer + bytesRead;)
+        {
+            auto *event = reinterpret_cast<const inotify_event *>(position);
+            position += sizeof(inotify_event) + event->len;
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0)
+            {
+                overflowed = true;
+                continue;
+            }
+
+            if ((event->mask & IN_IGNORED) != 0)
+            {
+                lostHandles.addIfNotAlreadyThere(event->wd);
+                continue;
+            }
+
+            if ((event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) != 0 || event->len == 0)
+                fullyChangedHandles.addIfNotAlreadyThere(event->wd);
+            else
+                changedNamesByHandle[event->wd].addIfNotAlreadyThere(juce::String::fromUTF8(event->name));
+        }
+    }
+
+    for (auto *watch : watches)
+    {
+        if (watch->nativeHandle < 0)
+            continue;
+
+        const int handle = watch->nativeHandle;
+
+        if (lostHandles.contains(handle))
+        {
+            // The directory went away; poll until it can be watched again
+            watch->nativeHandle = -1;
+            watch->snapshot = takeSnapshot(watch->directory);
+            notifyListeners(*watch, {});
+        }
+        else if (overflowed || fullyChangedHandles.contains(handle))
+        {
+            notifyListeners(*watch, {});
+        }
+        else
+        {
+            auto changed = changedNamesByHandle.find(handle);
+            if (changed != changedNamesByHandle.end())
+                notifyListeners(*watch, changed->second);
+        }
+    }
+#endif
+}
+
+void DirectoryWatcher::pollWatches()
+{
+    for (auto *watch : watches)
+    {
+        if (watch->nativeHandle >= 0)
+            continue;
+
+        // A directory that now exists on disk no longer needs polling
+        if (tryAddNativeWatch(*watch))
+        {
+            notifyListeners(*watch, {});
+            continue;
+        }
+
+        auto current = takeSnapshot(watch->directory);
+        juce::StringArray changedNames;
+
+        for (const auto &entry : current)
+        {
+            auto previous = watch->snapshot.find(entry.first);
+            if (previous == watch->snapshot.end() || !(previous->second == entry.second))
+                changedNames.add(entry.first);
+        }
+
+        for (const auto &entry : watch->snapshot)
+        {
+            if (current.find(entry.first) == current.end())
+                changedNames.add(entry.first);
+        }
+
+        watch->snapshot = std::move(current);
+
+        if (!changedNames.isEmpty())
+            notifyListeners(*watch, changedNames);
+    }
+}
+
+std::map<juce::String, DirectoryWatcher::FileSignature> DirectoryWatcher::takeSnapshot(const juce::String &directory) const
+{
+    std::map<juce::String, FileSignature> snapshot;
+
+    try
+    {
+        for (const auto &entry : fileSystem.listDirectory(directory))
+        {
+            FileSignature signature;
+            signature.size = entry.size;
+            signature.modificationTime = entry.modificationTime.toMilliseconds();
+            signature.isDirectory = entry.isDirectory;
+            snapshot[entry.name] = signature;
+        }
+    }
+    catch (...)
+    {
+        snapshot.clear();
+    }
+
+    return snapshot;
+}
+
+void DirectoryWatcher::notifyListeners(const Watch &watch, const juce::StringArray &changedNames)
+{
+    if (changedNames.isEmpty())
+    {
+        fileSystem.invalidateCachedMetadata(watch.directory);
+    }
+    else
+    {
+        for (const auto &name : changedNames)
+            fileSystem.invalidateCachedMetadata(fileSystem.joinPath(watch.directory, name));
+    }
+
+    for (auto *listener : watch.listeners)
+        listener->directoryChanged(watch.directory, changedNames);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file DirectoryWatcher.h
+ * @brief Header file for the DirectoryWatcher class.
+ *
+ * This file defines the DirectoryWatcher class, which reports changes to the
+ * files in a set of directories so that in-memory views of those directories
+ * can be updated incrementally instead of being rebuilt on every access.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "IFileSystem.h"
+#include <map>
+
+/**
+ * @brief Watches directories and tells listeners which files changed.
+ *
+ * On Linux, directories that exist on disk are watched with inotify, so
+ * changes are reported as soon as they happen without touching the disk.
+ * Everywhere else, and for directories that cannot be watched natively
+ * (missing directories, virtual file systems), the watcher falls back to
+ * listing the directory through IFileSystem at a fixed interval and diffing
+ * the name, size and modification time of each entry.
+ *
+ * Cached metadata for every changed path is dropped from the IFileSystem
+ * before listeners are notified, so listeners can safely re-check the files.
+ */
+class DirectoryWatcher : private juce::Thread
+{
+public:
+    /**
+     * @brief Default interval between polls of directories without native events.
+     */
+    static constexpr int DEFAULT_POLL_INTERVAL_MS = 1000;
+
+    /**
+     * @brief Receives change notifications for watched directories.
+     */
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+
+        /**
+         * @brief Called when files in a watched directory changed.
+         *
+         * Called on the watcher thread, or on the caller's thread from
+         * checkForChanges(). Implementations should only record the change.
+         *
+         * @param directory The watched directory
+         * @param changedNames Names of the files that were created, modified or
+         *                     removed; empty if anything in the directory may have changed
+         */
+        virtual void directoryChanged(const juce::String &directory, const juce::StringArray &changedNames) = 0;
+    };
+
+    /**
+     * @brief Constructs a directory watcher.
+     *
+     * @param fileSystem The file system used for polling and metadata invalidation
+     * @param pollIntervalMs Interval between background checks; 0 or less disables
+     *                       the background thread so changes are only picked up by checkForChanges()
+     */
+    explicit DirectoryWatcher(IFileSystem &fileSystem, int pollIntervalMs = DEFAULT_POLL_INTERVAL_MS);
+
+    /**
+     * @brief Destructor. Stops the background thread and releases native watches.
+     */
+    ~DirectoryWatcher() override;
+
+    /**
+     * @brief Starts reporting changes in a directory to a listener.
+     *
+     * @param directory The directory to watch; it does not need to exist yet
+     * @param listener The listener to notify, which must outlive the watch or remove itself
+     */
+    void addWatch(const juce::String &directory, Listener *listener);
+
+    /**
+     * @brief Stops notifying a listener about every directory it watches.
+     *
+     * Blocks until any notification in progress has returned.
+     *
+     * @param listener The listener to remove
+     */
+    void removeListener(Listener *listener);
+
+    /**
+     * @brief Checks whether a directory is watched with native change events.
+     *
+     * @param directory The watched directory
+     * @return true if native events are used, false if the directory is polled or not watched
+     */
+    bool isUsingNativeEvents(const juce::String &directory) const;
+
+    /**
+     * @brief Checks every watched directory now and notifies listeners of changes.
+     */
+    void checkForChanges();
+
+private:
+    /**
+     * @brief What a poll recorded about one directory entry.
+     */
+    struct FileSignature
+    {
+        juce::int64 size = 0;             ///< Size in bytes
+        juce::int64 modificationTime = 0; ///< Modification time in milliseconds
+        bool isDirectory = false;         ///< Whether the entry is a directory
+
+        bool operator==(const FileSignature &other) const
+        {
+            return size == other.size && modificationTime == other.modificationTime && isDirectory == other.isDirectory;
+        }
+    };
+
+    /**
+     * @brief A watched directory and its listeners.
+     */
+    struct Watch
+    {
+        juce::String directory;                         ///< The watched directory
+        juce::Array<Listener *> listeners;              ///< Listeners for this directory
+        std::map<juce::String, FileSignature> snapshot; ///< Entries seen by the last poll
+        int nativeHandle = -1;                          ///< Native watch descriptor, or -1 when polled
+    };
+
+    void run() override;
+
+    /**
+     * @brief Tries to watch a directory with native events.
+     *
+     * Must be called with watchLock held.
+     *
+     * @param watch The watch to upgrade
+     * @return true if native events are now used for the watch
+     */
+    bool tryAddNativeWatch(Watch &watch);
+
+    /**
+     * @brief Releases the native watch of a directory, if any.
+     *
+     * Must be called with watchLock held.
+     *
+     * @param watch The watch to release
+     */
+    void removeNativeWatch(Watch &watch);
+
+    /**
+     * @brief Reads pending native events and notifies listeners.
+     *
+     * Must be called with watchLock held.
+     */
+    void readNativeEvents();
+
+    /**
+     * @brief Polls every directory without a native watch and notifies listeners.
+     *
+     * Must be called with watchLock held.
+     */
+    void pollWatches();
+
+    /**
+     * @brief Lists a directory into a snapshot.
+     *
+     * @param directory The directory to list
+     * @return Entry name -> signature
+     */
+    std::map<juce::String, FileSignature> takeSnapshot(const juce::String &directory) const;
+
+    /**
+     * @brief Drops cached metadata for the changed paths and notifies listeners.
+     *
+     * Must be called with watchLock held.
+     *
+     * @param watch The watch whose directory changed
+     * @param changedNames The changed names, or empty if anything may have changed
+     */
+    void notifyListeners(const Watch &watch, const juce::StringArray &changedNames);
+
+    IFileSystem &fileSystem;                   ///< File system used for polling
+    const int pollIntervalMs;                  ///< Interval between background checks
+    mutable juce::CriticalSection watchLock;   ///< Guards watches; held while notifying
+    juce::OwnedArray<Watch> watches;           ///< The watched directories
+    int nativeNotifier = -1;                   ///< Native notification handle, or -1 if unavailable
+    juce::uint32 lastPollTime = 0;             ///< Millisecond counter at the last poll
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DirectoryWatcher)
+};
@@ -15,6 +15,305 @@
 // Cache directory name constant
 static const juce::String ANALOGIQ_CACHE_DIR = "AnalogiqCache";
 
+/**
+ * @brief Background thread that drains the FileSystem write queue.
+ */
+class FileSystem::WriteQueueThread : public juce::Thread
+{
+public:
+    explicit WriteQueueThread(FileSystem &owner)
+        : juce::Thread("AnalogIQ File Writer"), owner(owner) {}
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            owner.processPendingWrites();
+            wait(-1);
+        }
+    }
+
+private:
+    FileSystem &owner;
+};
+
+FileSystem::FileSystem() = default;
+
+FileSystem::FileSystem(int metadataCacheTtlMs)
+    : metadataCacheTtlMs(juce::jmax(0, metadataCacheTtlMs))
+{
+}
+
+FileSystem::~FileSystem()
+{
+    flushPendingWrites();
+
+    if (writeQueueThread != nullptr)
+    {
+        writeQueueThread->signalThreadShouldExit();
+        writeQueueThread->notify();
+        writeQueueThread->stopThread(2000);
+    }
+}
+
+juce::int64 FileSystem::PendingWrite::getSize() const
+{
+    if (isText)
+        return (juce::int64)text.getNumBytesAsUTF8();
+
+    return data != nullptr ? (juce::int64)data->getSize() : 0;
+}
+
+juce::MemoryBlock FileSystem::PendingWrite::toMemoryBlock() const
+{
+    if (isText)
+        return juce::MemoryBlock(text.toRawUTF8(), text.getNumBytesAsUTF8());
+
+    return data != nullptr ? *data : juce::MemoryBlock();
+}
+
+bool FileSystem::writeFileAsync(const juce::String &path, const juce::String &content)
+{
+    if (path.isEmpty())
+    {
+        return false;
+    }
+
+    PendingWrite write;
+    write.isText = true;
+    write.text = content;
+    enqueueWrite(juce::File(path).getFullPathName(), std::move(write));
+    return true;
+}
+
+bool FileSystem::writeFileAsync(const juce::String &path, const juce::MemoryBlock &data)
+{
+    if (path.isEmpty())
+    {
+        return false;
+    }
+
+    PendingWrite write;
+    write.data = std::make_shared<const juce::MemoryBlock>(data);
+    enqueueWrite(juce::File(path).getFullPathName(), std::move(write));
+    return true;
+}
+
+bool FileSystem::flushPendingWrites()
+{
+    // Drain on the calling thread; writeLock keeps this from racing the writer thread
+    processPendingWrites();
+
+    const juce::ScopedLock lock(pendingLock);
+    const bool allWritten = failedWrites.isEmpty();
+    failedWrites.clear();
+    return allWritten;
+}
+
+void FileSystem::enqueueWrite(const juce::String &key, PendingWrite write)
+{
+    {
+        const juce::ScopedLock lock(pendingLock);
+        write.generation = ++nextGeneration;
+        pendingWrites[key] = std::move(write);
+
+        if (writeQueueThread == nullptr)
+        {
+            writeQueueThread = std::make_unique<WriteQueueThread>(*this);
+            writeQueueThread->startThread(juce::Thread::Priority::low);
+        }
+    }
+
+    writeQueueThread->notify();
+}
+
+bool FileSystem::getPendingWrite(const juce::String &key, PendingWrite &write) const
+{
+    const juce::ScopedLock lock(pendingLock);
+    auto it = pendingWrites.find(key);
+    if (it == pendingWrites.end())
+        return false;
+
+    write = it->second;
+    return true;
+}
+
+juce::int64 FileSystem::getPendingWriteSize(const juce::String &key) const
+{
+    const juce::ScopedLock lock(pendingLock);
+    auto it = pendingWrites.find(key);
+    return it != pendingWrites.end() ? it->second.getSize() : -1;
+}
+
+void FileSystem::cancelPendingWrites(const juce::String &key)
+{
+    const juce::ScopedLock lock(pendingLock);
+    const juce::String childPrefix = key + juce::File::getSeparatorString();
+    for (auto it = pendingWrites.begin(); it != pendingWrites.end();)
+    {
+        if (it->first == key || it->first.startsWith(childPrefix))
+            it = pendingWrites.erase(it);
+        else
+            ++it;
+    }
+}
+
+void FileSystem::processPendingWrites()
+{
+    for (;;)
+    {
+        const juce::ScopedLock writeGuard(writeLock);
+
+        juce::String key;
+        PendingWrite write;
+        {
+            const juce::ScopedLock lock(pendingLock);
+            if (pendingWrites.empty())
+                return;
+
+            key = pendingWrites.begin()->first;
+            write = pendingWrites.begin()->second;
+        }
+
+        const bool written = writeNow(juce::File(key), write);
+
+        // Keep the entry if a newer write was queued while this one was on disk
+        const juce::ScopedLock lock(pendingLock);
+        if (written)
+        {
+            failedWrites.removeString(key);
+        }
+        else
+        {
+            failedWrites.addIfNotAlreadyThere(key);
+        }
+
+        auto it = pendingWrites.find(key);
+        if (it != pendingWrites.end() && it->second.generation == write.generation)
+            pendingWrites.erase(it);
+    }
+}
+
+bool FileSystem::writeNow(const juce::File &file, const PendingWrite &write)
+{
+    // replaceWith* write to a temporary file and rename it over the target
+    bool result = write.isText ? file.replaceWithText(write.text)
+                               : write.data != nullptr && file.replaceWithData(write.data->getData(), write.data->getSize());
+
+    const juce::String key = file.getFullPathName();
+    invalidateMetadata(key);
+    if (result)
+        storeMetadata(key, EntryKind::File);
+
+    return result;
+}
+
+void FileSystem::setMetadataCacheTtl(int newTtlMs)
+{
+    const juce::ScopedLock lock(metadataLock);
+    metadataCacheTtlMs = juce::jmax(0, newTtlMs);
+    metadataCache.clear();
+}
+
+void FileSystem::clearMetadataCache()
+{
+    const juce::ScopedLock lock(metadataLock);
+    metadataCache.clear();
+}
+
+FileSystem::MetadataCacheStats FileSystem::getMetadataCacheStats() const
+{
+    const juce::ScopedLock lock(metadataLock);
+    return metadataStats;
+}
+
+void FileSystem::invalidateCachedMetadata(const juce::String &path)
+{
+    invalidateMetadata(getMetadataKey(path));
+}
+
+juce::String FileSystem::getMetadataKey(const juce::String &path)
+{
+    return juce::File(path).getFullPathName();
+}
+
+bool FileSystem::lookupMetadata(const juce::String &key, bool forDirectory, MetadataEntry &entry)
+{
+    const juce::ScopedLock lock(metadataLock);
+    if (metadataCacheTtlMs <= 0)
+        return false;
+
+    auto it = metadataCache.find(key);
+    if (it == metadataCache.end())
+    {
+        ++metadataStats.misses;
+        return false;
+    }
+
+    // Compare as a signed difference so the millisecond counter can wrap
+    if ((juce::int32)(juce::Time::getMillisecondCounter() - it->second.expiresAt) >= 0)
+    {
+        metadataCache.erase(it);
+        ++metadataStats.misses;
+        return false;
+    }
+
+    // A partial entry only answers the question it was recorded for
+    const auto kind = it->second.kind;
+    if ((forDirectory && kind == EntryKind::NotFile) || (!forDirectory && kind == EntryKind::NotDirectory))
+    {
+        ++metadataStats.misses;
+        return false;
+    }
+
+    ++metadataStats.hits;
+    entry = it->second;
+    return true;
+}
+
+void FileSystem::storeMetadata(const juce::String &key, EntryKind kind, bool readable)
+{
+    const juce::ScopedLock lock(metadataLock);
+    if (metadataCacheTtlMs <= 0)
+        return;
+
+    // Knowing it is neither a file nor a directory means nothing is there
+    auto existing = metadataCache.find(key);
+    if (existing != metadataCache.end())
+    {
+        const auto previous = existing->second.kind;
+        if ((kind == EntryKind::NotFile && previous == EntryKind::NotDirectory) ||
+            (kind == EntryKind::NotDirectory && previous == EntryKind::NotFile))
+            kind = EntryKind::Missing;
+    }
+
+    MetadataEntry entry;
+    entry.kind = kind;
+    entry.readable = readable;
+    entry.expiresAt = juce::Time::getMillisecondCounter() + (juce::uint32)metadataCacheTtlMs;
+    metadataCache[key] = entry;
+}
+
+void FileSystem::invalidateMetadata(const juce::String &key)
+{
+    const juce::ScopedLock lock(metadataLock);
+    if (metadataCache.empty())
+        return;
+
+    const juce::String childPrefix = key + juce::File::getSeparatorString();
+    for (auto it = metadataCache.begin(); it != metadataCache.end();)
+    {
+        const auto &cachedPath = it->first;
+        const bool isSelfOrChild = cachedPath == key || cachedPath.startsWith(childPrefix);
+        const bool isAncestor = key.startsWith(cachedPath + juce::File::getSeparatorString());
+
+        if (isSelfOrChild || isAncestor)
+            it = metadataCache.erase(it);
+        else
+            ++it;
+    }
+}
+
 bool FileSystem::createDirectory(const juce::String &path)
 {
     if (path.isEmpty())
@@ -26,6 +325,13 @@ bool FileSystem::createDirectory(const juce::String &path)
     {
         juce::File file(path);
         bool result = file.createDirectory();
+
+        // createDirectory() may also have created missing parents
+        const juce::String key = file.getFullPathName();
+        invalidateMetadata(key);
+        if (result)
+            storeMetadata(key, EntryKind::Directory);
+
         return result;
     }
     catch (...)
@@ -37,14 +343,27 @@ bool FileSystem::createDirectory(const juce::String &path)
 bool FileSystem::writeFile(const juce::String &path, const juce::String &content)
 {
     juce::File file(path);
-    bool result = file.replaceWithText(content);
-    return result;
+
+    // A direct write supersedes anything still queued for the same file
+    const juce::ScopedLock writeGuard(writeLock);
+    cancelPendingWrites(file.getFullPathName());
+
+    PendingWrite write;
+    write.isText = true;
+    write.text = content;
+    return writeNow(file, write);
 }
 
 bool FileSystem::writeFile(const juce::String &path, const juce::MemoryBlock &data)
 {
     juce::File file(path);
-    return file.replaceWithData(data.getData(), data.getSize());
+
+    const juce::ScopedLock writeGuard(writeLock);
+    cancelPendingWrites(file.getFullPathName());
+
+    PendingWrite write;
+    write.data = std::make_shared<const juce::MemoryBlock>(data);
+    return writeNow(file, write);
 }
 
 juce::String FileSystem::readFile(const juce::String &path)
@@ -57,6 +376,13 @@ juce::String FileSystem::readFile(const juce::String &path)
     try
     {
         juce::File file(path);
+
+        PendingWrite pending;
+        if (getPendingWrite(file.getFullPathName(), pending))
+        {
+            return pending.isText ? pending.text : pending.toMemoryBlock().toString();
+        }
+
         if (file.existsAsFile())
         {
             juce::String result = file.loadFileAsString();
@@ -78,6 +404,13 @@ juce::MemoryBlock FileSystem::readBinaryFile(const juce::String &path)
     }
 
     juce::File file(path);
+
+    PendingWrite pending;
+    if (getPendingWrite(file.getFullPathName(), pending))
+    {
+        return pending.toMemoryBlock();
+    }
+
     juce::MemoryBlock data;
     if (file.existsAsFile())
     {
@@ -86,6 +419,47 @@ juce::MemoryBlock FileSystem::readBinaryFile(const juce::String &path)
     return data;
 }
 
+FileView FileSystem::mapFile(const juce::String &path)
+{
+    if (path.isEmpty())
+    {
+        return {};
+    }
+
+    try
+    {
+        juce::File file(path);
+
+        PendingWrite pending;
+        if (getPendingWrite(file.getFullPathName(), pending))
+        {
+            return FileView(pending.toMemoryBlock());
+        }
+
+        if (!file.existsAsFile() || file.getSize() == 0)
+        {
+            return {};
+        }
+
+        auto mapped = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+        if (mapped->getData() == nullptr)
+        {
+            // Mapping can fail on some volumes; fall back to a regular read
+            juce::MemoryBlock data;
+            if (file.loadFileAsData(data))
+                return FileView(std::move(data));
+
+            return {};
+        }
+
+        return FileView(std::move(mapped));
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
 bool FileSystem::fileExists(const juce::String &path)
 {
     if (path.isEmpty())
@@ -96,27 +470,44 @@ bool FileSystem::fileExists(const juce::String &path)
     try
     {
         juce::File file(path);
+        const bool isJpeg = path.endsWith(".jpg") || path.endsWith(".jpeg");
+        const juce::String key = file.getFullPathName();
+
+        if (getPendingWriteSize(key) >= 0)
+        {
+            return true;
+        }
+
+        MetadataEntry cached;
+        if (lookupMetadata(key, false, cached))
+        {
+            const juce::ScopedLock lock(metadataLock);
+            // One stat for the existence check, plus the open for JPEGs
+            metadataStats.syscallsSaved += (isJpeg && cached.kind == EntryKind::File) ? 2 : 1;
+            return cached.kind == EntryKind::File && cached.readable;
+        }
+
         bool result = file.existsAsFile();
+        bool readable = true;
 
         // Special handling for JPEG files that cause JUCE assertions
-        if (result && (path.endsWith(".jpg") || path.endsWith(".jpeg")))
+        if (result && isJpeg)
         {
             // For JPEG files, also verify the file is readable to prevent assertions
             try
             {
                 juce::FileInputStream stream(file);
-                if (stream.failedToOpen())
-                {
-                    return false;
-                }
+                readable = !stream.failedToOpen();
             }
             catch (...)
             {
-                return false;
+                readable = false;
             }
         }
 
-        return result;
+        storeMetadata(key, result ? EntryKind::File : EntryKind::NotFile, readable);
+
+        return result && readable;
     }
     catch (...)
     {
@@ -132,7 +523,19 @@ bool FileSystem::directoryExists(const juce::String &path)
     }
 
     juce::File file(path);
+    const juce::String key = file.getFullPathName();
+
+    MetadataEntry cached;
+    if (lookupMetadata(key, true, cached))
+    {
+        const juce::ScopedLock lock(metadataLock);
+        ++metadataStats.syscallsSaved;
+        return cached.kind == EntryKind::Directory;
+    }
+
     bool result = file.isDirectory();
+    storeMetadata(key, result ? EntryKind::Directory : EntryKind::NotDirectory);
+
     return result;
 }
 
@@ -156,9 +559,47 @@ juce::StringArray FileSystem::getDirectories(const juce::String &directory)
     return result;
 }
 
+juce::Array<DirectoryEntry> FileSystem::listDirectory(const juce::String &directory)
+{
+    juce::Array<DirectoryEntry> result;
+    if (directory.isEmpty())
+    {
+        return result;
+    }
+
+    try
+    {
+        // The iterator gathers size, time and type while it reads each entry,
+        // so no per-file juce::File queries are needed afterwards
+        for (const auto &item : juce::RangedDirectoryIterator(juce::File(directory), false, "*",
+                                                              juce::File::findFilesAndDirectories))
+        {
+            DirectoryEntry entry;
+            entry.name = item.getFile().getFileName();
+            entry.isDirectory = item.isDirectory();
+            entry.size = entry.isDirectory ? 0 : item.getFileSize();
+            entry.modificationTime = item.getModificationTime();
+            result.add(entry);
+        }
+    }
+    catch (...)
+    {
+        return {};
+    }
+
+    return result;
+}
+
 juce::int64 FileSystem::getFileSize(const juce::String &path)
 {
     juce::File file(path);
+
+    const juce::int64 pendingSize = getPendingWriteSize(file.getFullPathName());
+    if (pendingSize >= 0)
+    {
+        return pendingSize;
+    }
+
     if (file.existsAsFile())
     {
         return file.getSize();
@@ -179,20 +620,53 @@ juce::Time FileSystem::getFileTime(const juce::String &path)
 bool FileSystem::deleteFile(const juce::String &path)
 {
     juce::File file(path);
-    return file.deleteFile();
+
+    // Deleting wins over any write still queued for the file
+    const juce::ScopedLock writeGuard(writeLock);
+    cancelPendingWrites(file.getFullPathName());
+
+    bool result = file.deleteFile();
+
+    const juce::String key = file.getFullPathName();
+    invalidateMetadata(key);
+    if (result)
+        storeMetadata(key, EntryKind::Missing);
+
+    return result;
 }
 
 bool FileSystem::deleteDirectory(const juce::String &path)
 {
     juce::File dir(path);
-    return dir.deleteRecursively();
+
+    const juce::ScopedLock writeGuard(writeLock);
+    cancelPendingWrites(dir.getFullPathName());
+
+    bool result = dir.deleteRecursively();
+
+    const juce::String key = dir.getFullPathName();
+    invalidateMetadata(key);
+    if (result)
+        storeMetadata(key, EntryKind::Missing);
+
+    return result;
 }
 
 bool FileSystem::moveFile(const juce::String &sourcePath, const juce::String &destPath)
 {
     juce::File source(sourcePath);
     juce::File dest(destPath);
-    return source.moveFileTo(dest);
+
+    // Moves operate on what is on disk, so land queued writes first
+    flushPendingWrites();
+
+    const juce::ScopedLock writeGuard(writeLock);
+    bool result = source.moveFileTo(dest);
+
+    invalidateMetadata(source.getFullPathName());
+    invalidateMetadata(dest.getFullPathName());
+
+    return result;
 }
 
 // Path utility functions
@@ -290,10 +764,12 @@ public:
     bool writeFile(const juce::String &, const juce::MemoryBlock &) override { return false; }
     juce::String readFile(const juce::String &) override { return {}; }
     juce::MemoryBlock readBinaryFile(const juce::String &) override { return {}; }
+    FileView mapFile(const juce::String &) override { return {}; }
     bool fileExists(const juce::String &) override { return false; }
     bool directoryExists(const juce::String &) override { return false; }
     juce::StringArray getFiles(const juce::String &) override { return {}; }
     juce::StringArray getDirectories(const juce::String &) override { return {}; }
+    juce::Array<DirectoryEntry> listDirectory(const juce::String &) override { return {}; }
     juce::int64 getFileSize(const juce::String &) override { return -1; }
     juce::Time getFileTime(const juce::String &) override { return juce::Time(0); }
     bool deleteFile(const juce::String &) override { return false; }
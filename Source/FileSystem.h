@@ -2,25 +2,94 @@
 #pragma once
 
 #include "IFileSystem.h"
+#include <map>
+#include <memory>
+#include <unordered_map>
 
 /**
  * @brief Real implementation of IFileSystem that performs file operations using JUCE.
  *
  * This class provides the production implementation of file system operations,
  * using JUCE's File class for all file I/O operations.
+ *
+ * An optional metadata cache remembers the results of fileExists() and
+ * directoryExists() (including negative results) for a short TTL. Entries are
+ * updated or invalidated by writes made through this object, so only changes
+ * made by other processes can be observed late, and never for longer than the TTL.
+ *
+ * Asynchronous writes are coalesced per path and written by a background thread
+ * using JUCE's temporary-file-and-rename replace, so a crash never leaves a
+ * half-written file behind.
  */
 class FileSystem : public IFileSystem
 {
 public:
+    /**
+     * @brief Default TTL for cached existence checks, in milliseconds.
+     */
+    static constexpr int DEFAULT_METADATA_CACHE_TTL_MS = 2000;
+
+    /**
+     * @brief Counters describing how effective the metadata cache has been.
+     */
+    struct MetadataCacheStats
+    {
+        juce::int64 hits = 0;          ///< Existence checks answered from the cache
+        juce::int64 misses = 0;        ///< Existence checks that went to the OS
+        juce::int64 syscallsSaved = 0; ///< Stat/open calls avoided by cache hits
+    };
+
+    /**
+     * @brief Constructs a file system with the metadata cache disabled.
+     */
+    FileSystem();
+
+    /**
+     * @brief Constructs a file system with an optional metadata cache.
+     *
+     * @param metadataCacheTtlMs How long cached existence checks stay valid; 0 disables the cache
+     */
+    explicit FileSystem(int metadataCacheTtlMs);
+
+    /**
+     * @brief Destructor. Flushes queued writes and stops the writer thread.
+     */
+    ~FileSystem() override;
+
+    /**
+     * @brief Changes the metadata cache TTL, clearing any cached entries.
+     *
+     * @param newTtlMs The new TTL in milliseconds; 0 disables the cache
+     */
+    void setMetadataCacheTtl(int newTtlMs);
+
+    /**
+     * @brief Drops every cached metadata entry.
+     */
+    void clearMetadataCache();
+
+    /**
+     * @brief Gets the metadata cache counters.
+     *
+     * @return A snapshot of the hit, miss and syscall counters
+     */
+    MetadataCacheStats getMetadataCacheStats() const;
+
     bool createDirectory(const juce::String &path) override;
     bool writeFile(const juce::String &path, const juce::String &content) override;
     bool writeFile(const juce::String &path, const juce::MemoryBlock &data) override;
+    bool writeFileAsync(const juce::String &path, const juce::String &content) override;
+    bool writeFileAsync(const juce::String &path, const juce::MemoryBlock &data) override;
+    bool flushPendingWrites() override;
+    void invalidateCachedMetadata(const juce::String &path) override;
     juce::String readFile(const juce::String &path) override;
     juce::MemoryBlock readBinaryFile(const juce::String &path) override;
+    FileView mapFile(const juce::String &path) override;
     bool fileExists(const juce::String &path) override;
     bool directoryExists(const juce::String &path) override;
     juce::StringArray getFiles(const juce::String &directory) override;
     juce::StringArray getDirectories(const juce::String &directory) override;
+    juce::Array<DirectoryEntry> listDirectory(const juce::String &directory) override;
     juce::int64 getFileSize(const juce::String &path) override;
     juce::Time getFileTime(const juce::String &path) override;
     bool deleteFile(const juce::String &path) override;
@@ -34,4 +103,147 @@ public:
     bool isAbsolutePath(const juce::String &path) override;
     juce::String normalizePath(const juce::String &path) override;
     juce::String getCacheRootDirectory() override;
+
+private:
+    class WriteQueueThread;
+
+    /**
+     * @brief A queued write waiting for the background thread.
+     */
+    struct PendingWrite
+    {
+        bool isText = false;                           ///< Whether the write came from the text overload
+        juce::String text;                             ///< Content for text writes
+        std::shared_ptr<const juce::MemoryBlock> data; ///< Content for binary writes, shared by copies of the entry
+        juce::uint64 generation = 0;                   ///< Increases with every write queued for any path
+
+        /**
+         * @brief Gets the size of the queued content in bytes.
+         */
+        juce::int64 getSize() const;
+
+        /**
+         * @brief Gets the queued content as raw bytes.
+         */
+        juce::MemoryBlock toMemoryBlock() const;
+    };
+
+    /**
+     * @brief Adds a write to the queue, replacing any write already queued for the path.
+     *
+     * @param key The normalized path
+     * @param write The write to queue
+     */
+    void enqueueWrite(const juce::String &key, PendingWrite write);
+
+    /**
+     * @brief Looks up a write still waiting in the queue, for reading its content.
+     *
+     * The entry shares the queued content rather than copying it.
+     *
+     * @param key The normalized path
+     * @param write Receives the queued write when found
+     * @return true if a write is queued for the path, false otherwise
+     */
+    bool getPendingWrite(const juce::String &key, PendingWrite &write) const;
+
+    /**
+     * @brief Gets the size of a write still waiting in the queue.
+     *
+     * Lets existence and size checks answer from the queue without touching
+     * its content.
+     *
+     * @param key The normalized path
+     * @return The size in bytes, or -1 if no write is queued for the path
+     */
+    juce::int64 getPendingWriteSize(const juce::String &key) const;
+
+    /**
+     * @brief Drops queued writes for a path and everything beneath it.
+     *
+     * @param key The normalized path
+     */
+    void cancelPendingWrites(const juce::String &key);
+
+    /**
+     * @brief Writes queued entries until the queue is empty.
+     *
+     * Called from the writer thread and from flushPendingWrites(). Paths
+     * whose write fails are recorded in failedWrites.
+     */
+    void processPendingWrites();
+
+    /**
+     * @brief Performs a write immediately and updates the metadata cache.
+     *
+     * @param file The file to replace
+     * @param write The content to write
+     * @return true if the file was written successfully, false otherwise
+     */
+    bool writeNow(const juce::File &file, const PendingWrite &write);
+
+    /**
+     * @brief What the metadata cache knows about a path.
+     */
+    enum class EntryKind
+    {
+        Missing,     ///< Nothing exists at the path
+        File,        ///< A regular file exists at the path
+        Directory,   ///< A directory exists at the path
+        NotFile,     ///< Known not to be a file; may still be a directory
+        NotDirectory ///< Known not to be a directory; may still be a file
+    };
+
+    struct MetadataEntry
+    {
+        EntryKind kind = EntryKind::Missing; ///< What exists at the path
+        bool readable = true;                ///< Whether a file could be opened (JPEG check)
+        juce::uint32 expiresAt = 0;          ///< Millisecond counter value after which the entry is stale
+    };
+
+    /**
+     * @brief Looks up a live entry that answers an existence check.
+     *
+     * @param key The normalized path
+     * @param forDirectory true for directoryExists(), false for fileExists()
+     * @param entry Receives the entry when found
+     * @return true if a live entry answers the check, false otherwise
+     */
+    bool lookupMetadata(const juce::String &key, bool forDirectory, MetadataEntry &entry);
+
+    /**
+     * @brief Records what is known about a path.
+     *
+     * @param key The normalized path
+     * @param kind What exists at the path
+     * @param readable Whether the file could be opened
+     */
+    void storeMetadata(const juce::String &key, EntryKind kind, bool readable = true);
+
+    /**
+     * @brief Forgets a path, everything beneath it and any ancestors.
+     *
+     * @param key The normalized path
+     */
+    void invalidateMetadata(const juce::String &key);
+
+    /**
+     * @brief Builds the cache key for a path.
+     *
+     * @param path The path to normalize
+     * @return The absolute path used as the cache key
+     */
+    static juce::String getMetadataKey(const juce::String &path);
+
+    int metadataCacheTtlMs = 0;                                  ///< TTL for cached entries; 0 disables the cache
+    mutable juce::CriticalSection metadataLock;                  ///< Guards the metadata cache
+    std::unordered_map<juce::String, MetadataEntry> metadataCache; ///< Normalized path -> cached metadata
+    MetadataCacheStats metadataStats;                            ///< Hit/miss counters
+
+    juce::CriticalSection writeLock;                     ///< Serializes writes to disk so queued and direct writes cannot interleave
+    mutable juce::CriticalSection pendingLock;           ///< Guards the pending write queue
+    std::map<juce::String, PendingWrite> pendingWrites;  ///< Normalized path -> last queued write
+    juce::uint64 nextGeneration = 0;                     ///< Generation handed to the next queued write
+    juce::StringArray failedWrites;                      ///< Paths whose queued write failed since the last flush
+    std::unique_ptr<WriteQueueThread> writeQueueThread;  ///< Background writer, started on first async write
 };
\ No newline at end of file
@@ -0,0 +1,369 @@
+/**
+ * @file GearCatalogue.cpp
+ * @brief Implementation of the GearCatalogue class.
+ *
+ * This file implements adding units to the catalogue, sharing their
+ * repeated strings, keeping the unit ID, category, search and facet indices
+ * in step with them, creating full gear items on demand and reporting the
+ * memory its records hold.
+ */
+
+#include "GearCatalogue.h"
+
+const juce::String &GearCatalogue::TagList::operator[](int index) const
+{
+    jassert(juce::isPositiveAndBelow(index, size()));
+    return catalogue->sharedStrings[catalogue->tagIds[firstTag + index]];
+}
+
+bool GearCatalogue::TagList::contains(const juce::String &tag) const
+{
+    for (const auto &existing : *this)
+        if (existing == tag)
+            return true;
+
+    return false;
+}
+
+juce::StringArray GearCatalogue::TagList::toStringArray() const
+{
+    juce::StringArray result;
+    result.ensureStorageAllocated(size());
+
+    for (const auto &tag : *this)
+        result.add(tag);
+
+    return result;
+}
+
+GearCatalogue::GearCatalogue()
+    : searchIndex(std::make_shared<GearSearchIndex>(SEARCH_KEY_SEPARATOR))
+{
+    tagStarts.add(0);
+}
+
+void GearCatalogue::clear()
+{
+    unitIds.clear();
+    names.clear();
+    schemaPaths.clear();
+    thumbnailPaths.clear();
+    manufacturerIds.clear();
+    categoryIds.clear();
+    versionIds.clear();
+    tagStarts.clear();
+    tagStarts.add(0);
+    types.clear();
+    categories.clear();
+    slotSizes.clear();
+
+    tagIds.clear();
+    sharedStrings.clear();
+    sharedStringIds.clear();
+    schemalessControls.clear();
+
+    unitIdIndex.clear();
+    categoryIndex.clear();
+    searchIndex = std::make_shared<GearSearchIndex>(SEARCH_KEY_SEPARATOR);
+    facetIndex.clear();
+}
+
+void GearCatalogue::reserve(int numEntries)
+{
+    unitIds.ensureStorageAllocated(numEntries);
+    names.ensureStorageAllocated(numEntries);
+    schemaPaths.ensureStorageAllocated(numEntries);
+    thumbnailPaths.ensureStorageAllocated(numEntries);
+    manufacturerIds.ensureStorageAllocated(numEntries);
+    categoryIds.ensureStorageAllocated(numEntries);
+    versionIds.ensureStorageAllocated(numEntries);
+    tagStarts.ensureStorageAllocated(numEntries + 1);
+    types.ensureStorageAllocated(numEntries);
+    categories.ensureStorageAllocated(numEntries);
+    slotSizes.ensureStorageAllocated(numEntries);
+
+    if (searchIndex.use_count() == 1)
+        searchIndex->reserve(numEntries);
+}
+
+int GearCatalogue::add(const GearCatalogueRecord &record, GearType type)
+{
+    const int index = size();
+
+    // The first entry with a given unit ID wins, as with a scan in catalogue order
+    if (!unitIdIndex.contains(record.unitId))
+        unitIdIndex.set(record.unitId, index);
+
+    unitIds.add(record.unitId);
+    names.add(record.name);
+    schemaPaths.add(record.schemaPath);
+    thumbnailPaths.add(record.thumbnailImage);
+    manufacturerIds.add(share(record.manufacturer));
+    categoryIds.add(share(record.category));
+    versionIds.add(share(record.version));
+
+    for (const auto &tag : record.tags)
+        tagIds.add(share(tag));
+    tagStarts.add(tagIds.size());
+
+    types.add(GearItem::getTypeFromTags(record.tags, type));
+    categories.add(GearItem::getCategoryFromString(record.category));
+    slotSizes.add(record.slotSize);
+
+    auto entry = getEntry(index);
+    auto categoryName = getCategoryName(entry);
+    categoryIndex.addEntry(index, categoryName, names);
+
+    // Searches still running on the worker keep their own copy
+    if (searchIndex.use_count() > 1)
+        searchIndex = std::make_shared<GearSearchIndex>(*searchIndex);
+
+    searchIndex->addEntry(buildSearchKey(entry));
+
+    auto facetEntry = facetIndex.addEntry();
+    facetIndex.addValue(facetEntry, GearFacetIndex::Facet::Manufacturer, entry.manufacturer);
+    facetIndex.addValue(facetEntry, GearFacetIndex::Facet::Category, categoryName);
+    facetIndex.addValue(facetEntry, GearFacetIndex::Facet::Type, getTypeName(entry.type));
+    facetIndex.addValue(facetEntry, GearFacetIndex::Facet::SlotSize, juce::String(entry.slotSize));
+    for (const auto &tag : entry.tags)
+        facetIndex.addValue(facetEntry, GearFacetIndex::Facet::Tag, tag);
+
+    return index;
+}
+
+GearCatalogue::Entry GearCatalogue::getEntry(int index) const
+{
+    jassert(juce::isPositiveAndBelow(index, size()));
+
+    return {index,
+            unitIds[index],
+            names[index],
+            sharedStrings[manufacturerIds[index]],
+            sharedStrings[categoryIds[index]],
+            sharedStrings[versionIds[index]],
+            schemaPaths[index],
+            thumbnailPaths[index],
+            TagList(*this, tagStarts[index], tagStarts[index + 1]),
+            types[index],
+            categories[index],
+            slotSizes[index]};
+}
+
+std::unique_ptr<GearItem> GearCatalogue::createItem(int index, INetworkFetcher &networkFetcher, IFileSystem &fileSystem,
+                                                    CacheManager &cacheManager) const
+{
+    if (!juce::isPositiveAndBelow(index, size()))
+        return nullptr;
+
+    auto entry = getEntry(index);
+    auto controls = schemalessControls.contains(index) ? schemalessControls[index] : juce::Array<GearControl>();
+
+    return std::make_unique<GearItem>(entry.unitId, entry.name, entry.manufacturer, entry.categoryString, entry.version,
+                                      entry.schemaPath, entry.thumbnailImage, entry.tags.toStringArray(), networkFetcher,
+                                      fileSystem, cacheManager, entry.type, entry.category, entry.slotSize, std::move(controls));
+}
+
+void GearCatalogue::setControls(int index, const juce::Array<GearControl> &controls)
+{
+    if (juce::isPositiveAndBelow(index, size()))
+        schemalessControls.set(index, controls);
+}
+
+int GearCatalogue::getIndexOfUnitId(const juce::String &unitId) const
+{
+    return unitIdIndex.contains(unitId) ? unitIdIndex[unitId] : -1;
+}
+
+GearCatalogue::Changes GearCatalogue::getChangesSince(const GearCatalogue &previous) const
+{
+    Changes changes;
+    changes.previousIndices.ensureStorageAllocated(size());
+
+    juce::Array<bool> matched;
+    matched.insertMultiple(0, false, previous.size());
+
+    for (int i = 0; i < size(); ++i)
+    {
+        auto previousIndex = previous.getIndexOfUnitId(unitIds[i]);
+
+        // A repeated unit ID can only be matched once
+        if (previousIndex >= 0 && matched[previousIndex])
+            previousIndex = -1;
+
+        changes.previousIndices.add(previousIndex);
+
+        if (previousIndex < 0)
+        {
+            changes.added.add(i);
+            continue;
+        }
+
+        matched.set(previousIndex, true);
+        changes.moved = changes.moved || previousIndex != i;
+
+        if (!entriesMatch(getEntry(i), previous.getEntry(previousIndex)))
+            changes.changed.add(i);
+    }
+
+    for (int i = 0; i < previous.size(); ++i)
+        if (!matched[i])
+            changes.removed.add(i);
+
+    return changes;
+}
+
+juce::int64 GearCatalogue::getRecordBytes() const
+{
+    juce::int64 bytes = 0;
+
+    for (const auto *strings : {&unitIds, &names, &schemaPaths, &thumbnailPaths, &sharedStrings})
+        for (const auto &text : *strings)
+            bytes += MemoryUsage::getStringBytes(text);
+
+    const int numInts = manufacturerIds.size() + categoryIds.size() + versionIds.size() + tagStarts.size()
+                        + slotSizes.size() + tagIds.size();
+    bytes += (juce::int64)numInts * (juce::int64)sizeof(int);
+    bytes += (juce::int64)types.size() * (juce::int64)sizeof(GearType);
+    bytes += (juce::int64)categories.size() * (juce::int64)sizeof(GearCategory);
+
+    for (auto it = schemalessControls.begin(); it != schemalessControls.end(); ++it)
+        for (const auto &control : it.getValue())
+            bytes += control.getRecordBytes();
+
+    return bytes;
+}
+
+void GearCatalogue::swapWith(GearCatalogue &other) noexcept
+{
+    unitIds.swapWith(other.unitIds);
+    names.swapWith(other.names);
+    schemaPaths.swapWith(other.schemaPaths);
+    thumbnailPaths.swapWith(other.thumbnailPaths);
+    manufacturerIds.swapWith(other.manufacturerIds);
+    categoryIds.swapWith(other.categoryIds);
+    versionIds.swapWith(other.versionIds);
+    tagStarts.swapWith(other.tagStarts);
+    types.swapWith(other.types);
+    categories.swapWith(other.categories);
+    slotSizes.swapWith(other.slotSizes);
+
+    tagIds.swapWith(other.tagIds);
+    sharedStrings.swapWith(other.sharedStrings);
+    sharedStringIds.swapWith(other.sharedStringIds);
+    schemalessControls.swapWith(other.schemalessControls);
+
+    unitIdIndex.swapWith(other.unitIdIndex);
+    categoryIndex.swapWith(other.categoryIndex);
+    std::swap(searchIndex, other.searchIndex);
+    facetIndex.swapWith(other.facetIndex);
+}
+
+int GearCatalogue::share(const juce::String &text)
+{
+    if (sharedStringIds.contains(text))
+        return sharedStringIds[text];
+
+    const int id = sharedStrings.size();
+    sharedStrings.add(text);
+    sharedStringIds.set(text, id);
+    return id;
+}
+
+bool GearCatalogue::entriesMatch(const Entry &a, const Entry &b)
+{
+    if (a.version != b.version || a.name != b.name || a.manufacturer != b.manufacturer || a.categoryString != b.categoryString ||
+        a.schemaPath != b.schemaPath || a.thumbnailImage != b.thumbnailImage || a.type != b.type || a.slotSize != b.slotSize ||
+        a.tags.size() != b.tags.size())
+        return false;
+
+    for (int t = 0; t < a.tags.size(); ++t)
+        if (a.tags[t] != b.tags[t])
+            return false;
+
+    return true;
+}
+
+juce::Array<juce::juce_wchar> GearCatalogue::getIgnoredCharacters()
+{
+    return {
+        '-',  // Hyphens (e.g., "LA-2A" matches "la2a")
+        ' ',  // Spaces (e.g., "Tube Compressor" matches "tubecompressor")
+        '_',  // Underscores
+        '.',  // Dots
+        '(',  // Parentheses
+        ')',  // Parentheses
+        '[',  // Brackets
+        ']',  // Brackets
+        '/',  // Forward slashes
+        '\\', // Backward slashes
+        '&',  // Ampersands
+        '+',  // Plus signs
+        '=',  // Equals signs
+        '#'   // Hash symbols
+    };
+}
+
+juce::String GearCatalogue::normalizeForSearch(const juce::String &text)
+{
+    // Build the string of characters to remove once
+    static const juce::String charsToRemove = []
+    {
+        juce::String chars;
+        for (auto ignoredChar : getIgnoredCharacters())
+            chars += ignoredChar;
+        return chars;
+    }();
+
+    // Remove all ignored characters at once
+    return text.toLowerCase().removeCharacters(charsToRemove);
+}
+
+juce::String GearCatalogue::buildSearchKey(const Entry &entry)
+{
+    juce::String key;
+    key << normalizeForSearch(entry.name) << SEARCH_KEY_SEPARATOR
+        << normalizeForSearch(entry.manufacturer) << SEARCH_KEY_SEPARATOR
+        << normalizeForSearch(entry.categoryString);
+
+    for (const auto &tag : entry.tags)
+        key << SEARCH_KEY_SEPARATOR << normalizeForSearch(tag);
+
+    return key;
+}
+
+juce::String GearCatalogue::getCategoryName(const Entry &entry)
+{
+    if (entry.categoryString.isNotEmpty())
+        return entry.categoryString;
+
+    switch (entry.category)
+    {
+    case GearCategory::EQ:
+        return "equalizer";
+    case GearCategory::Compressor:
+        return "compressor";
+    case GearCategory::Preamp:
+        return "preamp";
+    case GearCategory::Other:
+        break;
+    }
+
+    return "other";
+}
+
+juce::String GearCatalogue::getTypeName(GearType type)
+{
+    switch (type)
+    {
+    case GearType::Series500:
+        return "500Series";
+    case GearType::Rack19Inch:
+        return "Rack19Inch";
+    case GearType::UserCreated:
+        return "UserCreated";
+    case GearType::Other:
+        break;
+    }
+
+    return "Other";
+}
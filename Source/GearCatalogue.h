@@ -0,0 +1,373 @@
+/**
+ * @file GearCatalogue.h
+ * @brief Header file for the GearCatalogue class.
+ *
+ * This file defines the GearCatalogue class, which holds the metadata of the
+ * units in the library together with the indices built over them: unit ID
+ * lookup, the category groups, the trigram search index and the facet bitsets.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearItem.h"
+#include "GearCatalogueParser.h"
+#include "GearCategoryIndex.h"
+#include "GearFacetIndex.h"
+#include "GearSearchIndex.h"
+#include <memory>
+
+/**
+ * @brief The units of the library and the indices over them.
+ *
+ * Only the metadata the library shows, searches and filters by is kept, in
+ * one array per field. Manufacturers, categories, versions and tags repeat
+ * across many units, so each distinct value is stored once and entries refer
+ * to it by number. A full GearItem, with its images, controls and services,
+ * is only created by createItem() when a unit is placed in the rack.
+ *
+ * Every index is kept parallel to the entries: entry i is entry i of the
+ * search and facet indices. A catalogue does not touch the UI, so a
+ * complete one can be built on a worker thread and then swapped into the
+ * library on the message thread in one step.
+ */
+class GearCatalogue
+{
+public:
+    /**
+     * @brief Separates fields within a search key; normalised queries never contain it.
+     */
+    static constexpr juce::juce_wchar SEARCH_KEY_SEPARATOR = '\n';
+
+    /**
+     * @brief Iterates over a container that is indexed with operator[].
+     */
+    template <typename Container>
+    class IndexedIterator
+    {
+    public:
+        IndexedIterator(const Container &container, int index) : container(&container), index(index) {}
+
+        decltype(auto) operator*() const { return (*container)[index]; }
+
+        IndexedIterator &operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        bool operator==(const IndexedIterator &other) const { return index == other.index && container == other.container; }
+        bool operator!=(const IndexedIterator &other) const { return !(*this == other); }
+
+    private:
+        const Container *container;
+        int index;
+    };
+
+    /**
+     * @brief The tags of one entry, read from the catalogue's shared strings.
+     */
+    class TagList
+    {
+    public:
+        TagList(const GearCatalogue &catalogue, int firstTag, int endTag) : catalogue(&catalogue), firstTag(firstTag), endTag(endTag) {}
+
+        int size() const { return endTag - firstTag; }
+        bool isEmpty() const { return firstTag == endTag; }
+
+        /**
+         * @brief Gets a tag, which must be in range.
+         */
+        const juce::String &operator[](int index) const;
+
+        /**
+         * @brief Checks whether the entry has a tag.
+         */
+        bool contains(const juce::String &tag) const;
+
+        /**
+         * @brief Copies the tags into a StringArray.
+         */
+        juce::StringArray toStringArray() const;
+
+        IndexedIterator<TagList> begin() const { return {*this, 0}; }
+        IndexedIterator<TagList> end() const { return {*this, size()}; }
+
+    private:
+        const GearCatalogue *catalogue;
+        int firstTag; ///< Position of the first tag in the catalogue's tag list
+        int endTag;   ///< One past the position of the last tag
+    };
+
+    /**
+     * @brief Read-only view of one entry.
+     *
+     * The fields have the names of the matching GearItem fields. The view
+     * refers into the catalogue and is only valid until it is next changed.
+     */
+    struct Entry
+    {
+        int index;                          ///< Index of the entry in the catalogue
+        const juce::String &unitId;         ///< Unique identifier of the unit
+        const juce::String &name;           ///< Display name
+        const juce::String &manufacturer;   ///< Manufacturer name
+        const juce::String &categoryString; ///< Category string
+        const juce::String &version;        ///< Schema version
+        const juce::String &schemaPath;     ///< Path or URL of the unit schema
+        const juce::String &thumbnailImage; ///< Path or URL of the thumbnail
+        TagList tags;                       ///< Tags
+        GearType type;                      ///< Type, as GearItem derives it
+        GearCategory category;              ///< Category, as GearItem derives it
+        int slotSize;                       ///< Number of rack slots
+    };
+
+    /**
+     * @brief How a catalogue differs from an earlier one, matched by unit ID.
+     */
+    struct Changes
+    {
+        juce::Array<int> previousIndices; ///< For each entry, the index of its unit in the earlier catalogue, or -1 if it is new
+        juce::Array<int> added;           ///< Entries whose unit is new
+        juce::Array<int> changed;         ///< Entries whose unit has a different version or fields
+        juce::Array<int> removed;         ///< Indices in the earlier catalogue of units that are gone
+        bool moved = false;               ///< Whether any kept unit is at a different index
+
+        /**
+         * @brief Checks whether the catalogues hold the same units in the same order.
+         */
+        bool isEmpty() const { return added.isEmpty() && changed.isEmpty() && removed.isEmpty() && !moved; }
+    };
+
+    /**
+     * @brief Constructs an empty catalogue.
+     */
+    GearCatalogue();
+
+    /**
+     * @brief Removes every entry.
+     */
+    void clear();
+
+    /**
+     * @brief Reserves space for a number of entries.
+     *
+     * @param numEntries The expected number of entries
+     */
+    void reserve(int numEntries);
+
+    /**
+     * @brief Appends a unit and indexes it.
+     *
+     * The first entry with a given unit ID is the one found by getIndexOfUnitId().
+     *
+     * @param record The unit's fields, with resource paths already resolved
+     * @param type The type to use if none of the tags names one
+     * @return The index of the new entry
+     */
+    int add(const GearCatalogueRecord &record, GearType type = GearType::Other);
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @return The number of entries
+     */
+    int size() const { return unitIds.size(); }
+
+    /**
+     * @brief Checks whether the catalogue is empty.
+     *
+     * @return true if there are no entries
+     */
+    bool isEmpty() const { return unitIds.isEmpty(); }
+
+    /**
+     * @brief Gets an entry, which must be in range.
+     *
+     * @param index The index of the entry
+     * @return A view of the entry
+     */
+    Entry getEntry(int index) const;
+
+    /**
+     * @brief Gets an entry, which must be in range.
+     *
+     * @param index The index of the entry
+     * @return A view of the entry
+     */
+    Entry operator[](int index) const { return getEntry(index); }
+
+    IndexedIterator<GearCatalogue> begin() const { return {*this, 0}; }
+    IndexedIterator<GearCatalogue> end() const { return {*this, size()}; }
+
+    /**
+     * @brief Creates a full gear item for an entry.
+     *
+     * @param index The index of the entry
+     * @param networkFetcher The network fetcher the item loads resources with
+     * @param fileSystem The file system the item uses
+     * @param cacheManager The cache manager the item uses
+     * @return The new item, or nullptr if the index is out of range
+     */
+    std::unique_ptr<GearItem> createItem(int index, INetworkFetcher &networkFetcher, IFileSystem &fileSystem,
+                                         CacheManager &cacheManager) const;
+
+    /**
+     * @brief Sets the controls given to items created for an entry.
+     *
+     * Units from the index get their controls from their schema once placed;
+     * this is for units that have no schema, such as user-created gear.
+     *
+     * @param index The index of the entry
+     * @param controls The controls
+     */
+    void setControls(int index, const juce::Array<GearControl> &controls);
+
+    /**
+     * @brief Gets the index of an entry by unit ID.
+     *
+     * @param unitId The unit ID to look up
+     * @return The index of the first entry with that unit ID, or -1 if not found
+     */
+    int getIndexOfUnitId(const juce::String &unitId) const;
+
+    /**
+     * @brief Compares the catalogue with an earlier one.
+     *
+     * Units are matched by unit ID; a matched unit has changed if its version
+     * or any field shown, searched or filtered by differs.
+     *
+     * @param previous The earlier catalogue
+     * @return The units added, changed and removed since then
+     */
+    Changes getChangesSince(const GearCatalogue &previous) const;
+
+    /**
+     * @brief Gets the search index over the entries.
+     *
+     * The returned index is never modified; adding an entry after sharing it
+     * copies the index first, so searches on another thread stay valid.
+     *
+     * @return The trigram index of the search keys
+     */
+    std::shared_ptr<const GearSearchIndex> getSearchIndex() const { return searchIndex; }
+
+    /**
+     * @brief Gets the facet index over the entries.
+     *
+     * @return The facet value bitsets
+     */
+    const GearFacetIndex &getFacetIndex() const { return facetIndex; }
+
+    /**
+     * @brief Gets the entries grouped by category.
+     *
+     * @return The category groups, kept up to date as entries are added
+     */
+    const GearCategoryIndex &getCategoryIndex() const { return categoryIndex; }
+
+    /**
+     * @brief Gets the number of distinct manufacturer, category, version and tag strings.
+     *
+     * @return The number of shared strings
+     */
+    int getNumSharedStrings() const { return sharedStrings.size(); }
+
+    /**
+     * @brief Gets the bytes held by the entries' fields.
+     *
+     * Counts the per-entry strings and numbers, the shared strings and the
+     * controls of entries without a schema; the lookup, search and facet
+     * indices are not included.
+     *
+     * @return The bytes of the records
+     */
+    juce::int64 getRecordBytes() const;
+
+    /**
+     * @brief Swaps the contents of two catalogues.
+     *
+     * @param other The catalogue to swap with
+     */
+    void swapWith(GearCatalogue &other) noexcept;
+
+    /**
+     * @brief Normalizes text for search by lowercasing and removing ignored characters.
+     *
+     * @param text The text to normalize
+     * @return The normalized text
+     */
+    static juce::String normalizeForSearch(const juce::String &text);
+
+    /**
+     * @brief Gets the list of characters to ignore during search.
+     *
+     * @return Array of characters that should be ignored during fuzzy matching
+     */
+    static juce::Array<juce::juce_wchar> getIgnoredCharacters();
+
+    /**
+     * @brief Builds the normalised search key for an entry.
+     *
+     * The key holds the normalised name, manufacturer, category and tags
+     * separated by SEARCH_KEY_SEPARATOR.
+     *
+     * @param entry The entry to build the key for
+     * @return The search key
+     */
+    static juce::String buildSearchKey(const Entry &entry);
+
+    /**
+     * @brief Gets the category an entry is grouped under.
+     *
+     * @param entry The entry
+     * @return The category string, or a name derived from the category enum if it is empty
+     */
+    static juce::String getCategoryName(const Entry &entry);
+
+    /**
+     * @brief Gets the facet value for a gear type.
+     *
+     * @param type The gear type
+     * @return The name used for the type when serialising items, e.g. "500Series"
+     */
+    static juce::String getTypeName(GearType type);
+
+private:
+    /**
+     * @brief Gets the number of a shared string, adding it if it is new.
+     *
+     * @param text The string
+     * @return Its index in sharedStrings
+     */
+    int share(const juce::String &text);
+
+    /**
+     * @brief Checks whether two entries, possibly of different catalogues, have the same fields.
+     */
+    static bool entriesMatch(const Entry &a, const Entry &b);
+
+    // One element per entry
+    juce::StringArray unitIds;            ///< Unit IDs
+    juce::StringArray names;              ///< Display names
+    juce::StringArray schemaPaths;        ///< Schema paths
+    juce::StringArray thumbnailPaths;     ///< Thumbnail paths
+    juce::Array<int> manufacturerIds;     ///< Manufacturers, as indices into sharedStrings
+    juce::Array<int> categoryIds;         ///< Category strings, as indices into sharedStrings
+    juce::Array<int> versionIds;          ///< Versions, as indices into sharedStrings
+    juce::Array<int> tagStarts;           ///< Position of each entry's first tag in tagIds, plus one past the last
+    juce::Array<GearType> types;          ///< Types
+    juce::Array<GearCategory> categories; ///< Category enums
+    juce::Array<int> slotSizes;           ///< Slot sizes
+
+    juce::Array<int> tagIds;                                         ///< Tags of every entry in order, as indices into sharedStrings
+    juce::StringArray sharedStrings;                                 ///< Each distinct manufacturer, category, version and tag
+    juce::HashMap<juce::String, int> sharedStringIds;                ///< Index of each string in sharedStrings
+    juce::HashMap<int, juce::Array<GearControl>> schemalessControls; ///< Controls of entries that have no schema
+
+    juce::HashMap<juce::String, int> unitIdIndex; ///< Index of the first entry with each unit ID
+    GearCategoryIndex categoryIndex;              ///< Entries grouped by category
+    std::shared_ptr<GearSearchIndex> searchIndex; ///< Trigram index over the search keys
+    GearFacetIndex facetIndex;                    ///< Facet value bitsets
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearCatalogue)
+};
@@ -0,0 +1,149 @@
+/**
+ * @file GearCatalogueLoader.cpp
+ * @brief Implementation of the GearCatalogueLoader class.
+ *
+ * This file implements running catalogue builds on background threads and
+ * delivering the latest one's result to the message thread.
+ */
+
+#include "GearCatalogueLoader.h"
+
+/**
+ * @brief Runs one build and hands its result back to the loader.
+ */
+class GearCatalogueLoader::BuildJob : public juce::ThreadPoolJob
+{
+public:
+    BuildJob(GearCatalogueLoader &owner, BuildFunction build, juce::uint64 buildGeneration)
+        : juce::ThreadPoolJob("AnalogIQ Catalogue Build"),
+          owner(owner), build(std::move(build)), buildGeneration(buildGeneration)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        // Superseded builds give up as soon as they notice
+        auto catalogue = build([this]
+                               { return shouldExit() || owner.generation.load() != buildGeneration; });
+
+        owner.storeResult(buildGeneration, std::move(catalogue));
+        return jobHasFinished;
+    }
+
+private:
+    GearCatalogueLoader &owner;
+    BuildFunction build;
+    juce::uint64 buildGeneration;
+};
+
+GearCatalogueLoader::GearCatalogueLoader()
+    : builders(juce::ThreadPoolOptions{}
+                   .withThreadName("AnalogIQ Catalogue Loader")
+                   .withNumberOfThreads(2))
+{
+    // Nothing is loading yet, so waits return at once
+    builtEvent.signal();
+}
+
+GearCatalogueLoader::~GearCatalogueLoader()
+{
+    cancel();
+
+    // Builds refer to this loader and to whatever their function captured
+    builders.removeAllJobs(true, -1);
+}
+
+void GearCatalogueLoader::load(BuildFunction build)
+{
+    const juce::uint64 buildGeneration = ++generation;
+    abandonBuilds();
+
+    {
+        const juce::ScopedLock sl(lock);
+        builtResult.reset();
+        hasBuiltResult = false;
+    }
+
+    builtEvent.reset();
+    cancelPendingUpdate();
+    loading = true;
+    builders.addJob(new BuildJob(*this, std::move(build), buildGeneration), true);
+}
+
+void GearCatalogueLoader::cancel()
+{
+    ++generation;
+    abandonBuilds();
+    cancelPendingUpdate();
+
+    {
+        const juce::ScopedLock sl(lock);
+        builtResult.reset();
+        hasBuiltResult = false;
+    }
+
+    loading = false;
+    builtEvent.signal();
+}
+
+bool GearCatalogueLoader::isLoading() const
+{
+    return loading.load();
+}
+
+bool GearCatalogueLoader::waitUntilBuilt(int timeoutMs)
+{
+    return builtEvent.wait((double)timeoutMs);
+}
+
+void GearCatalogueLoader::deliverPendingResult()
+{
+    handleUpdateNowIfNeeded();
+}
+
+int GearCatalogueLoader::getNumRunningBuilds() const
+{
+    return builders.getNumJobs();
+}
+
+void GearCatalogueLoader::abandonBuilds()
+{
+    // Tell running builds to stop, but leave them to finish on their own threads
+    builders.removeAllJobs(true, 0);
+}
+
+void GearCatalogueLoader::storeResult(juce::uint64 buildGeneration, std::unique_ptr<GearCatalogue> catalogue)
+{
+    {
+        const juce::ScopedLock sl(lock);
+
+        // Abandoned builds are never delivered
+        if (buildGeneration != generation.load())
+            return;
+
+        builtResult = std::move(catalogue);
+        hasBuiltResult = true;
+    }
+
+    builtEvent.signal();
+    triggerAsyncUpdate();
+}
+
+void GearCatalogueLoader::handleAsyncUpdate()
+{
+    std::unique_ptr<GearCatalogue> catalogue;
+
+    {
+        const juce::ScopedLock sl(lock);
+
+        if (!hasBuiltResult)
+            return;
+
+        catalogue = std::move(builtResult);
+        hasBuiltResult = false;
+        loading = false;
+    }
+
+    if (onLoaded)
+        onLoaded(std::move(catalogue));
+}
@@ -0,0 +1,129 @@
+/**
+ * @file GearCatalogueLoader.h
+ * @brief Header file for the GearCatalogueLoader class.
+ *
+ * This file defines the GearCatalogueLoader class, which fetches and parses
+ * the library index on a background thread and hands the finished catalogue
+ * to the message thread in one piece.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearCatalogue.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Builds a GearCatalogue on a background thread.
+ *
+ * The build function runs on one of the loader's threads and must not touch
+ * the UI. Its result, or nullptr if it failed, is delivered to onLoaded on
+ * the message thread, so the library only ever sees a complete catalogue.
+ *
+ * A new load abandons the one in progress without waiting for it: the old
+ * build is told to stop through its AbortCheck and keeps running until it
+ * notices, and its result is dropped by generation. Neither load() nor
+ * cancel() blocks, even while a build is stuck in a network fetch; only the
+ * destructor waits for builds to stop.
+ */
+class GearCatalogueLoader : private juce::AsyncUpdater
+{
+public:
+    /**
+     * @brief Polled by the build function; returning true means it should give up.
+     */
+    using AbortCheck = std::function<bool()>;
+
+    /**
+     * @brief Builds a catalogue, returning nullptr on failure or when aborted.
+     */
+    using BuildFunction = std::function<std::unique_ptr<GearCatalogue>(const AbortCheck &)>;
+
+    /**
+     * @brief Constructs an idle loader.
+     */
+    GearCatalogueLoader();
+
+    /**
+     * @brief Destructor. Abandons any load in progress and waits for running builds to stop.
+     */
+    ~GearCatalogueLoader() override;
+
+    /**
+     * @brief Called on the message thread with each finished catalogue, or nullptr if the build failed.
+     */
+    std::function<void(std::unique_ptr<GearCatalogue>)> onLoaded;
+
+    /**
+     * @brief Starts building a catalogue, abandoning any load in progress.
+     *
+     * @param build The function to run on the background thread
+     */
+    void load(BuildFunction build);
+
+    /**
+     * @brief Abandons any load in progress without delivering it.
+     */
+    void cancel();
+
+    /**
+     * @brief Checks whether a load is running or waiting to be delivered.
+     *
+     * @return true until onLoaded has been called for the latest load
+     */
+    bool isLoading() const;
+
+    /**
+     * @brief Waits until the latest build has finished.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if the build finished within the timeout, or nothing is loading
+     */
+    bool waitUntilBuilt(int timeoutMs);
+
+    /**
+     * @brief Delivers a finished catalogue now instead of waiting for the message loop.
+     *
+     * Must be called on the message thread.
+     */
+    void deliverPendingResult();
+
+    /**
+     * @brief Gets the number of builds still running, including abandoned ones.
+     *
+     * @return The number of builds that have not returned yet
+     */
+    int getNumRunningBuilds() const;
+
+private:
+    class BuildJob;
+
+    void handleAsyncUpdate() override;
+
+    /**
+     * @brief Abandons every build: running ones are told to stop and queued ones are dropped.
+     */
+    void abandonBuilds();
+
+    /**
+     * @brief Keeps a finished build's result if it belongs to the latest load.
+     *
+     * Called on the build's thread.
+     *
+     * @param buildGeneration The generation the build was started with
+     * @param catalogue The built catalogue, or nullptr if the build failed
+     */
+    void storeResult(juce::uint64 buildGeneration, std::unique_ptr<GearCatalogue> catalogue);
+
+    juce::CriticalSection lock;                 ///< Guards the result
+    std::unique_ptr<GearCatalogue> builtResult; ///< Finished catalogue waiting for the message thread
+    bool hasBuiltResult = false;                ///< Whether builtResult is waiting, even if null
+    std::atomic<juce::uint64> generation{0};    ///< Increases with every load and cancel; older builds are stale
+    std::atomic<bool> loading{false};           ///< Whether a load has started but not been delivered
+    juce::WaitableEvent builtEvent{true};       ///< Signalled once the latest build has stored its result
+    juce::ThreadPool builders;                  ///< Runs builds; a second thread lets a new build start while an old one winds down
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearCatalogueLoader)
+};
@@ -0,0 +1,428 @@
+/**
+ * @file GearCatalogueParser.cpp
+ * @brief Implementation of the GearCatalogueParser class.
+ *
+ * This file implements a small recursive-descent JSON reader working on the
+ * UTF-8 bytes of the document. Only the fields of units are decoded; every
+ * other value is skipped by scanning past it.
+ */
+
+#include "GearCatalogueParser.h"
+
+namespace
+{
+    /** Containers nested deeper than this are treated as malformed. */
+    constexpr int maxNestingDepth = 256;
+
+    /** Reads JSON values from a run of UTF-8 bytes. */
+    class JsonReader
+    {
+    public:
+        JsonReader(const char *start, const char *end) : position(start), end(end) {}
+
+        bool failed() const { return hasFailed; }
+
+        void skipWhitespace()
+        {
+            while (position < end && (*position == ' ' || *position == '\t' || *position == '\n' || *position == '\r'))
+                ++position;
+        }
+
+        /** Consumes the next non-whitespace character if it is the expected one. */
+        bool consume(char expected)
+        {
+            skipWhitespace();
+            if (position < end && *position == expected)
+            {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        char peek()
+        {
+            skipWhitespace();
+            return position < end ? *position : 0;
+        }
+
+        /** Reads a string, including its quotes, decoding escapes. */
+        bool readString(juce::String &result)
+        {
+            if (!consume('"'))
+                return fail();
+
+            // Most strings have no escapes and convert in one go
+            const char *runStart = position;
+            while (position < end && *position != '"' && *position != '\\')
+                ++position;
+
+            if (position < end && *position == '"')
+            {
+                result = juce::String::fromUTF8(runStart, (int)(position - runStart));
+                ++position;
+                return true;
+            }
+
+            juce::MemoryOutputStream decoded;
+            decoded.write(runStart, (size_t)(position - runStart));
+
+            while (position < end && *position != '"')
+            {
+                if (*position != '\\')
+                {
+                    decoded.writeByte(*position++);
+                    continue;
+                }
+
+                if (++position >= end)
+                    return fail();
+
+                switch (*position++)
+                {
+                case '"':
+                    decoded.writeByte('"');
+                    break;
+                case '\\':
+                    decoded.writeByte('\\');
+                    break;
+                case '/':
+                    decoded.writeByte('/');
+                    break;
+                case 'b':
+                    decoded.writeByte('\b');
+                    break;
+                case 'f':
+                    decoded.writeByte('\f');
+                    break;
+                case 'n':
+                    decoded.writeByte('\n');
+                    break;
+                case 'r':
+                    decoded.writeByte('\r');
+                    break;
+                case 't':
+                    decoded.writeByte('\t');
+                    break;
+                case 'u':
+                {
+                    juce::juce_wchar character = 0;
+                    if (!readHexQuad(character))
+                        return fail();
+
+                    // Surrogate pair
+                    if (character >= 0xd800 && character <= 0xdbff && end - position >= 6 && position[0] == '\\' && position[1] == 'u')
+                    {
+                        position += 2;
+                        juce::juce_wchar low = 0;
+                        if (!readHexQuad(low))
+                            return fail();
+                        character = 0x10000 + ((character - 0xd800) << 10) + (low - 0xdc00);
+                    }
+
+                    char utf8[8] = {};
+                    auto numBytes = juce::CharPointer_UTF8::getBytesRequiredFor(character);
+                    juce::CharPointer_UTF8(utf8).write(character);
+                    decoded.write(utf8, numBytes);
+                    break;
+                }
+                default:
+                    return fail();
+                }
+            }
+
+            if (position >= end)
+                return fail();
+
+            ++position;
+            result = decoded.toUTF8();
+            return true;
+        }
+
+        /** Reads a number, true, false or null as its text. */
+        bool readScalarText(juce::String &result)
+        {
+            skipWhitespace();
+            const char *start = position;
+            while (position < end && (juce::CharacterFunctions::isLetterOrDigit((juce::juce_wchar)(juce::uint8)*position) ||
+                                      *position == '-' || *position == '+' || *position == '.'))
+                ++position;
+
+            if (position == start)
+                return fail();
+
+            result = juce::String::fromUTF8(start, (int)(position - start));
+            return true;
+        }
+
+        /** Reads any value as text the way juce::var::toString() would for scalars. */
+        bool readValueAsText(juce::String &result)
+        {
+            switch (peek())
+            {
+            case '"':
+                return readString(result);
+            case '{':
+            case '[':
+                result = {};
+                return skipValue();
+            default:
+                if (!readScalarText(result))
+                    return false;
+                if (result == "null")
+                    result = {};
+                return true;
+            }
+        }
+
+        /** Scans past any value without storing it. */
+        bool skipValue(int depth = 0)
+        {
+            if (depth > maxNestingDepth)
+                return fail();
+
+            switch (peek())
+            {
+            case '"':
+            {
+                ++position;
+                while (position < end && *position != '"')
+                    position += (*position == '\\') ? 2 : 1;
+
+                if (position >= end)
+                    return fail();
+
+                ++position;
+                return true;
+            }
+            case '{':
+            {
+                ++position;
+                if (consume('}'))
+                    return true;
+
+                do
+                {
+                    juce::String key;
+                    if (!readString(key) || !consume(':') || !skipValue(depth + 1))
+                        return fail();
+                } while (consume(','));
+
+                return consume('}') || fail();
+            }
+            case '[':
+            {
+                ++position;
+                if (consume(']'))
+                    return true;
+
+                do
+                {
+                    if (!skipValue(depth + 1))
+                        return fail();
+                } while (consume(','));
+
+                return consume(']') || fail();
+            }
+            default:
+            {
+                juce::String ignored;
+                return readScalarText(ignored);
+            }
+            }
+        }
+
+        bool fail()
+        {
+            hasFailed = true;
+            return false;
+        }
+
+    private:
+        bool readHexQuad(juce::juce_wchar &result)
+        {
+            if (end - position < 4)
+                return false;
+
+            result = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                auto digit = juce::CharacterFunctions::getHexDigitValue((juce::juce_wchar)(juce::uint8)*position++);
+                if (digit < 0)
+                    return false;
+                result = (result << 4) | (juce::juce_wchar)digit;
+            }
+            return true;
+        }
+
+        const char *position;
+        const char *end;
+        bool hasFailed = false;
+    };
+
+    bool readTags(JsonReader &reader, juce::StringArray &tags)
+    {
+        if (reader.peek() != '[')
+            return reader.skipValue(); // Tags that are not an array are ignored
+
+        reader.consume('[');
+        if (reader.consume(']'))
+            return true;
+
+        do
+        {
+            juce::String tag;
+            if (!reader.readValueAsText(tag))
+                return false;
+            tags.add(tag);
+        } while (reader.consume(','));
+
+        return reader.consume(']') || reader.fail();
+    }
+
+    bool readUnit(JsonReader &reader, GearCatalogueRecord &record)
+    {
+        reader.consume('{');
+        if (reader.consume('}'))
+            return true;
+
+        do
+        {
+            juce::String key;
+            if (!reader.readString(key) || !reader.consume(':'))
+                return reader.fail();
+
+            bool ok;
+            if (key == "unitId")
+                ok = reader.readValueAsText(record.unitId);
+            else if (key == "name")
+                ok = reader.readValueAsText(record.name);
+            else if (key == "manufacturer")
+                ok = reader.readValueAsText(record.manufacturer);
+            else if (key == "category")
+                ok = reader.readValueAsText(record.category);
+            else if (key == "version")
+                ok = reader.readValueAsText(record.version);
+            else if (key == "schemaPath")
+                ok = reader.readValueAsText(record.schemaPath);
+            else if (key == "thumbnailImage")
+                ok = reader.readValueAsText(record.thumbnailImage);
+            else if (key == "tags")
+            {
+                record.tags.clear();
+                ok = readTags(reader, record.tags);
+            }
+            else if (key == "slotSize")
+            {
+                juce::String text;
+                ok = reader.readValueAsText(text);
+                record.slotSize = text == "true" ? 1 : (int)text.getDoubleValue();
+            }
+            else
+                ok = reader.skipValue();
+
+            if (!ok)
+                return reader.fail();
+        } while (reader.consume(','));
+
+        return reader.consume('}') || reader.fail();
+    }
+
+    /**
+     * Walks the top-level object and calls onUnitsArray positioned inside "units".
+     * Returns true if the document is well formed and the array was found.
+     */
+    template <typename UnitsArrayHandler>
+    bool walkDocument(const juce::String &jsonData, UnitsArrayHandler &&onUnitsArray)
+    {
+        const char *start = jsonData.toRawUTF8();
+        JsonReader reader(start, start + jsonData.getNumBytesAsUTF8());
+
+        if (!reader.consume('{'))
+            return false;
+
+        bool foundUnits = false;
+        if (!reader.consume('}'))
+        {
+            do
+            {
+                juce::String key;
+                if (!reader.readString(key) || !reader.consume(':'))
+                    return false;
+
+                if (key == "units" && reader.peek() == '[')
+                {
+                    reader.consume('[');
+                    if (!onUnitsArray(reader))
+                        return false;
+                    foundUnits = true;
+                }
+                else if (!reader.skipValue())
+                {
+                    return false;
+                }
+            } while (reader.consume(','));
+
+            if (!reader.consume('}'))
+                return false;
+        }
+
+        reader.skipWhitespace();
+        return foundUnits && reader.peek() == 0 && !reader.failed();
+    }
+}
+
+bool GearCatalogueParser::parse(const juce::String &jsonData, const RecordCallback &onRecord,
+                                const AbortCheck &shouldAbort)
+{
+    auto readUnits = [&](JsonReader &reader)
+    {
+        if (reader.consume(']'))
+            return true;
+
+        do
+        {
+            if (shouldAbort && shouldAbort())
+                return false;
+
+            if (reader.peek() == '{')
+            {
+                GearCatalogueRecord record;
+                if (!readUnit(reader, record))
+                    return false;
+
+                if (onRecord)
+                    onRecord(std::move(record));
+            }
+            else if (!reader.skipValue())
+            {
+                return false;
+            }
+        } while (reader.consume(','));
+
+        return reader.consume(']');
+    };
+
+    return walkDocument(jsonData, readUnits);
+}
+
+int GearCatalogueParser::countUnits(const juce::String &jsonData)
+{
+    int count = 0;
+    auto countElements = [&count](JsonReader &reader)
+    {
+        if (reader.consume(']'))
+            return true;
+
+        do
+        {
+            if (!reader.skipValue())
+                return false;
+            ++count;
+        } while (reader.consume(','));
+
+        return reader.consume(']');
+    };
+
+    return walkDocument(jsonData, countElements) ? count : 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file GearCatalogueParser.h
+ * @brief Header file for the GearCatalogueParser class.
+ *
+ * This file defines the GearCatalogueParser class, a streaming parser for
+ * the library index.json that hands over one record per unit without
+ * building a juce::var tree of the whole document.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+
+/**
+ * @brief The fields of one unit in the library index.
+ */
+struct GearCatalogueRecord
+{
+    juce::String unitId;         ///< Unique identifier of the unit
+    juce::String name;           ///< Display name
+    juce::String manufacturer;   ///< Manufacturer name
+    juce::String category;       ///< Category string
+    juce::String version;        ///< Schema version
+    juce::String schemaPath;     ///< Path or URL of the unit schema, as written in the index
+    juce::String thumbnailImage; ///< Path or URL of the thumbnail, as written in the index
+    juce::StringArray tags;      ///< Tags
+    int slotSize = 1;            ///< Number of rack slots; 1 when absent
+};
+
+/**
+ * @brief Streaming parser for the library index.
+ *
+ * The document is read once, front to back. Each element of the top-level
+ * "units" array is turned straight into a GearCatalogueRecord and handed to
+ * a callback, and every other value is skipped without being stored, so
+ * memory stays proportional to one unit rather than to the whole document.
+ * Values of the wrong type read like juce::var conversions would: numbers
+ * and literals become their text, and containers become empty strings.
+ */
+class GearCatalogueParser
+{
+public:
+    /**
+     * @brief Called with each unit as soon as it has been read.
+     */
+    using RecordCallback = std::function<void(GearCatalogueRecord &&)>;
+
+    /**
+     * @brief Polled between units; returning true abandons the parse.
+     */
+    using AbortCheck = std::function<bool()>;
+
+    /**
+     * @brief Parses a library index.
+     *
+     * Units read before a syntax error have already been handed over.
+     *
+     * @param jsonData The text of index.json
+     * @param onRecord Receives each unit in document order
+     * @param shouldAbort Optional check polled between units
+     * @return true if the document is well formed and has a top-level "units" array
+     */
+    static bool parse(const juce::String &jsonData, const RecordCallback &onRecord,
+                      const AbortCheck &shouldAbort = nullptr);
+
+    /**
+     * @brief Counts the units in a library index without reading their fields.
+     *
+     * @param jsonData The text of index.json
+     * @return The number of elements of the "units" array, or 0 if there is none
+     */
+    static int countUnits(const juce::String &jsonData);
+};
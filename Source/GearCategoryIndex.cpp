@@ -0,0 +1,85 @@
+/**
+ * @file GearCategoryIndex.cpp
+ * @brief Implementation of the GearCategoryIndex class.
+ *
+ * This file implements filing entries under their category and keeping the
+ * groups and their entries sorted as they are added.
+ */
+
+#include "GearCategoryIndex.h"
+#include <algorithm>
+
+void GearCategoryIndex::clear()
+{
+    categoryNames.clear();
+    displayNames.clear();
+    groupEntries.clear();
+    groupEntriesByName.clear();
+
+    groupsByName.clear();
+    entryGroups.clear();
+    lookup.clear();
+}
+
+int GearCategoryIndex::addEntry(int entry, const juce::String &category, const juce::StringArray &entryNames)
+{
+    jassert(entry == entryGroups.size());
+    jassert(juce::isPositiveAndBelow(entry, entryNames.size()));
+
+    auto key = category.toLowerCase();
+
+    if (!lookup.contains(key))
+    {
+        const int newGroup = categoryNames.size();
+        lookup.set(key, newGroup);
+        categoryNames.add(category);
+        displayNames.add(formatDisplayName(category));
+        groupEntries.add({});
+        groupEntriesByName.add({});
+
+        auto position = std::upper_bound(groupsByName.begin(), groupsByName.end(), newGroup,
+                                         [this](int a, int b)
+                                         {
+                                             return categoryNames[a].compareIgnoreCase(categoryNames[b]) < 0;
+                                         });
+        groupsByName.insert((int)(position - groupsByName.begin()), newGroup);
+    }
+
+    const int group = lookup[key];
+    entryGroups.add(group);
+    groupEntries.getReference(group).add(entry);
+
+    // Entries with equal names stay in catalogue order
+    auto &byName = groupEntriesByName.getReference(group);
+    auto position = std::upper_bound(byName.begin(), byName.end(), entry,
+                                     [&entryNames](int a, int b)
+                                     {
+                                         return entryNames[a].compareIgnoreCase(entryNames[b]) < 0;
+                                     });
+    byName.insert((int)(position - byName.begin()), entry);
+
+    return group;
+}
+
+int GearCategoryIndex::findGroup(const juce::String &category) const
+{
+    auto key = category.toLowerCase();
+    return lookup.contains(key) ? lookup[key] : -1;
+}
+
+void GearCategoryIndex::swapWith(GearCategoryIndex &other) noexcept
+{
+    categoryNames.swapWith(other.categoryNames);
+    displayNames.swapWith(other.displayNames);
+    groupEntries.swapWith(other.groupEntries);
+    groupEntriesByName.swapWith(other.groupEntriesByName);
+
+    groupsByName.swapWith(other.groupsByName);
+    entryGroups.swapWith(other.entryGroups);
+    lookup.swapWith(other.lookup);
+}
+
+juce::String GearCategoryIndex::formatDisplayName(const juce::String &category)
+{
+    return category.substring(0, 1).toUpperCase() + category.substring(1);
+}
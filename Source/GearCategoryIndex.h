@@ -0,0 +1,137 @@
+/**
+ * @file GearCategoryIndex.h
+ * @brief Header file for the GearCategoryIndex class.
+ *
+ * This file defines the GearCategoryIndex class, which keeps the entries of
+ * the gear library grouped by category, with the groups and their entries
+ * already in the orders the tree shows them.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief The entries of the gear library grouped by category.
+ *
+ * Categories are matched ignoring case, so "Compressor" and "compressor" are
+ * one group, named and displayed as first seen. Each entry is filed as it is
+ * added, so the groups are never rebuilt from the whole catalogue: the
+ * Categories section, the search results and My Gear all read their groups,
+ * display names and orderings from here.
+ *
+ * Groups are numbered in first-seen order, which is the order of the
+ * Categories section; getGroupsByName() gives the alphabetical order used
+ * by My Gear. Each group keeps its entries both in catalogue order and in
+ * name order.
+ */
+class GearCategoryIndex
+{
+public:
+    /**
+     * @brief Removes every entry and group.
+     */
+    void clear();
+
+    /**
+     * @brief Files an entry under its category, creating the group if it is new.
+     *
+     * Entries must be added in index order.
+     *
+     * @param entry The index of the entry; one more than the last one added
+     * @param category The category the entry is grouped under
+     * @param entryNames The display names of the entries so far, including this one
+     * @return The group the entry was filed under
+     */
+    int addEntry(int entry, const juce::String &category, const juce::StringArray &entryNames);
+
+    /**
+     * @brief Gets the number of groups.
+     *
+     * @return The number of distinct categories
+     */
+    int getNumGroups() const { return categoryNames.size(); }
+
+    /**
+     * @brief Gets the category of a group.
+     *
+     * @param group A group number below getNumGroups()
+     * @return The category as first seen
+     */
+    const juce::String &getCategoryName(int group) const { return categoryNames.getReference(group); }
+
+    /**
+     * @brief Gets the name a group is shown under.
+     *
+     * @param group A group number below getNumGroups()
+     * @return The category with its first letter capitalised
+     */
+    const juce::String &getDisplayName(int group) const { return displayNames.getReference(group); }
+
+    /**
+     * @brief Gets the entries of a group in catalogue order.
+     *
+     * @param group A group number below getNumGroups()
+     * @return The entry indices, ascending
+     */
+    const juce::Array<int> &getEntries(int group) const { return groupEntries.getReference(group); }
+
+    /**
+     * @brief Gets the entries of a group in name order.
+     *
+     * @param group A group number below getNumGroups()
+     * @return The entry indices sorted by name, ignoring case
+     */
+    const juce::Array<int> &getEntriesByName(int group) const { return groupEntriesByName.getReference(group); }
+
+    /**
+     * @brief Gets the groups in category name order.
+     *
+     * @return The group numbers sorted by category, ignoring case
+     */
+    const juce::Array<int> &getGroupsByName() const { return groupsByName; }
+
+    /**
+     * @brief Gets the group an entry is filed under.
+     *
+     * @param entry The index of the entry
+     * @return The group number, or -1 if the entry has not been added
+     */
+    int getGroupOfEntry(int entry) const { return juce::isPositiveAndBelow(entry, entryGroups.size()) ? entryGroups[entry] : -1; }
+
+    /**
+     * @brief Finds the group of a category.
+     *
+     * @param category The category, in any case
+     * @return The group number, or -1 if no entry has that category
+     */
+    int findGroup(const juce::String &category) const;
+
+    /**
+     * @brief Swaps the contents of two indices.
+     *
+     * @param other The index to swap with
+     */
+    void swapWith(GearCategoryIndex &other) noexcept;
+
+    /**
+     * @brief Formats a category for display by capitalising its first letter.
+     *
+     * @param category The category
+     * @return The display name
+     */
+    static juce::String formatDisplayName(const juce::String &category);
+
+private:
+    // One element per group
+    juce::StringArray categoryNames;                  ///< Categories as first seen
+    juce::StringArray displayNames;                   ///< Display names
+    juce::Array<juce::Array<int>> groupEntries;       ///< Entries in catalogue order
+    juce::Array<juce::Array<int>> groupEntriesByName; ///< Entries in name order
+
+    juce::Array<int> groupsByName;           ///< Group numbers in category name order
+    juce::Array<int> entryGroups;            ///< Group of each entry
+    juce::HashMap<juce::String, int> lookup; ///< Group of each lowercased category
+
+    JUCE_LEAK_DETECTOR(GearCategoryIndex)
+};
@@ -0,0 +1,326 @@
+/**
+ * @file GearControl.h
+ * @brief Header file for the GearControl class.
+ *
+ * This file defines the GearControl class, which describes one knob, fader,
+ * switch or button on a piece of gear as its schema defines it.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryUsage.h"
+#include <variant>
+
+/**
+ * @brief Class representing a control on a piece of gear.
+ *
+ * This class defines the properties and behavior of controls
+ * such as knobs, faders, switches, and buttons on audio gear.
+ *
+ * A control describes what the schema defines: its type, position, assets
+ * and default. The value and selected option an instance has now are kept
+ * by GearItem in one array per item (see GearItem::getControlState()), so
+ * instances of a unit differ only in that array.
+ *
+ * Members only one type uses live in a per-type payload, so a control only
+ * holds the knob, fader or switch and button data it needs.
+ */
+class GearControl
+{
+public:
+    /**
+     * @brief Structure defining a frame in a switch or button sprite sheet.
+     *
+     * Contains position and size information for a single frame
+     * in a multi-state control's sprite sheet.
+     */
+    struct SwitchOptionFrame
+    {
+        int x = 0;          ///< X position in sprite sheet
+        int y = 0;          ///< Y position in sprite sheet
+        int width = 0;      ///< Frame width
+        int height = 0;     ///< Frame height
+        juce::String value; ///< Value associated with this frame
+        juce::String label; ///< Display label for this frame
+    };
+
+    /**
+     * @brief The state of a control that changes while the user plays with it.
+     */
+    struct State
+    {
+        float value = 0.0f;   ///< Current value: an angle for knobs, 0 to 1 for faders, the option for switches and buttons
+        int currentIndex = 0; ///< Selected option of a switch or button
+    };
+
+    /**
+     * @brief Data only knobs have.
+     */
+    struct KnobData
+    {
+        float startAngle = 0.0f;  ///< Starting angle in degrees
+        float endAngle = 360.0f;  ///< Ending angle in degrees
+        int currentStepIndex = 0; ///< Current step index
+        juce::Array<float> steps; ///< Rotation degrees for stepped knobs
+    };
+
+    /**
+     * @brief Data only faders have.
+     */
+    struct FaderData
+    {
+        int length = 100; ///< Length of fader track in pixels
+    };
+
+    /**
+     * @brief Data only switches and buttons have.
+     */
+    struct SelectorData
+    {
+        juce::StringArray options;             ///< Values of the options
+        juce::Array<SwitchOptionFrame> frames; ///< Sprite sheet frame of each option
+    };
+
+    /**
+     * @brief Enumeration of control types.
+     *
+     * Defines the different types of controls that can be
+     * represented in the system.
+     */
+    enum class Type : juce::uint8
+    {
+        Button, ///< Push button control
+        Fader,  ///< Slider/fader control
+        Switch, ///< Toggle switch control
+        Knob    ///< Rotary knob control
+    };
+
+    /**
+     * @brief Orientation of a fader or switch.
+     */
+    enum class Orientation : juce::uint8
+    {
+        Vertical,  ///< Moves up and down
+        Horizontal ///< Moves left and right
+    };
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes a control with default values.
+     */
+    GearControl() = default;
+
+    /**
+     * @brief Destructor.
+     *
+     * Cleans up any loaded images to prevent memory leaks.
+     */
+    ~GearControl()
+    {
+        loadedImage = juce::Image();
+    }
+
+    /**
+     * @brief Constructor with basic parameters.
+     *
+     * @param typeParam The type of control
+     * @param nameParam The name of the control
+     * @param positionParam The position and size of the control
+     */
+    GearControl(Type typeParam, const juce::String &nameParam, const juce::Rectangle<float> &positionParam)
+        : type(typeParam),
+          position(positionParam),
+          name(nameParam)
+    {
+        switch (type)
+        {
+        case Type::Knob:
+            payload = KnobData();
+            break;
+        case Type::Fader:
+            payload = FaderData();
+            break;
+        default:
+            payload = SelectorData();
+            break;
+        }
+    }
+
+    /**
+     * @brief Parses an orientation as schemas write it.
+     *
+     * @param orientationName "vertical" or "horizontal"
+     * @return The orientation; anything but "vertical" is horizontal
+     */
+    static Orientation parseOrientation(const juce::String &orientationName)
+    {
+        return orientationName == "vertical" ? Orientation::Vertical : Orientation::Horizontal;
+    }
+
+    /**
+     * @brief Checks whether the control moves up and down.
+     *
+     * @return true if the orientation is vertical
+     */
+    bool isVertical() const { return orientation == Orientation::Vertical; }
+
+    /**
+     * @brief Gets the state the schema gives the control before anyone touches it.
+     *
+     * @return The initial value, with the option it selects for switches and buttons
+     */
+    State getInitialState() const
+    {
+        State state;
+        state.value = initialValue;
+
+        if (type == Type::Switch || (type == Type::Button && !momentary))
+            state.currentIndex = (int)initialValue;
+        else if (type == Type::Button)
+            state.currentIndex = initialValue > 0.5f ? 1 : 0;
+
+        return state;
+    }
+
+    /**
+     * @brief Gets the bytes the control holds, without its decoded image.
+     *
+     * @return The object itself plus the text of its strings and the contents of its options, frames and steps
+     */
+    juce::int64 getRecordBytes() const
+    {
+        // Handles are part of the object or the element, so only the text is added for them
+        auto textBytes = [](const juce::String &text)
+        {
+            return MemoryUsage::getStringBytes(text) - (juce::int64)sizeof(juce::String);
+        };
+
+        auto bytes = (juce::int64)sizeof(GearControl) + textBytes(name) + textBytes(id) + textBytes(image);
+
+        for (const auto &option : selector().options)
+            bytes += MemoryUsage::getStringBytes(option);
+
+        for (const auto &frame : selector().frames)
+            bytes += (juce::int64)sizeof(SwitchOptionFrame) + textBytes(frame.value) + textBytes(frame.label);
+
+        bytes += (juce::int64)knob().steps.size() * (juce::int64)sizeof(float);
+        return bytes;
+    }
+
+    /**
+     * @brief Gets the knob data, replacing any data of another type.
+     *
+     * @return The knob data
+     */
+    KnobData &knob() { return getPayload<KnobData>(); }
+
+    /**
+     * @brief Gets the knob data.
+     *
+     * @return The knob data, or defaults if the control holds none
+     */
+    const KnobData &knob() const { return getPayload<KnobData>(); }
+
+    /**
+     * @brief Gets the fader data, replacing any data of another type.
+     *
+     * @return The fader data
+     */
+    FaderData &fader() { return getPayload<FaderData>(); }
+
+    /**
+     * @brief Gets the fader data.
+     *
+     * @return The fader data, or defaults if the control holds none
+     */
+    const FaderData &fader() const { return getPayload<FaderData>(); }
+
+    /**
+     * @brief Gets the options of a switch or button, replacing any data of another type.
+     *
+     * @return The options and their frames
+     */
+    SelectorData &selector() { return getPayload<SelectorData>(); }
+
+    /**
+     * @brief Gets the options of a switch or button.
+     *
+     * @return The options and their frames, or none if the control holds none
+     */
+    const SelectorData &selector() const { return getPayload<SelectorData>(); }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * Copies share the strings and decoded images of the original; only the
+     * arrays of options, frames and steps are duplicated.
+     *
+     * @param other The control to copy from
+     */
+    GearControl(const GearControl &other) = default;
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the other control's storage without allocating, so growing
+     * an array of controls relocates them instead of copying them.
+     *
+     * @param other The control to move from
+     */
+    GearControl(GearControl &&other) noexcept = default;
+
+    /**
+     * @brief Assignment operator.
+     *
+     * @param other The control to assign from
+     * @return Reference to this control
+     */
+    GearControl &operator=(const GearControl &other) = default;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param other The control to move from
+     * @return Reference to this control
+     */
+    GearControl &operator=(GearControl &&other) noexcept = default;
+
+    Type type = Type::Button;                        ///< The type of control
+    Orientation orientation = Orientation::Vertical; ///< Orientation of faders and switches
+    bool momentary = false;                          ///< Whether a button is momentary
+    float initialValue = 0.0f;                       ///< Original value from schema
+    juce::Rectangle<float> position;                 ///< Position and size of the control
+
+    juce::String name;       ///< The name of the control
+    juce::String id;         ///< Unique identifier for the control
+    juce::String image;      ///< URI of the knob image, fader image or sprite sheet
+    juce::Image loadedImage; ///< Decoded knob image, fader image or sprite sheet
+
+private:
+    /**
+     * @brief Gets the payload of one kind, replacing the payload if it held another.
+     */
+    template <typename Data>
+    Data &getPayload()
+    {
+        if (auto *data = std::get_if<Data>(&payload))
+            return *data;
+
+        return payload.template emplace<Data>();
+    }
+
+    /**
+     * @brief Gets the payload of one kind, or shared defaults if it holds another.
+     */
+    template <typename Data>
+    const Data &getPayload() const
+    {
+        static const Data defaults;
+        auto *data = std::get_if<Data>(&payload);
+        return data != nullptr ? *data : defaults;
+    }
+
+    std::variant<SelectorData, FaderData, KnobData> payload; ///< The data only this control's type uses
+};
@@ -0,0 +1,51 @@
+/**
+ * @file GearDefinition.cpp
+ * @brief Implementation of the GearDefinitionCache class.
+ *
+ * This file implements handing out and releasing the shared definitions of
+ * the units placed in the rack, and reporting the memory their assets hold.
+ */
+
+#include "GearDefinition.h"
+
+GearDefinition::Ptr GearDefinitionCache::getOrCreate(const juce::String &unitId, const juce::String &version)
+{
+    auto key = unitId + "@" + version;
+
+    if (!definitions.contains(key))
+        definitions.set(key, new GearDefinition(unitId, version));
+
+    return definitions[key];
+}
+
+void GearDefinitionCache::purgeUnused()
+{
+    juce::StringArray unused;
+
+    for (auto it = definitions.begin(); it != definitions.end(); ++it)
+    {
+        // The cache's own reference is the only one left
+        auto *definition = it.getValue().get();
+        if (definition->getReferenceCount() == 1 && definition->state != GearDefinition::State::Loading)
+            unused.add(it.getKey());
+    }
+
+    for (const auto &key : unused)
+        definitions.remove(key);
+}
+
+MemoryUsage GearDefinitionCache::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    MemoryUsage usage;
+
+    for (auto it = definitions.begin(); it != definitions.end(); ++it)
+    {
+        const auto *definition = it.getValue().get();
+        usage.faceplates += images.count(definition->faceplateImage);
+
+        for (const auto &control : definition->controls)
+            usage.controlImages += images.count(control.loadedImage);
+    }
+
+    return usage;
+}
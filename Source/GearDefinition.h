@@ -0,0 +1,117 @@
+/**
+ * @file GearDefinition.h
+ * @brief Header file for the GearDefinition and GearDefinitionCache classes.
+ *
+ * This file defines GearDefinition, which holds what a unit's schema defines
+ * (faceplate, control layout and decoded control assets) once for every
+ * instance of the unit, and GearDefinitionCache, which hands out one
+ * definition per unit and version.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearControl.h"
+#include "MemoryUsage.h"
+#include <functional>
+
+class GearItem;
+
+/**
+ * @brief What a unit's schema defines, shared by every instance of the unit.
+ *
+ * A definition is loaded once, the first time an instance of its unit is
+ * placed, and then referred to by every instance: eight instances of the same
+ * EQ hold eight references to one faceplate and one set of control sprites
+ * rather than decoding and keeping eight copies. Instances keep only their
+ * own state, such as their instance ID and control values.
+ *
+ * Definitions are written while loading, on the message thread; once loaded
+ * only the decoded assets of controls still arrive.
+ */
+class GearDefinition : public juce::ReferenceCountedObject
+{
+public:
+    using Ptr = juce::ReferenceCountedObjectPtr<GearDefinition>;
+
+    /**
+     * @brief How far the schema has been loaded.
+     */
+    enum class State
+    {
+        Empty,   ///< The schema has not been requested
+        Loading, ///< The schema is being fetched
+        Loaded   ///< The schema has been parsed into the definition
+    };
+
+    /**
+     * @brief An instance waiting for the schema, and what to do once it is applied.
+     */
+    struct Waiter
+    {
+        GearItem *item = nullptr;         ///< The instance to give the schema's controls
+        std::function<void()> onComplete; ///< Called once the instance has them, or the load failed
+    };
+
+    /**
+     * @brief Constructs an empty definition.
+     *
+     * @param unitIdParam The unit the definition is for
+     * @param versionParam The schema version
+     */
+    GearDefinition(const juce::String &unitIdParam, const juce::String &versionParam)
+        : unitId(unitIdParam), version(versionParam) {}
+
+    const juce::String unitId;         ///< The unit the definition is for
+    const juce::String version;        ///< The schema version
+    State state = State::Empty;        ///< How far the schema has been loaded
+    juce::String faceplateImagePath;   ///< Path or URL of the faceplate image
+    juce::Image faceplateImage;        ///< Decoded faceplate, shared by every instance
+    juce::Array<GearControl> controls; ///< Controls as the schema defines them, with their decoded assets
+    juce::Array<Waiter> waiters;       ///< Instances waiting for the schema to load
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearDefinition)
+};
+
+/**
+ * @brief Hands out one shared definition per unit and version.
+ */
+class GearDefinitionCache
+{
+public:
+    /**
+     * @brief Gets the definition of a unit, creating an empty one if there is none.
+     *
+     * @param unitId The unit
+     * @param version The schema version
+     * @return The shared definition
+     */
+    GearDefinition::Ptr getOrCreate(const juce::String &unitId, const juce::String &version);
+
+    /**
+     * @brief Drops the definitions no instance refers to any more.
+     *
+     * A definition that is still loading is kept.
+     */
+    void purgeUnused();
+
+    /**
+     * @brief Gets the number of definitions held.
+     *
+     * @return The number of units with a definition
+     */
+    int size() const { return definitions.size(); }
+
+    /**
+     * @brief Gets the memory held by the decoded assets of every definition.
+     *
+     * @param images Counts each image once across holders
+     * @return The faceplates and control images
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
+
+private:
+    juce::HashMap<juce::String, GearDefinition::Ptr> definitions; ///< Definitions by unit ID and version
+
+    JUCE_LEAK_DETECTOR(GearDefinitionCache)
+};
@@ -0,0 +1,189 @@
+/**
+ * @file GearFacetIndex.cpp
+ * @brief Implementation of the GearFacetIndex class.
+ *
+ * This file implements building the per-value bitsets and applying facet
+ * filters with their counts.
+ */
+
+#include "GearFacetIndex.h"
+
+bool GearFacetIndex::Filter::isActive() const
+{
+    for (const auto &values : selected)
+        if (!values.isEmpty())
+            return true;
+
+    return false;
+}
+
+void GearFacetIndex::Filter::clear()
+{
+    for (auto &values : selected)
+        values.clear();
+}
+
+void GearFacetIndex::clear()
+{
+    for (auto &facet : facets)
+    {
+        facet.values.clear();
+        facet.entries.clear();
+        facet.lookup.clear();
+    }
+
+    numEntries = 0;
+    allEntries.clear();
+}
+
+void GearFacetIndex::swapWith(GearFacetIndex &other) noexcept
+{
+    for (int f = 0; f < NUM_FACETS; ++f)
+    {
+        facets[f].values.swapWith(other.facets[f].values);
+        facets[f].entries.swapWith(other.facets[f].entries);
+        facets[f].lookup.swapWith(other.facets[f].lookup);
+    }
+
+    std::swap(numEntries, other.numEntries);
+    allEntries.swapWith(other.allEntries);
+}
+
+int GearFacetIndex::addEntry()
+{
+    allEntries.setBit(numEntries);
+    return numEntries++;
+}
+
+void GearFacetIndex::addValue(int entryIndex, Facet facet, const juce::String &value)
+{
+    jassert(juce::isPositiveAndBelow(entryIndex, numEntries));
+
+    if (value.isEmpty())
+        return;
+
+    auto &facetValues = facets[(int)facet];
+
+    if (!facetValues.lookup.contains(value))
+    {
+        facetValues.lookup.set(value, facetValues.values.size());
+        facetValues.values.add(value);
+        facetValues.entries.add({});
+    }
+
+    facetValues.entries.getReference(facetValues.lookup[value]).setBit(entryIndex);
+}
+
+juce::BigInteger GearFacetIndex::getEntries(Facet facet, const juce::String &value) const
+{
+    const auto &facetValues = facets[(int)facet];
+
+    if (!facetValues.lookup.contains(value))
+        return {};
+
+    return facetValues.entries[facetValues.lookup[value]];
+}
+
+juce::BigInteger GearFacetIndex::getSelectedEntries(Facet facet, const juce::StringArray &values) const
+{
+    juce::BigInteger selected;
+    for (const auto &value : values)
+        selected |= getEntries(facet, value);
+
+    return selected;
+}
+
+juce::BigInteger GearFacetIndex::getMatches(const Filter &filter) const
+{
+    juce::BigInteger matches = allEntries;
+
+    for (int f = 0; f < NUM_FACETS; ++f)
+    {
+        const auto &values = filter.getValues((Facet)f);
+        if (!values.isEmpty())
+            matches &= getSelectedEntries((Facet)f, values);
+    }
+
+    return matches;
+}
+
+GearFacetIndex::Result GearFacetIndex::filter(const Filter &filter, const juce::BigInteger *textMatches) const
+{
+    // Entries passing each facet on its own; unfiltered facets pass everything
+    juce::BigInteger passing[NUM_FACETS];
+    bool isFiltered[NUM_FACETS];
+
+    for (int f = 0; f < NUM_FACETS; ++f)
+    {
+        const auto &values = filter.getValues((Facet)f);
+        isFiltered[f] = !values.isEmpty();
+
+        if (isFiltered[f])
+            passing[f] = getSelectedEntries((Facet)f, values);
+    }
+
+    juce::BigInteger base = allEntries;
+    if (textMatches != nullptr)
+        base &= *textMatches;
+
+    Result result;
+    result.matches = base;
+    for (int f = 0; f < NUM_FACETS; ++f)
+        if (isFiltered[f])
+            result.matches &= passing[f];
+
+    result.numMatches = result.matches.countNumberOfSetBits();
+
+    // A value's count ignores the selections on its own facet, so it shows
+    // what choosing that value instead, or as well, would give
+    for (int f = 0; f < NUM_FACETS; ++f)
+    {
+        juce::BigInteger others = base;
+        for (int g = 0; g < NUM_FACETS; ++g)
+            if (g != f && isFiltered[g])
+                others &= passing[g];
+
+        const auto &facetValues = facets[f];
+        auto &counts = result.counts[f];
+        counts.ensureStorageAllocated(facetValues.values.size());
+
+        for (int v = 0; v < facetValues.values.size(); ++v)
+        {
+            auto entries = facetValues.entries.getReference(v);
+            entries &= others;
+            counts.add({facetValues.values[v], entries.countNumberOfSetBits()});
+        }
+    }
+
+    return result;
+}
+
+juce::Array<int> GearFacetIndex::toIndices(const juce::BigInteger &bits)
+{
+    juce::Array<int> indices;
+    indices.ensureStorageAllocated(bits.countNumberOfSetBits());
+
+    for (int bit = bits.findNextSetBit(0); bit >= 0; bit = bits.findNextSetBit(bit + 1))
+        indices.add(bit);
+
+    return indices;
+}
+
+juce::BigInteger GearFacetIndex::toBits(const juce::Array<int> &indices)
+{
+    juce::BigInteger bits;
+    for (auto index : indices)
+        bits.setBit(index);
+
+    return bits;
+}
+
+juce::Array<int> GearFacetIndex::intersect(const juce::Array<int> &indices, const juce::BigInteger &bits)
+{
+    juce::Array<int> kept;
+    for (auto index : indices)
+        if (bits[index])
+            kept.add(index);
+
+    return kept;
+}
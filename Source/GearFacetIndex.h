@@ -0,0 +1,226 @@
+/**
+ * @file GearFacetIndex.h
+ * @brief Header file for the GearFacetIndex class.
+ *
+ * This file defines the GearFacetIndex class, which keeps one bitset per
+ * facet value of the gear library (manufacturer, category, type, slot size
+ * and tag) so facet filters and their counts cost a few bitwise operations.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief Bitset index over the facet values of the gear library.
+ *
+ * Every distinct value of every facet owns a bitset with one bit per entry.
+ * A filter selects values per facet: entries pass a facet if they have any
+ * of its selected values, and pass the filter if they pass every facet, so
+ * applying a filter is an OR within each facet followed by an AND across
+ * facets. Text search results combine with the filter the same way.
+ *
+ * filter() also counts, for every value of every facet, how many entries
+ * would match if that value were selected, taking the text matches and the
+ * selections on every other facet into account. This is what a facet list in
+ * the UI shows next to each value.
+ */
+class GearFacetIndex
+{
+public:
+    /**
+     * @brief The facets items can be filtered by.
+     */
+    enum class Facet
+    {
+        Manufacturer = 0, ///< The manufacturer name
+        Category,         ///< The category, as grouped in the tree
+        Type,             ///< The GearType, e.g. "500Series"
+        SlotSize,         ///< The number of slots, e.g. "1"
+        Tag               ///< Any one of the tags
+    };
+
+    /**
+     * @brief Number of facets.
+     */
+    static constexpr int NUM_FACETS = 5;
+
+    /**
+     * @brief The values selected per facet.
+     */
+    class Filter
+    {
+    public:
+        /**
+         * @brief Selects values of a facet.
+         *
+         * @param facet The facet to filter
+         * @param values Accepted values; an empty list leaves the facet unfiltered
+         */
+        void setValues(Facet facet, const juce::StringArray &values) { selected[(int)facet] = values; }
+
+        /**
+         * @brief Gets the selected values of a facet.
+         *
+         * @param facet The facet
+         * @return The accepted values, empty if the facet is unfiltered
+         */
+        const juce::StringArray &getValues(Facet facet) const { return selected[(int)facet]; }
+
+        /**
+         * @brief Checks whether any facet is filtered.
+         *
+         * @return true if at least one facet has selected values
+         */
+        bool isActive() const;
+
+        /**
+         * @brief Removes every selection.
+         */
+        void clear();
+
+    private:
+        juce::StringArray selected[NUM_FACETS]; ///< Accepted values per facet
+    };
+
+    /**
+     * @brief How many entries a facet value would match.
+     */
+    struct ValueCount
+    {
+        juce::String value; ///< The facet value
+        int count = 0;      ///< Matching entries if this value were selected
+    };
+
+    /**
+     * @brief The outcome of applying a filter.
+     */
+    struct Result
+    {
+        juce::BigInteger matches;                   ///< Entries passing the text matches and every facet
+        int numMatches = 0;                         ///< Number of set bits in matches
+        juce::Array<ValueCount> counts[NUM_FACETS]; ///< Per facet, the count for each value in getValues() order
+    };
+
+    /**
+     * @brief Removes every entry and value.
+     */
+    void clear();
+
+    /**
+     * @brief Appends an entry without any facet values.
+     *
+     * @return The index of the new entry
+     */
+    int addEntry();
+
+    /**
+     * @brief Gives an entry a facet value.
+     *
+     * An entry may have several values of the same facet, such as several tags.
+     *
+     * @param entryIndex An entry returned by addEntry()
+     * @param facet The facet
+     * @param value The value; empty values are ignored
+     */
+    void addValue(int entryIndex, Facet facet, const juce::String &value);
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @return The number of entries added since the last clear()
+     */
+    int size() const { return numEntries; }
+
+    /**
+     * @brief Gets the distinct values of a facet.
+     *
+     * @param facet The facet
+     * @return The values in the order they were first seen
+     */
+    const juce::StringArray &getValues(Facet facet) const { return facets[(int)facet].values; }
+
+    /**
+     * @brief Gets the entries having a facet value.
+     *
+     * @param facet The facet
+     * @param value The value
+     * @return One bit per entry; empty if no entry has the value
+     */
+    juce::BigInteger getEntries(Facet facet, const juce::String &value) const;
+
+    /**
+     * @brief Gets the entries passing a filter, without counting.
+     *
+     * @param filter The selected values per facet
+     * @return One bit per matching entry; every entry if the filter is inactive
+     */
+    juce::BigInteger getMatches(const Filter &filter) const;
+
+    /**
+     * @brief Applies a filter and counts every facet value in the same pass.
+     *
+     * @param filter The selected values per facet
+     * @param textMatches Entries matching the search text, or nullptr if there is none
+     * @return The matching entries and the counts per facet value
+     */
+    Result filter(const Filter &filter, const juce::BigInteger *textMatches = nullptr) const;
+
+    /**
+     * @brief Converts a bitset to the indices of its set bits.
+     *
+     * @param bits The bitset
+     * @return The set bit positions in ascending order
+     */
+    static juce::Array<int> toIndices(const juce::BigInteger &bits);
+
+    /**
+     * @brief Converts entry indices to a bitset.
+     *
+     * @param indices The entry indices, in any order
+     * @return A bitset with those bits set
+     */
+    static juce::BigInteger toBits(const juce::Array<int> &indices);
+
+    /**
+     * @brief Keeps the indices whose bit is set.
+     *
+     * @param indices The entry indices, in any order
+     * @param bits The entries to keep
+     * @return The kept indices in their original order
+     */
+    static juce::Array<int> intersect(const juce::Array<int> &indices, const juce::BigInteger &bits);
+
+    /**
+     * @brief Swaps the contents of two indices.
+     *
+     * @param other The index to swap with
+     */
+    void swapWith(GearFacetIndex &other) noexcept;
+
+private:
+    /**
+     * @brief The values of one facet and their entries.
+     */
+    struct FacetValues
+    {
+        juce::StringArray values;                ///< Distinct values in first-seen order
+        juce::Array<juce::BigInteger> entries;   ///< Entries per value, parallel to values
+        juce::HashMap<juce::String, int> lookup; ///< Position of each value in values
+    };
+
+    /**
+     * @brief Gets the entries passing the selections on one facet.
+     *
+     * @param facet The facet
+     * @param values The selected values, not empty
+     * @return The union of the entries of the selected values
+     */
+    juce::BigInteger getSelectedEntries(Facet facet, const juce::StringArray &values) const;
+
+    FacetValues facets[NUM_FACETS]; ///< Values and bitsets per facet
+    int numEntries = 0;             ///< Number of entries
+    juce::BigInteger allEntries;    ///< One set bit per entry
+
+    JUCE_LEAK_DETECTOR(GearFacetIndex)
+};
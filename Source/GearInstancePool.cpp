@@ -0,0 +1,84 @@
+/**
+ * @file GearInstancePool.cpp
+ * @brief Implementation of the GearInstancePool class.
+ *
+ * This file implements acquiring, releasing and recycling the gear item
+ * instances placed in a rack.
+ */
+
+#include "GearInstancePool.h"
+
+GearItem *GearInstancePool::acquire(GearItem &&item)
+{
+    if (freeItems.isEmpty())
+        return items.add(new GearItem(std::move(item)));
+
+    auto *instance = freeItems.removeAndReturn(freeItems.size() - 1);
+    freeControlCounts.removeLast();
+
+    // Keep the released controls' storage unless the new item brings its own
+    auto spareControls = std::move(instance->controls);
+    *instance = std::move(item);
+
+    if (instance->controls.isEmpty())
+        instance->controls.swapWith(spareControls);
+
+    return instance;
+}
+
+void GearInstancePool::release(GearItem *item)
+{
+    jassert(owns(item) && !freeItems.contains(item));
+
+    if (item->definition != nullptr)
+    {
+        // Nothing should complete on an instance that may be reused for another unit
+        item->definition->waiters.removeIf([item](const GearDefinition::Waiter &waiter)
+                                           { return waiter.item == item; });
+        item->definition = nullptr;
+    }
+
+    item->image = juce::Image();
+    freeControlCounts.add(item->controls.size());
+    item->controls.clearQuick();
+    item->resetControlStates();
+    item->isInstance = false;
+    item->instanceId = juce::String();
+    item->sourceUnitId = juce::String();
+
+    freeItems.add(item);
+}
+
+int GearInstancePool::releaseAllExcept(const juce::Array<GearItem *> &itemsStillInUse)
+{
+    int numReleased = 0;
+
+    for (auto *item : items)
+    {
+        if (!freeItems.contains(item) && !itemsStillInUse.contains(item))
+        {
+            release(item);
+            ++numReleased;
+        }
+    }
+
+    return numReleased;
+}
+
+MemoryUsage GearInstancePool::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    MemoryUsage usage;
+
+    for (int i = 0; i < freeItems.size(); ++i)
+    {
+        const auto keptStorage = (juce::int64)freeControlCounts[i] * (juce::int64)(sizeof(GearControl) + sizeof(GearControl::State));
+        usage.pooledInstances += (juce::int64)sizeof(GearItem) + keptStorage + freeItems[i]->getMemoryUsage(images).getTotal();
+    }
+
+    return usage;
+}
+
+bool GearInstancePool::owns(const GearItem *item) const
+{
+    return items.contains(item);
+}
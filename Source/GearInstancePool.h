@@ -0,0 +1,100 @@
+/**
+ * @file GearInstancePool.h
+ * @brief Header file for the GearInstancePool class.
+ *
+ * This file defines the GearInstancePool class, which owns the gear item
+ * instances placed in a rack and recycles them once they are removed.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearItem.h"
+
+/**
+ * @brief Owns the instances placed in a rack's slots and recycles released ones.
+ *
+ * Slots only refer to instances; the pool owns them. An instance stays in use
+ * until it is released, after which it is kept for the next instance to be
+ * acquired, along with the storage of its controls, so placing and removing
+ * units over a long session reuses the same few objects instead of
+ * allocating new ones.
+ *
+ * Instances never move and are only deleted with the pool, so a pointer to a
+ * released instance stays valid memory until the instance is reused.
+ */
+class GearInstancePool
+{
+public:
+    /**
+     * @brief Constructs an empty pool.
+     */
+    GearInstancePool() = default;
+
+    /**
+     * @brief Takes an item into the pool, reusing a released instance if there is one.
+     *
+     * @param item The item to move into the pool
+     * @return The pool's instance, in use until it is released
+     */
+    GearItem *acquire(GearItem &&item);
+
+    /**
+     * @brief Returns an instance to the pool for reuse.
+     *
+     * The instance stops waiting for its unit's schema, lets go of the unit's
+     * definition and empties its controls, keeping their storage.
+     *
+     * @param item An instance of this pool that is in use
+     */
+    void release(GearItem *item);
+
+    /**
+     * @brief Releases every instance in use that is not in a list.
+     *
+     * @param itemsStillInUse The instances to keep, such as those placed in slots
+     * @return The number of instances released
+     */
+    int releaseAllExcept(const juce::Array<GearItem *> &itemsStillInUse);
+
+    /**
+     * @brief Checks whether an item is one of the pool's instances.
+     *
+     * @param item The item to check
+     * @return true if the pool owns the item, whether in use or released
+     */
+    bool owns(const GearItem *item) const;
+
+    /**
+     * @brief Gets the number of instances in use.
+     *
+     * @return The number of instances acquired and not released
+     */
+    int getNumInUse() const { return items.size() - freeItems.size(); }
+
+    /**
+     * @brief Gets the number of instances the pool holds.
+     *
+     * @return The number of instances allocated, in use or released
+     */
+    int getNumAllocated() const { return items.size(); }
+
+    /**
+     * @brief Gets the memory the released instances hold while they wait for reuse.
+     *
+     * Each released instance counts the item itself, the storage of as many
+     * controls and control states as it had when released, and whatever it
+     * still refers to. Instances in use are left to the slots that hold them.
+     *
+     * @param images Counts each image once across holders
+     * @return The released instances' bytes, as pooledInstances
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
+
+private:
+    juce::OwnedArray<GearItem> items;   ///< Every instance the pool has allocated
+    juce::Array<GearItem *> freeItems;  ///< Released instances ready for reuse
+    juce::Array<int> freeControlCounts; ///< Controls each released instance had, whose storage it keeps, by index into freeItems
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearInstancePool)
+};
@@ -26,29 +26,49 @@ bool GearItem::loadImage()
     if (image.isValid())
         return true;
 
+    image = loadThumbnail(unitId, thumbnailImage, name, category, *networkFetcher, *fileSystem, *cacheManager);
+    return image.isValid();
+}
+
+/**
+ * @brief Loads a unit's thumbnail from the cache or the network.
+ *
+ * Needs only the fields the thumbnail depends on, so it can run on a
+ * background thread without a GearItem.
+ *
+ * @param unitId The unit the thumbnail belongs to
+ * @param thumbnailPath Path or URL of the thumbnail
+ * @param name Display name, whose first letter the placeholder shows
+ * @param category Category, which colours the placeholder
+ * @param networkFetcher Fetches remote thumbnails
+ * @param fileSystem Resolves the thumbnail's file name
+ * @param cacheManager Holds cached thumbnails and receives downloaded ones
+ * @return The thumbnail, or a placeholder if it could not be loaded
+ */
+juce::Image GearItem::loadThumbnail(const juce::String &unitId, const juce::String &thumbnailPath, const juce::String &name,
+                                    GearCategory category, INetworkFetcher &networkFetcher, IFileSystem &fileSystem,
+                                    CacheManager &cacheManager)
+{
     // If no thumbnail specified, use placeholder
-    if (thumbnailImage.isEmpty())
-        return createPlaceholderImage();
+    if (thumbnailPath.isEmpty())
+        return createPlaceholderThumbnail(name, category);
 
     // Extract filename from thumbnail path
-    juce::String filename = fileSystem.getFileName(thumbnailImage);
+    juce::String filename = fileSystem.getFileName(thumbnailPath);
 
     // Check cache first using the injected cache manager
     if (cacheManager.isThumbnailCached(unitId, filename))
     {
         juce::Image cachedImage = cacheManager.loadThumbnailFromCache(unitId, filename);
         if (cachedImage.isValid())
-        {
-            image = cachedImage;
-            return true;
-        }
+            return cachedImage;
     }
 
     // Check if the thumbnail is a remote path
-    if (thumbnailImage.startsWith("assets/") || thumbnailImage.startsWith("http"))
+    if (thumbnailPath.startsWith("assets/") || thumbnailPath.startsWith("http"))
     {
         // Determine the full URL using the helper method
-        juce::String imageUrl = GearLibrary::getFullUrl(thumbnailImage);
+        juce::String imageUrl = GearLibrary::getFullUrl(thumbnailPath);
 
         // Create URL object for the image
         juce::URL url(imageUrl);
@@ -59,6 +79,8 @@ bool GearItem::loadImage()
 
         if (success && imageData.getSize() > 0)
         {
+            juce::Image downloaded;
+
             // Create image from the memory block
             juce::MemoryInputStream inputStream(imageData, false);
             juce::JPEGImageFormat jpegFormat;
@@ -68,7 +90,7 @@ bool GearItem::loadImage()
             if (jpegFormat.canUnderstand(inputStream))
             {
                 inputStream.setPosition(0);
-                image = jpegFormat.decodeImage(inputStream);
+                downloaded = jpegFormat.decodeImage(inputStream);
             }
             else
             {
@@ -76,28 +98,21 @@ bool GearItem::loadImage()
                 if (pngFormat.canUnderstand(inputStream))
                 {
                     inputStream.setPosition(0);
-                    image = pngFormat.decodeImage(inputStream);
+                    downloaded = pngFormat.decodeImage(inputStream);
                 }
             }
 
-            // If successfully loaded image, cache it and return true
-            if (image.isValid())
+            // If successfully loaded image, cache it and return it
+            if (downloaded.isValid())
             {
-                cacheManager.saveThumbnailToCache(unitId, filename, image);
-
-                // Clear the temporary image data to free memory
-                imageData = juce::MemoryBlock();
-
-                return true;
+                cacheManager.saveThumbnailToCache(unitId, filename, downloaded);
+                return downloaded;
             }
-
-            // Clear the temporary image data even if image loading failed
-            imageData = juce::MemoryBlock();
         }
     }
 
     // If we get here, loading the actual image failed, so create a placeholder
-    return createPlaceholderImage();
+    return createPlaceholderThumbnail(name, category);
 }
 
 /**
@@ -109,10 +124,23 @@ bool GearItem::loadImage()
  * @return true if placeholder was successfully created
  */
 bool GearItem::createPlaceholderImage()
+{
+    image = createPlaceholderThumbnail(name, category);
+    return true;
+}
+
+/**
+ * @brief Draws the placeholder thumbnail of a unit.
+ *
+ * @param name Display name, whose first letter is drawn
+ * @param category Category, which picks the colour
+ * @return The placeholder image
+ */
+juce::Image GearItem::createPlaceholderThumbnail(const juce::String &name, GearCategory category)
 {
     // Create a placeholder colored image based on category
-    image = juce::Image(juce::Image::ARGB, 24, 24, true);
-    juce::Graphics g(image);
+    juce::Image placeholder(juce::Image::ARGB, 24, 24, true);
+    juce::Graphics g(placeholder);
 
     // Use different colors for different categories
     switch (category)
@@ -140,7 +168,162 @@ bool GearItem::createPlaceholderImage()
     g.drawText(name.substring(0, 1).toUpperCase(),
                0, 0, 24, 24, juce::Justification::centred);
 
-    return true;
+    return placeholder;
+}
+
+/**
+ * @brief Gets the faceplate image, which belongs to the unit's definition.
+ *
+ * @return The faceplate, or an invalid image if it has not been loaded
+ */
+const juce::Image &GearItem::getFaceplateImage() const
+{
+    static const juce::Image noFaceplate;
+    return definition != nullptr ? definition->faceplateImage : noFaceplate;
+}
+
+/**
+ * @brief Replaces the controls with the ones the definition's schema defines.
+ *
+ * Copying a control copies its image handles, not the pixels, so every
+ * instance draws from the definition's decoded assets. The controls are
+ * copied into the array's existing storage, which a recycled instance keeps.
+ */
+void GearItem::useDefinitionControls()
+{
+    if (definition == nullptr)
+        return;
+
+    controls.clearQuick();
+    controls.addArray(definition->controls);
+    resetControlStates();
+}
+
+/**
+ * @brief Refers the controls to the decoded assets the definition holds now.
+ *
+ * Controls are matched by position and ID, so controls an instance does not
+ * share with the schema keep their own images.
+ */
+void GearItem::useDefinitionAssets()
+{
+    if (definition == nullptr)
+        return;
+
+    const int numShared = juce::jmin(controls.size(), definition->controls.size());
+    for (int i = 0; i < numShared; ++i)
+    {
+        const auto &source = definition->controls.getReference(i);
+        auto &control = controls.getReference(i);
+        if (control.id != source.id)
+            continue;
+
+        control.loadedImage = source.loadedImage;
+    }
+}
+
+/**
+ * @brief Gets the memory the instance refers to.
+ *
+ * The faceplate and control images usually belong to the unit's definition,
+ * so they are only counted here if no other holder passed them to the
+ * counter first.
+ */
+MemoryUsage GearItem::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    MemoryUsage usage;
+    usage.faceplates = images.count(getFaceplateImage());
+    usage.thumbnails = images.count(image);
+
+    // The state a preset saves for the instance, and the controls it is kept for
+    usage.presetData = (juce::int64)controlStates.size() * (juce::int64)sizeof(GearControl::State)
+                       + MemoryUsage::getStringBytes(instanceId) + MemoryUsage::getStringBytes(sourceUnitId);
+
+    for (const auto &control : controls)
+    {
+        usage.controlImages += images.count(control.loadedImage);
+        usage.presetData += control.getRecordBytes();
+    }
+
+    return usage;
+}
+
+/**
+ * @brief Gets the state a control of this item is in.
+ *
+ * Controls added to the array directly have no state until one is set, so
+ * they report the state their schema gives them.
+ */
+GearControl::State GearItem::getControlState(int controlIndex) const
+{
+    if (!juce::isPositiveAndBelow(controlIndex, controls.size()))
+        return {};
+
+    if (controlIndex < controlStates.size())
+        return controlStates.getReference(controlIndex);
+
+    return controls.getReference(controlIndex).getInitialState();
+}
+
+/**
+ * @brief Sets the state of a control of this item.
+ */
+void GearItem::setControlState(int controlIndex, const GearControl::State &state)
+{
+    if (!juce::isPositiveAndBelow(controlIndex, controls.size()))
+        return;
+
+    matchControlStatesToControls();
+    controlStates.getReference(controlIndex) = state;
+}
+
+/**
+ * @brief Sets the current value of a control of this item.
+ */
+void GearItem::setControlValue(int controlIndex, float value)
+{
+    if (!juce::isPositiveAndBelow(controlIndex, controls.size()))
+        return;
+
+    matchControlStatesToControls();
+    controlStates.getReference(controlIndex).value = value;
+}
+
+/**
+ * @brief Sets the selected option of a switch or button of this item.
+ */
+void GearItem::setControlCurrentIndex(int controlIndex, int currentIndex)
+{
+    if (!juce::isPositiveAndBelow(controlIndex, controls.size()))
+        return;
+
+    matchControlStatesToControls();
+    controlStates.getReference(controlIndex).currentIndex = currentIndex;
+}
+
+/**
+ * @brief Puts every control back in the state its schema gives it.
+ *
+ * The states are rewritten into the array's existing storage, which a
+ * recycled instance keeps.
+ */
+void GearItem::resetControlStates()
+{
+    controlStates.clearQuick();
+    matchControlStatesToControls();
+}
+
+/**
+ * @brief Grows or shrinks the control states to one per control.
+ */
+void GearItem::matchControlStatesToControls()
+{
+    if (controlStates.size() > controls.size())
+        controlStates.removeLast(controlStates.size() - controls.size());
+
+    controlStates.ensureStorageAllocated(controls.size());
+    for (int i = controlStates.size(); i < controls.size(); ++i)
+        controlStates.add(controls.getReference(i).getInitialState());
 }
 
 /**
@@ -153,29 +336,11 @@ bool GearItem::createPlaceholderImage()
  */
 void GearItem::createInstance(const juce::String &sourceUnitId)
 {
-    // Store current state
-    juce::Array<GearControl> currentControls = controls;
-    juce::String currentInstanceId = instanceId;
-    bool wasInstance = isInstance;
-    juce::String currentSourceUnitId = sourceUnitId;
-
-    // Set up as a new instance
+    // Only the identity changes: the controls keep their current and initial
+    // values in place, whether or not this was already an instance
     this->sourceUnitId = sourceUnitId;
     this->isInstance = true;
     this->instanceId = juce::Uuid().toString(); // Generate a new unique ID
-
-    // If we were already an instance, we need to preserve our current state
-    if (wasInstance)
-    {
-        // Restore our current control values
-        controls = currentControls;
-        // Don't update initial values when recreating an instance
-    }
-    else
-    {
-        // For new instances, preserve the initial values from schema
-        // Don't overwrite initialValue - it should remain as the schema default
-    }
 }
 
 /**
@@ -191,10 +356,7 @@ void GearItem::resetToSource()
 
     // Reset the instance to match its source
     // Reset all control values to their initial values
-    for (auto &control : controls)
-    {
-        control.value = control.initialValue;
-    }
+    resetControlStates();
 
     // Do not clear instance state here. Users can have multiple instances of the
     // same gear item in the rack. Their uniqueness is determined by the instanceId.
@@ -260,8 +422,9 @@ void GearItem::saveToJSON(const juce::String &filePath)
 
     // Add controls as an array
     juce::Array<juce::var> controlsArray;
-    for (const auto &control : controls)
+    for (int i = 0; i < controls.size(); ++i)
     {
+        const auto &control = controls.getReference(i);
         juce::DynamicObject::Ptr controlObj = new juce::DynamicObject();
 
         // Convert control type to string
@@ -290,7 +453,7 @@ void GearItem::saveToJSON(const juce::String &filePath)
         posObj->setProperty("height", control.position.getHeight());
 
         controlObj->setProperty("position", posObj.get());
-        controlObj->setProperty("value", control.value);
+        controlObj->setProperty("value", getControlValue(i));
 
         controlsArray.add(controlObj.get());
     }
@@ -302,7 +465,7 @@ void GearItem::saveToJSON(const juce::String &filePath)
     juce::String jsonString = juce::JSON::toString(jsonVar);
 
     // Write to file using the injected file system
-    fileSystem.writeFile(filePath, jsonString);
+    fileSystem->writeFile(filePath, jsonString);
 }
 
 /**
@@ -403,8 +566,8 @@ GearItem GearItem::loadFromJSON(const juce::String &filePath, INetworkFetcher &n
 
             // Create control and add to array
             GearControl control(controlType, controlName, position);
-            control.value = controlVar.getProperty("value", 0.0f);
-            controls.add(control);
+            control.initialValue = controlVar.getProperty("value", 0.0f);
+            controls.add(std::move(control));
         }
         // Clear the temporary array reference to release memory
         controlsArray = nullptr;
@@ -412,7 +575,7 @@ GearItem GearItem::loadFromJSON(const juce::String &filePath, INetworkFetcher &n
 
     // Create and return the gear item with the new constructor
     GearItem item(unitId, name, manufacturer, categoryStr, version, schemaPath,
-                  thumbnailImage, tags, networkFetcher, fileSystem, CacheManager::getDummy(), type, category, slotSize, controls);
+                  thumbnailImage, std::move(tags), networkFetcher, fileSystem, CacheManager::getDummy(), type, category, slotSize, std::move(controls));
 
     // Image will be loaded on-demand when first accessed
     return item;
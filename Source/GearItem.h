@@ -3,8 +3,8 @@
  * @brief Header file for the GearItem class and related components.
  *
  * This file defines the GearItem class and its supporting classes for managing
- * audio gear items in the plugin. It includes definitions for gear types,
- * categories, and controls.
+ * audio gear items in the plugin. It includes definitions for gear types
+ * and categories.
  */
 
 #pragma once
@@ -14,6 +14,9 @@
 #include "IFileSystem.h"
 #include "FileSystem.h"
 #include "CacheManager.h"
+#include "GearControl.h"
+#include "GearDefinition.h"
+#include "MemoryUsage.h"
 
 /**
  * @brief Enumeration of possible gear types.
@@ -43,194 +46,6 @@ enum class GearCategory
     Other       ///< Other category
 };
 
-/**
- * @brief Class representing a control on a piece of gear.
- *
- * This class defines the properties and behavior of controls
- * such as knobs, faders, switches, and buttons on audio gear.
- */
-class GearControl
-{
-public:
-    /**
-     * @brief Structure defining a frame in a switch or button sprite sheet.
-     *
-     * Contains position and size information for a single frame
-     * in a multi-state control's sprite sheet.
-     */
-    struct SwitchOptionFrame
-    {
-        int x = 0;          ///< X position in sprite sheet
-        int y = 0;          ///< Y position in sprite sheet
-        int width = 0;      ///< Frame width
-        int height = 0;     ///< Frame height
-        juce::String value; ///< Value associated with this frame
-        juce::String label; ///< Display label for this frame
-    };
-
-    /**
-     * @brief Enumeration of control types.
-     *
-     * Defines the different types of controls that can be
-     * represented in the system.
-     */
-    enum class Type
-    {
-        Button, ///< Push button control
-        Fader,  ///< Slider/fader control
-        Switch, ///< Toggle switch control
-        Knob    ///< Rotary knob control
-    };
-
-    /**
-     * @brief Default constructor.
-     *
-     * Initializes a control with default values.
-     */
-    GearControl()
-        : type(Type::Button),
-          name(""),
-          id(""),
-          position(0.0f, 0.0f, 0.0f, 0.0f),
-          value(0.0f),
-          initialValue(0.0f),
-          currentIndex(0),
-          orientation("vertical"),
-          startAngle(0.0f),
-          endAngle(360.0f),
-          currentStepIndex(0),
-          length(100),
-          momentary(false)
-    {
-    }
-
-    /**
-     * @brief Destructor.
-     *
-     * Cleans up any loaded images to prevent memory leaks.
-     */
-    ~GearControl()
-    {
-        loadedImage = juce::Image();
-        switchSpriteSheet = juce::Image();
-        faderImage = juce::Image();
-        buttonSpriteSheet = juce::Image();
-    }
-
-    /**
-     * @brief Constructor with basic parameters.
-     *
-     * @param typeParam The type of control
-     * @param nameParam The name of the control
-     * @param positionParam The position and size of the control
-     */
-    GearControl(Type typeParam, const juce::String &nameParam, const juce::Rectangle<float> &positionParam)
-        : type(typeParam),
-          name(nameParam),
-          position(positionParam),
-          value(0.0f),
-          initialValue(0.0f),
-          momentary(false) {}
-
-    /**
-     * @brief Copy constructor.
-     *
-     * @param other The control to copy from
-     */
-    GearControl(const GearControl &other)
-        : type(other.type),
-          name(other.name),
-          id(other.id),
-          position(other.position),
-          value(other.value),
-          initialValue(other.value),
-          options(other.options),
-          currentIndex(other.currentIndex),
-          orientation(other.orientation),
-          image(other.image),
-          startAngle(other.startAngle),
-          endAngle(other.endAngle),
-          steps(other.steps),
-          currentStepIndex(other.currentStepIndex),
-          loadedImage(other.loadedImage),
-          switchFrames(other.switchFrames),
-          switchSpriteSheet(other.switchSpriteSheet),
-          length(other.length),
-          faderImage(other.faderImage),
-          momentary(other.momentary),
-          buttonFrames(other.buttonFrames),
-          buttonSpriteSheet(other.buttonSpriteSheet)
-    {
-    }
-
-    /**
-     * @brief Assignment operator.
-     *
-     * @param other The control to assign from
-     * @return Reference to this control
-     */
-    GearControl &operator=(const GearControl &other)
-    {
-        if (this != &other)
-        {
-            type = other.type;
-            name = other.name;
-            id = other.id;
-            position = other.position;
-            value = other.value;
-            initialValue = other.initialValue;
-            options = other.options;
-            currentIndex = other.currentIndex;
-            orientation = other.orientation;
-            image = other.image;
-            startAngle = other.startAngle;
-            endAngle = other.endAngle;
-            steps = other.steps;
-            currentStepIndex = other.currentStepIndex;
-            loadedImage = other.loadedImage;
-            switchFrames = other.switchFrames;
-            switchSpriteSheet = other.switchSpriteSheet;
-            length = other.length;
-            faderImage = other.faderImage;
-            momentary = other.momentary;
-            buttonFrames = other.buttonFrames;
-            buttonSpriteSheet = other.buttonSpriteSheet;
-        }
-        return *this;
-    }
-
-    Type type;                       ///< The type of control
-    juce::String name;               ///< The name of the control
-    juce::String id;                 ///< Unique identifier for the control
-    juce::Rectangle<float> position; ///< Position and size of the control
-    float value;                     ///< Current value of the control
-    float initialValue;              ///< Original value from schema
-
-    // Additional properties for switches
-    juce::StringArray options;                   ///< Available options for switch
-    int currentIndex = 0;                        ///< Current selected option index
-    juce::String orientation = "vertical";       ///< Control orientation
-    juce::String image;                          ///< URI to the sprite sheet image
-    juce::Array<SwitchOptionFrame> switchFrames; ///< Frame data for switch positions
-    juce::Image switchSpriteSheet;               ///< Loaded sprite sheet for switches
-
-    // Additional properties for knobs
-    float startAngle = 0.0f;  ///< Starting angle in degrees
-    float endAngle = 360.0f;  ///< Ending angle in degrees
-    juce::Array<float> steps; ///< Rotation degrees for stepped knobs
-    int currentStepIndex = 0; ///< Current step index
-    juce::Image loadedImage;  ///< Loaded knob image
-
-    // Additional properties for faders
-    int length = 100;       ///< Length of fader track in pixels
-    juce::Image faderImage; ///< Loaded fader image
-
-    // Additional properties for buttons
-    bool momentary = false;                      ///< Whether button is momentary
-    juce::Array<SwitchOptionFrame> buttonFrames; ///< Frame data for button states
-    juce::Image buttonSpriteSheet;               ///< Loaded sprite sheet for buttons
-};
-
 /**
  * @brief Class representing a piece of audio gear.
  *
@@ -260,9 +75,9 @@ public:
           controls(),
           isInstance(false),
           sourceUnitId(""),
-          networkFetcher(INetworkFetcher::getDummy()),
-          fileSystem(FileSystem::getDummy()),
-          cacheManager(CacheManager::getDummy())
+          networkFetcher(&INetworkFetcher::getDummy()),
+          fileSystem(&FileSystem::getDummy()),
+          cacheManager(&CacheManager::getDummy())
     {
     }
 
@@ -280,22 +95,12 @@ public:
         {
             image = juce::Image();
         }
-        if (faceplateImage.isValid())
-        {
-            faceplateImage = juce::Image();
-        }
 
         // Clear images in controls with validation
         for (auto &control : controls)
         {
             if (control.loadedImage.isValid())
                 control.loadedImage = juce::Image();
-            if (control.switchSpriteSheet.isValid())
-                control.switchSpriteSheet = juce::Image();
-            if (control.faderImage.isValid())
-                control.faderImage = juce::Image();
-            if (control.buttonSpriteSheet.isValid())
-                control.buttonSpriteSheet = juce::Image();
         }
 
         // Clear the controls array completely to release any internal references
@@ -303,9 +108,6 @@ public:
 
         // Clear string arrays that might hold references
         tags.clear();
-
-        // Force a small delay to allow JUCE internal cleanup
-        juce::Thread::sleep(1);
     }
 
     /**
@@ -318,14 +120,14 @@ public:
      * @param versionParam The version of the gear item
      * @param schemaPathParam The path to the schema file
      * @param thumbnailImageParam The path to the thumbnail image
-     * @param tagsParam The tags associated with the gear item
+     * @param tagsParam The tags associated with the gear item, moved in when passed as a temporary
      * @param networkFetcherParam The network fetcher to use for loading resources
      * @param fileSystemParam The file system to use for file operations
      * @param cacheManagerParam The cache manager to use for caching operations
      * @param typeParam The type of gear
      * @param gearCategoryParam The category of gear
      * @param slotSizeParam The size of the slot required
-     * @param controlsParam The controls available on the gear
+     * @param controlsParam The controls available on the gear, moved in when passed as a temporary
      */
     GearItem(const juce::String &unitIdParam,
              const juce::String &nameParam,
@@ -334,14 +136,14 @@ public:
              const juce::String &versionParam,
              const juce::String &schemaPathParam,
              const juce::String &thumbnailImageParam,
-             const juce::StringArray &tagsParam,
+             juce::StringArray tagsParam,
              INetworkFetcher &networkFetcherParam,
              IFileSystem &fileSystemParam,
              CacheManager &cacheManagerParam,
              GearType typeParam = GearType::Other,
              GearCategory gearCategoryParam = GearCategory::Other,
              int slotSizeParam = 1,
-             const juce::Array<GearControl> &controlsParam = {})
+             juce::Array<GearControl> controlsParam = {})
         : unitId(unitIdParam),
           name(nameParam),
           manufacturer(manufacturerParam),
@@ -352,31 +154,59 @@ public:
           schemaPath(schemaPathParam),
           thumbnailImage(thumbnailImageParam),
           categoryString(categoryParam),
-          tags(tagsParam),
-          controls(controlsParam),
-          networkFetcher(networkFetcherParam),
-          fileSystem(fileSystemParam),
-          cacheManager(cacheManagerParam)
+          tags(std::move(tagsParam)),
+          controls(std::move(controlsParam)),
+          networkFetcher(&networkFetcherParam),
+          fileSystem(&fileSystemParam),
+          cacheManager(&cacheManagerParam)
     {
         // Map category string to enum (for backward compatibility)
-        if (categoryString == "equalizer" || categoryString == "eq")
-            category = GearCategory::EQ;
-        else if (categoryString == "compressor")
-            category = GearCategory::Compressor;
-        else if (categoryString == "preamp")
-            category = GearCategory::Preamp;
-        else
-            category = GearCategory::Other;
+        category = getCategoryFromString(categoryString);
 
         // Try to determine type from tags
-        if (tags.contains("500 series"))
-            type = GearType::Series500;
-        else if (tags.contains("rack") || tags.contains("19 inch"))
-            type = GearType::Rack19Inch;
+        type = getTypeFromTags(tags, type);
+
+        // Controls start at their schema values
+        resetControlStates();
 
         // Image will be loaded on-demand when first accessed
     }
 
+    /**
+     * @brief Maps a category string to the category enum.
+     *
+     * @param categoryString The category string from the schema
+     * @return The matching category, or GearCategory::Other
+     */
+    static GearCategory getCategoryFromString(const juce::String &categoryString)
+    {
+        if (categoryString == "equalizer" || categoryString == "eq")
+            return GearCategory::EQ;
+        if (categoryString == "compressor")
+            return GearCategory::Compressor;
+        if (categoryString == "preamp")
+            return GearCategory::Preamp;
+
+        return GearCategory::Other;
+    }
+
+    /**
+     * @brief Determines the gear type from an item's tags.
+     *
+     * @param tags The tags of the item
+     * @param fallback The type to use if no tag names one
+     * @return The gear type
+     */
+    static GearType getTypeFromTags(const juce::StringArray &tags, GearType fallback)
+    {
+        if (tags.contains("500 series"))
+            return GearType::Series500;
+        if (tags.contains("rack") || tags.contains("19 inch"))
+            return GearType::Rack19Inch;
+
+        return fallback;
+    }
+
     // Instance management fields
     juce::String instanceId;   ///< Unique identifier for this instance
     bool isInstance = false;   ///< Whether this is an instance of another item
@@ -400,11 +230,112 @@ public:
     juce::String categoryString;
     juce::StringArray tags;
     juce::Image image;
-    juce::String faceplateImagePath;
-    juce::Image faceplateImage;
     juce::Array<GearControl> controls;
 
+    // Schema data shared with every other instance of the unit
+    GearDefinition::Ptr definition; ///< The unit's definition, once the rack has placed it
+
+    /**
+     * @brief Gets the faceplate image, which belongs to the unit's definition.
+     *
+     * @return The faceplate, or an invalid image if it has not been loaded
+     */
+    const juce::Image &getFaceplateImage() const;
+
+    /**
+     * @brief Replaces the controls with the ones the definition's schema defines.
+     *
+     * The controls start at their schema values and refer to the definition's
+     * decoded assets rather than copying them.
+     */
+    void useDefinitionControls();
+
+    /**
+     * @brief Refers the controls to the decoded assets the definition holds now.
+     *
+     * Called as the definition's assets finish loading.
+     */
+    void useDefinitionAssets();
+
+    /**
+     * @brief Gets the memory the instance refers to.
+     *
+     * @param images Counts each image once, so assets other holders reported already add nothing
+     * @return The faceplate, thumbnail and control images and the instance's control state
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
+
+    /**
+     * @brief Gets the state a control of this item is in.
+     *
+     * @param controlIndex Index into controls
+     * @return The control's state, its schema state if it has not been set, or a default state for a bad index
+     */
+    GearControl::State getControlState(int controlIndex) const;
+
+    /**
+     * @brief Gets the current value of a control of this item.
+     *
+     * @param controlIndex Index into controls
+     * @return The value, or 0 for a bad index
+     */
+    float getControlValue(int controlIndex) const { return getControlState(controlIndex).value; }
+
+    /**
+     * @brief Gets the selected option of a switch or button of this item.
+     *
+     * @param controlIndex Index into controls
+     * @return The option index, or 0 for a bad index
+     */
+    int getControlCurrentIndex(int controlIndex) const { return getControlState(controlIndex).currentIndex; }
+
+    /**
+     * @brief Sets the state of a control of this item.
+     *
+     * @param controlIndex Index into controls; bad indices are ignored
+     * @param state The new state
+     */
+    void setControlState(int controlIndex, const GearControl::State &state);
+
+    /**
+     * @brief Sets the current value of a control of this item.
+     *
+     * @param controlIndex Index into controls; bad indices are ignored
+     * @param value The new value
+     */
+    void setControlValue(int controlIndex, float value);
+
+    /**
+     * @brief Sets the selected option of a switch or button of this item.
+     *
+     * @param controlIndex Index into controls; bad indices are ignored
+     * @param currentIndex The new option index
+     */
+    void setControlCurrentIndex(int controlIndex, int currentIndex);
+
+    /**
+     * @brief Puts every control back in the state its schema gives it.
+     */
+    void resetControlStates();
+
     bool loadImage();
+
+    /**
+     * @brief Loads a unit's thumbnail from the cache or the network, without a GearItem.
+     *
+     * @param unitId The unit the thumbnail belongs to
+     * @param thumbnailPath Path or URL of the thumbnail
+     * @param name Display name, whose first letter the placeholder shows
+     * @param category Category, which colours the placeholder
+     * @param networkFetcher Fetches remote thumbnails
+     * @param fileSystem Resolves the thumbnail's file name
+     * @param cacheManager Holds cached thumbnails and receives downloaded ones
+     * @return The thumbnail, or a placeholder if it could not be loaded
+     */
+    static juce::Image loadThumbnail(const juce::String &unitId, const juce::String &thumbnailPath, const juce::String &name,
+                                     GearCategory category, INetworkFetcher &networkFetcher, IFileSystem &fileSystem,
+                                     CacheManager &cacheManager);
+
     void saveToJSON(const juce::String &filePath);
     static GearItem loadFromJSON(const juce::String &filePath, INetworkFetcher &networkFetcher, IFileSystem &fileSystem);
 
@@ -433,21 +364,68 @@ public:
           slotSize(other.slotSize),
           controls(other.controls),
           image(other.image),
-          faceplateImage(other.faceplateImage),
+          definition(other.definition),
           isInstance(false),            // New instances start as non-instances
           instanceId(juce::String()),   // New instances get a new ID
           sourceUnitId(juce::String()), // New instances start with no source
-          networkFetcher(networkFetcherParam),
-          fileSystem(fileSystemParam),
-          cacheManager(cacheManagerParam)
+          networkFetcher(&networkFetcherParam),
+          fileSystem(&fileSystemParam),
+          cacheManager(&cacheManagerParam),
+          controlStates(other.controlStates)
     {
         // Image will be loaded on-demand when first accessed
     }
 
+    /**
+     * @brief Copy constructor.
+     *
+     * Copies everything, including the instance state and the services.
+     *
+     * @param other The GearItem to copy from
+     */
+    GearItem(const GearItem &other) = default;
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the other item's strings, controls and images without
+     * allocating, so items can be returned and stored without deep copies.
+     *
+     * @param other The GearItem to move from
+     */
+    GearItem(GearItem &&other) noexcept = default;
+
+    /**
+     * @brief Assignment operator.
+     *
+     * @param other The GearItem to assign from
+     * @return Reference to this item
+     */
+    GearItem &operator=(const GearItem &other) = default;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param other The GearItem to move from
+     * @return Reference to this item
+     */
+    GearItem &operator=(GearItem &&other) noexcept = default;
+
 private:
-    INetworkFetcher &networkFetcher;
-    IFileSystem &fileSystem;
-    CacheManager &cacheManager;
+    // Held by pointer so items can be assigned and moved
+    INetworkFetcher *networkFetcher;
+    IFileSystem *fileSystem;
+    CacheManager *cacheManager;
+
+    // Values of the controls, kept together so instances differ only here
+    juce::Array<GearControl::State> controlStates; ///< State of each control, by index into controls
+
+    /**
+     * @brief Grows or shrinks the control states to one per control.
+     *
+     * Controls added since the states were last set start at their schema state.
+     */
+    void matchControlStatesToControls();
 
     /**
      * @brief Creates a placeholder image for the gear item.
@@ -458,4 +436,13 @@ private:
      * @return true if placeholder was successfully created
      */
     bool createPlaceholderImage();
+
+    /**
+     * @brief Draws the placeholder thumbnail of a unit.
+     *
+     * @param name Display name, whose first letter is drawn
+     * @param category Category, which picks the colour
+     * @return The placeholder image
+     */
+    static juce::Image createPlaceholderThumbnail(const juce::String &name, GearCategory category);
 };
\ No newline at end of file
@@ -39,10 +39,48 @@ GearLibrary::GearLibrary(INetworkFetcher &networkFetcher, IFileSystem &fileSyste
     searchBox.onTextChange = [this]
     {
         currentSearchText = searchBox.getText().trim().toLowerCase();
-        updateFilteredItems();
+        normalizedSearchText = GearCatalogue::normalizeForSearch(currentSearchText);
+        searchWords = GearSearchRanker::splitIntoWords(currentSearchText, [](const juce::String &word)
+                                                       { return GearCatalogue::normalizeForSearch(word); });
+
+        // Clearing the search is instant; typed queries are matched in the background
+        if (currentSearchText.isEmpty())
+            updateFilteredItems();
+        else
+            searchWorker.search(catalogue.getSearchIndex(), normalizedSearchText, searchWords, getFacetMask());
+    };
+    searchWorker.onResult = [this](const GearSearchWorker::Result &result)
+    {
+        if (result.query == normalizedSearchText && currentSearchText.isNotEmpty())
+        {
+            auto textMatches = GearFacetIndex::toBits(result.fuzzy ? result.matches : result.exactMatches);
+            facetResult = catalogue.getFacetIndex().filter(facetFilter, &textMatches);
+            showFilteredItems(result.matches);
+        }
     };
     addAndMakeVisible(searchBox);
 
+    catalogueLoader.onLoaded = [this](std::unique_ptr<GearCatalogue> loaded)
+    {
+        handleCatalogueLoaded(std::move(loaded));
+    };
+
+    thumbnailLoader.onLoaded = [this](int index, const juce::Image &thumbnail)
+    {
+        thumbnails.set(index, thumbnail);
+
+        // Repaints are coalesced, so a batch of thumbnails costs one paint of the visible rows
+        if (gearTreeView != nullptr)
+            gearTreeView->repaint();
+    };
+
+    // Rows painted while a cancelled load ran request their thumbnail again when repainted
+    thumbnailLoader.onStaleResultDropped = [this]
+    {
+        if (gearTreeView != nullptr)
+            gearTreeView->repaint();
+    };
+
     // Set up refresh button with Unicode character (adjusted settings)
     refreshButton.setColour(juce::DrawableButton::backgroundColourId, juce::Colours::darkgrey);
     refreshButton.setColour(juce::DrawableButton::backgroundOnColourId, juce::Colours::darkgrey.brighter(0.2f));
@@ -78,6 +116,9 @@ GearLibrary::GearLibrary(INetworkFetcher &networkFetcher, IFileSystem &fileSyste
 
     // Don't load initial data automatically - let the plugin load it when ready
     // loadLibrary();
+
+    // A bundled index is refreshed from the network after it has been served
+    networkFetcher.addListener(this);
 }
 
 /**
@@ -87,6 +128,18 @@ GearLibrary::GearLibrary(INetworkFetcher &networkFetcher, IFileSystem &fileSyste
  */
 GearLibrary::~GearLibrary()
 {
+    networkFetcher.removeListener(this);
+
+    catalogueLoader.onLoaded = nullptr;
+    catalogueLoader.cancel();
+
+    thumbnailLoader.onLoaded = nullptr;
+    thumbnailLoader.onStaleResultDropped = nullptr;
+    thumbnailLoader.cancelAll();
+
+    searchWorker.onResult = nullptr;
+    searchWorker.cancel();
+
     // Important: set root item to null before the TreeView is deleted
     gearTreeView->setRootItem(nullptr);
 }
@@ -126,193 +179,171 @@ void GearLibrary::resized()
 }
 
 /**
- * @brief Gets the list of characters to ignore during search.
+ * @brief Gets the facet entries the current filter allows, for the search worker.
  *
- * @return Array of characters that should be ignored during fuzzy matching
+ * @return The allowed entries, or nullptr if the filter is inactive
  */
-juce::Array<juce::juce_wchar> GearLibrary::getIgnoredCharacters()
+std::shared_ptr<const juce::BigInteger> GearLibrary::getFacetMask() const
 {
-    return {
-        '-',  // Hyphens (e.g., "LA-2A" matches "la2a")
-        ' ',  // Spaces (e.g., "Tube Compressor" matches "tubecompressor")
-        '_',  // Underscores
-        '.',  // Dots
-        '(',  // Parentheses
-        ')',  // Parentheses
-        '[',  // Brackets
-        ']',  // Brackets
-        '/',  // Forward slashes
-        '\\', // Backward slashes
-        '&',  // Ampersands
-        '+',  // Plus signs
-        '=',  // Equals signs
-        '#'   // Hash symbols
-    };
+    if (!facetFilter.isActive())
+        return nullptr;
+
+    return std::make_shared<const juce::BigInteger>(catalogue.getFacetIndex().getMatches(facetFilter));
 }
 
 /**
- * @brief Normalizes text for fuzzy search by removing ignored characters.
+ * @brief Determines if a gear item should be shown based on current search.
+ *
+ * Matches the normalised search text against the item's prebuilt search key,
+ * so no per-item normalisation happens while typing.
  *
- * @param text The text to normalize
- * @return The normalized text (lowercase with ignored characters removed)
+ * @param itemIndex Index of the gear item to check
+ * @return true if the item should be shown
  */
-juce::String GearLibrary::normalizeForSearch(const juce::String &text) const
+bool GearLibrary::shouldShowItem(int itemIndex) const
 {
-    juce::String normalized = text.toLowerCase();
-    auto ignoredChars = getIgnoredCharacters();
-
-    // Build a string of characters to remove
-    juce::String charsToRemove;
-    for (auto ignoredChar : ignoredChars)
-    {
-        charsToRemove += ignoredChar;
-    }
+    // If no search text, show all items
+    if (currentSearchText.isEmpty())
+        return true;
 
-    // Remove all ignored characters at once
-    normalized = normalized.removeCharacters(charsToRemove);
+    return catalogue.getSearchIndex()->matches(itemIndex, normalizedSearchText);
+}
 
-    return normalized;
+/**
+ * @brief Finds the items matching a search string.
+ *
+ * Candidates come from the trigram index, so only items sharing every
+ * trigram of the query are checked.
+ *
+ * @param searchText The text typed by the user
+ * @return Indices of the matching items, in library order
+ */
+juce::Array<int> GearLibrary::findMatchingItems(const juce::String &searchText) const
+{
+    return catalogue.getSearchIndex()->find(GearCatalogue::normalizeForSearch(searchText.trim()));
 }
 
 /**
- * @brief Determines if a gear item should be shown based on current search.
+ * @brief Finds the items matching a search string and a facet filter.
  *
- * Checks search text to determine if an item should be visible in the current view.
- * Uses fuzzy matching to ignore common separators and special characters.
+ * The facet bitsets are combined first, then the text matches are kept
+ * only where their bit is set.
  *
- * @param item The gear item to check
- * @return true if the item should be shown
+ * @param searchText The text typed by the user; empty matches every item
+ * @param filter The facet values to filter by
+ * @return Indices of the matching items, in library order
  */
-bool GearLibrary::shouldShowItem(const GearItem &item) const
+juce::Array<int> GearLibrary::findMatchingItems(const juce::String &searchText, const GearFacetIndex::Filter &filter) const
 {
-    // Check the search text
-    if (!currentSearchText.isEmpty())
-    {
-        // Normalize the search term
-        juce::String normalizedSearch = normalizeForSearch(currentSearchText);
+    auto facetMatches = catalogue.getFacetIndex().getMatches(filter);
 
-        // Debug output
-        juce::String normalizedName = normalizeForSearch(item.name);
-        juce::String normalizedManufacturer = normalizeForSearch(item.manufacturer);
+    if (searchText.trim().isEmpty())
+        return GearFacetIndex::toIndices(facetMatches);
 
-        // Uncomment the next line for debug output
-        // juce::Logger::writeToLog("Search: '" + currentSearchText + "' -> '" + normalizedSearch + "' | Item: '" + item.name + "' -> '" + normalizedName + "' | Match: " + (normalizedName.contains(normalizedSearch) ? "YES" : "NO"));
+    return GearFacetIndex::intersect(findMatchingItems(searchText), facetMatches);
+}
 
-        bool matchesSearch = false;
+/**
+ * @brief Filters the tree by facet values, combined with the search text.
+ *
+ * @param filter The facet values to filter by; an inactive filter shows every item
+ */
+void GearLibrary::setFacetFilter(const GearFacetIndex::Filter &filter)
+{
+    facetFilter = filter;
+    updateFilteredItems();
+}
 
-        // Check normalized name and manufacturer
-        if (normalizedName.contains(normalizedSearch) ||
-            normalizedManufacturer.contains(normalizedSearch))
-        {
-            matchesSearch = true;
-        }
+/**
+ * @brief Updates the filtered items in both list and tree views.
+ *
+ * Refreshes the display of items based on current search criteria,
+ * matching on the calling thread.
+ */
+void GearLibrary::updateFilteredItems()
+{
+    searchWorker.cancel();
 
-        // Check normalized category string
-        if (!matchesSearch && !item.categoryString.isEmpty() &&
-            normalizeForSearch(item.categoryString).contains(normalizedSearch))
-        {
-            matchesSearch = true;
-        }
+    if (currentSearchText.isEmpty())
+    {
+        facetResult = catalogue.getFacetIndex().filter(facetFilter);
+        showFilteredItems(facetFilter.isActive() ? GearFacetIndex::toIndices(facetResult.matches) : juce::Array<int>());
+        return;
+    }
 
-        // Check normalized tags
-        if (!matchesSearch && item.tags.size() > 0)
-        {
-            for (const auto &tag : item.tags)
-            {
-                if (normalizeForSearch(tag).contains(normalizedSearch))
-                {
-                    matchesSearch = true;
-                    break;
-                }
-            }
-        }
+    // Text matches outside the facet filter are dropped before ranking, so they never use up result slots
+    auto facetMatches = catalogue.getFacetIndex().getMatches(facetFilter);
+    auto exactMatches = catalogue.getSearchIndex()->find(normalizedSearchText);
+    auto allowedMatches = GearFacetIndex::intersect(exactMatches, facetMatches);
 
-        return matchesSearch;
-    }
+    auto ranked = searchRanker.rank(*catalogue.getSearchIndex(), allowedMatches, searchWords, GearSearchRanker::DEFAULT_MAX_RESULTS,
+                                    nullptr, facetFilter.isActive() ? &facetMatches : nullptr);
 
-    // If no search text, show all items
-    return true;
+    auto textMatches = GearFacetIndex::toBits(allowedMatches.isEmpty() ? ranked : exactMatches);
+    facetResult = catalogue.getFacetIndex().filter(facetFilter, &textMatches);
+    showFilteredItems(ranked);
 }
 
 /**
- * @brief Updates the filtered items in both list and tree views.
+ * @brief Rebuilds the tree from a set of search matches.
  *
- * Refreshes the display of items based on current search criteria.
+ * Categories appear in the order of their best ranked match.
+ *
+ * @param matches Indices of the items matching the current search text and
+ *                facet filter, best first; ignored when neither is active
  */
-void GearLibrary::updateFilteredItems()
+void GearLibrary::showFilteredItems(const juce::Array<int> &matches)
 {
-
-    // Then update the tree view
+    // Update the tree view
     if (rootItem && gearTreeView)
     {
-        bool isSearching = !currentSearchText.isEmpty();
+        bool isSearching = !currentSearchText.isEmpty() || facetFilter.isActive();
 
         // Clear and rebuild the tree structure
         rootItem->clearSubItems();
 
         if (isSearching)
         {
-            // Find all matching items
-            juce::Array<GearItem *> matchingItems;
-            for (int i = 0; i < gearItems.size(); ++i)
+            if (matches.size() > 0)
             {
-                if (shouldShowItem(gearItems.getReference(i)))
+                // Get favorites and recently used items as sorted item indices
+                auto favoriteIndices = getItemIndicesByUnitIds(cacheManager.getFavorites());
+                auto recentlyUsedIndices = getItemIndicesByUnitIds(cacheManager.getRecentlyUsed());
+
+                // Group matching items by category, keeping the ranked order
+                const auto &categoryIndex = catalogue.getCategoryIndex();
+                juce::Array<juce::Array<int>> categoryGroups;
+                juce::Array<juce::Array<int>> favoriteCategoryGroups;
+                categoryGroups.resize(categoryIndex.getNumGroups());
+                favoriteCategoryGroups.resize(categoryIndex.getNumGroups());
+                juce::Array<int> categoryOrder;
+                bool hasMatchingFavorites = false;
+                juce::Array<int> matchingRecentlyUsed;
+
+                for (auto itemIndex : matches)
                 {
-                    matchingItems.add(&gearItems.getReference(i));
-                }
-            }
+                    auto group = categoryIndex.getGroupOfEntry(itemIndex);
+                    if (group < 0)
+                        continue;
 
-            if (matchingItems.size() > 0)
-            {
-                // Get favorites and recently used items
-                juce::StringArray favorites = cacheManager.getFavorites();
-                juce::StringArray recentlyUsed = cacheManager.getRecentlyUsed();
+                    // Group by category for the main categories section
+                    if (categoryGroups.getReference(group).isEmpty())
+                        categoryOrder.add(group);
 
-                // Group matching items by category
-                juce::HashMap<juce::String, juce::Array<GearItem *>> categoryGroups;
-                juce::Array<GearItem *> matchingFavorites;
-                juce::Array<GearItem *> matchingRecentlyUsed;
+                    categoryGroups.getReference(group).add(itemIndex);
 
-                for (auto *item : matchingItems)
-                {
-                    // Check if item is in favorites
-                    if (favorites.contains(item->unitId))
+                    // Check if item is in favorites (grouped the same way as the Categories tree)
+                    if (std::binary_search(favoriteIndices.begin(), favoriteIndices.end(), itemIndex))
                     {
-                        matchingFavorites.add(item);
+                        favoriteCategoryGroups.getReference(group).add(itemIndex);
+                        hasMatchingFavorites = true;
                     }
 
                     // Check if item is in recently used
-                    if (recentlyUsed.contains(item->unitId))
-                    {
-                        matchingRecentlyUsed.add(item);
-                    }
-
-                    // Group by category for the main categories section
-                    juce::String category = item->categoryString;
-                    if (category.isEmpty())
+                    if (std::binary_search(recentlyUsedIndices.begin(), recentlyUsedIndices.end(), itemIndex))
                     {
-                        // Fallback to enum-based category
-                        switch (item->category)
-                        {
-                        case GearCategory::EQ:
-                            category = "equalizer";
-                            break;
-                        case GearCategory::Compressor:
-                            category = "compressor";
-                            break;
-                        case GearCategory::Preamp:
-                            category = "preamp";
-                            break;
-                        case GearCategory::Other:
-                            category = "other";
-                            break;
-                        }
+                        matchingRecentlyUsed.add(itemIndex);
                     }
-
-                    if (!categoryGroups.contains(category))
-                        categoryGroups.set(category, juce::Array<GearItem *>());
-
-                    categoryGroups.getReference(category).add(item);
                 }
 
                 // Add Recently Used section if there are matching recently used items
@@ -321,98 +352,28 @@ void GearLibrary::updateFilteredItems()
                     auto recentlyUsedNode = new GearTreeItem(GearTreeItem::ItemType::RecentlyUsed, "Recently Used", this, &cacheManager);
                     rootItem->addSubItem(recentlyUsedNode);
 
-                    for (auto *item : matchingRecentlyUsed)
+                    for (auto itemIndex : matchingRecentlyUsed)
                     {
-                        // Find the index of this item in the original array
-                        int itemIndex = -1;
-                        for (int i = 0; i < gearItems.size(); ++i)
-                        {
-                            if (&gearItems.getReference(i) == item)
-                            {
-                                itemIndex = i;
-                                break;
-                            }
-                        }
-
-                        if (itemIndex >= 0)
-                        {
-                            recentlyUsedNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                        }
+                        recentlyUsedNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, catalogue[itemIndex].name, this, &cacheManager, itemIndex));
                     }
                     recentlyUsedNode->setOpen(true);
                 }
 
                 // Add My Gear section if there are matching favorites
-                if (matchingFavorites.size() > 0)
+                if (hasMatchingFavorites)
                 {
                     auto myGearNode = new GearTreeItem(GearTreeItem::ItemType::Favorites, "My Gear", this, &cacheManager);
                     rootItem->addSubItem(myGearNode);
 
-                    // Group matching favorites by category (same approach as Categories tree)
-                    juce::HashMap<juce::String, juce::Array<GearItem *>> favoriteCategoryGroups;
-
-                    for (auto *item : matchingFavorites)
-                    {
-                        // Get the category string or derive it from the enum
-                        juce::String category;
-                        if (!item->categoryString.isEmpty())
-                        {
-                            category = item->categoryString.toLowerCase();
-                        }
-                        else
-                        {
-                            // Fallback to enum if string is empty
-                            switch (item->category)
-                            {
-                            case GearCategory::EQ:
-                                category = "equalizer";
-                                break;
-                            case GearCategory::Compressor:
-                                category = "compressor";
-                                break;
-                            case GearCategory::Preamp:
-                                category = "preamp";
-                                break;
-                            case GearCategory::Other:
-                                category = "other";
-                                break;
-                            }
-                        }
-
-                        if (!favoriteCategoryGroups.contains(category))
-                            favoriteCategoryGroups.set(category, juce::Array<GearItem *>());
-
-                        favoriteCategoryGroups.getReference(category).add(item);
-                    }
-
-                    // Add category groups as sub-items
-                    for (auto it = favoriteCategoryGroups.begin(); it != favoriteCategoryGroups.end(); ++it)
+                    // Add category groups as sub-items, in the ranked order
+                    for (auto group : categoryOrder)
                     {
-                        juce::String categoryName = it.getKey();
-                        juce::String displayName = categoryName.substring(0, 1).toUpperCase() + categoryName.substring(1);
+                        if (favoriteCategoryGroups.getReference(group).isEmpty())
+                            continue;
 
-                        auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, displayName, this, &cacheManager);
+                        auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, categoryIndex.getDisplayName(group), this, &cacheManager);
+                        categoryNode->setItemIndices(favoriteCategoryGroups.getReference(group));
                         myGearNode->addSubItem(categoryNode);
-
-                        // Add gear items to this category group
-                        for (auto *item : it.getValue())
-                        {
-                            // Find the index of this item in the original array
-                            int itemIndex = -1;
-                            for (int i = 0; i < gearItems.size(); ++i)
-                            {
-                                if (&gearItems.getReference(i) == item)
-                                {
-                                    itemIndex = i;
-                                    break;
-                                }
-                            }
-
-                            if (itemIndex >= 0)
-                            {
-                                categoryNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                            }
-                        }
                     }
                     myGearNode->setOpen(true);
 
@@ -430,34 +391,12 @@ void GearLibrary::updateFilteredItems()
                 auto categoriesNode = new GearTreeItem(GearTreeItem::ItemType::Category, "Categories", this, &cacheManager);
                 rootItem->addSubItem(categoriesNode);
 
-                // Add each category that has matching items
-                for (auto it = categoryGroups.begin(); it != categoryGroups.end(); ++it)
+                // Add each category that has matching items; gear rows are created as each one opens
+                for (auto group : categoryOrder)
                 {
-                    juce::String categoryName = it.getKey();
-                    juce::String displayName = categoryName.substring(0, 1).toUpperCase() + categoryName.substring(1);
-
-                    auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, displayName, this, &cacheManager);
+                    auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, categoryIndex.getDisplayName(group), this, &cacheManager);
+                    categoryNode->setItemIndices(categoryGroups.getReference(group));
                     categoriesNode->addSubItem(categoryNode);
-
-                    // Add matching items to this category
-                    for (auto *item : it.getValue())
-                    {
-                        // Find the index of this item in the original array
-                        int itemIndex = -1;
-                        for (int i = 0; i < gearItems.size(); ++i)
-                        {
-                            if (&gearItems.getReference(i) == item)
-                            {
-                                itemIndex = i;
-                                break;
-                            }
-                        }
-
-                        if (itemIndex >= 0)
-                        {
-                            categoryNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                        }
-                    }
                 }
 
                 // Expand the tree to show all matching items
@@ -551,18 +490,8 @@ void GearLibrary::refreshRecentlyUsedSection()
         {
             // juce::Logger::writeToLog("Recently Used section doesn't exist, creating it");
 
-            // Get recently used items from cache
-            juce::Array<GearItem *> matchingRecentlyUsed;
-
-            // Find matching items in our gear library
-            for (auto &item : gearItems)
-            {
-                if (recentlyUsed.contains(item.unitId))
-                {
-                    matchingRecentlyUsed.add(&item);
-                    // juce::Logger::writeToLog("  - Found matching item: " + item.name);
-                }
-            }
+            // Find matching items in our gear library, in catalogue order
+            auto matchingRecentlyUsed = getItemIndicesByUnitIds(recentlyUsed);
 
             // Only create the section if there are recently used items
             if (matchingRecentlyUsed.size() > 0)
@@ -571,24 +500,9 @@ void GearLibrary::refreshRecentlyUsedSection()
                 rootItem->addSubItem(recentlyUsedItem);
 
                 // Add the recently used items to the section
-                for (auto *item : matchingRecentlyUsed)
+                for (auto itemIndex : matchingRecentlyUsed)
                 {
-                    // Find the index of this item in the original array
-                    int itemIndex = -1;
-                    for (int i = 0; i < gearItems.size(); ++i)
-                    {
-                        if (&gearItems.getReference(i) == item)
-                        {
-                            itemIndex = i;
-                            break;
-                        }
-                    }
-
-                    if (itemIndex >= 0)
-                    {
-                        recentlyUsedItem->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                        // juce::Logger::writeToLog("  - Added item to tree: " + item->name);
-                    }
+                    recentlyUsedItem->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, catalogue[itemIndex].name, this, &cacheManager, itemIndex));
                 }
                 recentlyUsedItem->setOpen(true);
             }
@@ -607,17 +521,10 @@ void GearLibrary::refreshRecentlyUsedSection()
             // Add each recently used item
             for (const auto &unitId : recentlyUsed)
             {
-                // Find the gear item in the library
-                for (int i = 0; i < gearItems.size(); ++i)
+                auto itemIndex = getItemIndexByUnitId(unitId);
+                if (itemIndex >= 0)
                 {
-                    const auto &item = gearItems.getReference(i);
-                    if (item.unitId == unitId)
-                    {
-                        recentlyUsedItem->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item.name, this, &cacheManager,
-                                                                      const_cast<GearItem *>(&item), i));
-                        // juce::Logger::writeToLog("  - Added item to existing section: " + item.name);
-                        break;
-                    }
+                    recentlyUsedItem->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, catalogue[itemIndex].name, this, &cacheManager, itemIndex));
                 }
             }
         }
@@ -677,16 +584,7 @@ void GearLibrary::refreshFavoritesSection()
             // juce::Logger::writeToLog("My Gear section doesn't exist, creating it");
 
             // Find matching items in our gear library
-            juce::Array<GearItem *> matchingFavorites;
-
-            for (auto &item : gearItems)
-            {
-                if (favorites.contains(item.unitId))
-                {
-                    matchingFavorites.add(&item);
-                    // juce::Logger::writeToLog("  - Found matching item: " + item.name);
-                }
-            }
+            auto matchingFavorites = getItemIndicesByUnitIds(favorites);
 
             // Create the section even if it's empty (like Recently Used)
             favoritesItem = new GearTreeItem(GearTreeItem::ItemType::Favorites, "My Gear", this, &cacheManager);
@@ -695,89 +593,7 @@ void GearLibrary::refreshFavoritesSection()
             // Add items if we have any
             if (matchingFavorites.size() > 0)
             {
-                // Group matching favorites by category
-                juce::HashMap<juce::String, juce::Array<GearItem *>> favoriteCategoryGroups;
-
-                for (auto *item : matchingFavorites)
-                {
-                    // Get the category string or derive it from the enum
-                    juce::String category;
-                    if (!item->categoryString.isEmpty())
-                    {
-                        category = item->categoryString.toLowerCase();
-                    }
-                    else
-                    {
-                        // Fallback to enum if string is empty
-                        switch (item->category)
-                        {
-                        case GearCategory::EQ:
-                            category = "equalizer";
-                            break;
-                        case GearCategory::Compressor:
-                            category = "compressor";
-                            break;
-                        case GearCategory::Preamp:
-                            category = "preamp";
-                            break;
-                        case GearCategory::Other:
-                            category = "other";
-                            break;
-                        }
-                    }
-
-                    if (!favoriteCategoryGroups.contains(category))
-                        favoriteCategoryGroups.set(category, juce::Array<GearItem *>());
-
-                    favoriteCategoryGroups.getReference(category).add(item);
-                }
-
-                // Sort categories alphabetically
-                juce::StringArray sortedCategoryNames;
-                for (auto it = favoriteCategoryGroups.begin(); it != favoriteCategoryGroups.end(); ++it)
-                {
-                    sortedCategoryNames.add(it.getKey());
-                }
-                sortedCategoryNames.sort(true); // true = ignore case
-
-                // Add category groups as sub-items
-                for (const auto &categoryName : sortedCategoryNames)
-                {
-                    juce::String displayName = categoryName.substring(0, 1).toUpperCase() + categoryName.substring(1);
-
-                    auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, displayName, this, &cacheManager);
-                    favoritesItem->addSubItem(categoryNode);
-
-                    // Sort items within this category alphabetically
-                    auto &categoryItems = favoriteCategoryGroups.getReference(categoryName);
-                    std::vector<GearItem *> sortedItems(categoryItems.begin(), categoryItems.end());
-                    std::sort(sortedItems.begin(), sortedItems.end(),
-                              [](const GearItem *a, const GearItem *b)
-                              {
-                                  return a->name.compareIgnoreCase(b->name) < 0;
-                              });
-
-                    // Add gear items to this category group
-                    for (auto *item : sortedItems)
-                    {
-                        // Find the index of this item in the original array
-                        int itemIndex = -1;
-                        for (int i = 0; i < gearItems.size(); ++i)
-                        {
-                            if (&gearItems.getReference(i) == item)
-                            {
-                                itemIndex = i;
-                                break;
-                            }
-                        }
-
-                        if (itemIndex >= 0)
-                        {
-                            categoryNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                            // juce::Logger::writeToLog("  - Added item to tree: " + item->name);
-                        }
-                    }
-                }
+                addFavoriteCategoryGroups(*favoritesItem, matchingFavorites);
             }
             else
             {
@@ -805,97 +621,16 @@ void GearLibrary::refreshFavoritesSection()
             // Clear existing sub-items and rebuild the My Gear section
             favoritesItem->clearSubItems();
 
-            // Group favorites by category
-            juce::HashMap<juce::String, juce::Array<GearItem *>> favoriteCategoryGroups;
-
-            for (const auto &unitId : favorites)
-            {
-                // Find the gear item in the library
-                for (int i = 0; i < gearItems.size(); ++i)
-                {
-                    const auto &item = gearItems.getReference(i);
-                    if (item.unitId == unitId)
-                    {
-                        // Get the category string or derive it from the enum
-                        juce::String category;
-                        if (!item.categoryString.isEmpty())
-                        {
-                            category = item.categoryString.toLowerCase();
-                        }
-                        else
-                        {
-                            // Fallback to enum if string is empty
-                            switch (item.category)
-                            {
-                            case GearCategory::EQ:
-                                category = "equalizer";
-                                break;
-                            case GearCategory::Compressor:
-                                category = "compressor";
-                                break;
-                            case GearCategory::Preamp:
-                                category = "preamp";
-                                break;
-                            case GearCategory::Other:
-                                category = "other";
-                                break;
-                            }
-                        }
-
-                        if (!favoriteCategoryGroups.contains(category))
-                            favoriteCategoryGroups.set(category, juce::Array<GearItem *>());
-
-                        favoriteCategoryGroups.getReference(category).add(const_cast<GearItem *>(&item));
-                        // juce::Logger::writeToLog("  - Added item to existing section: " + item.name);
-                        break;
-                    }
-                }
-            }
-
-            // Sort categories alphabetically
-            juce::StringArray sortedCategoryNames;
-            for (auto it = favoriteCategoryGroups.begin(); it != favoriteCategoryGroups.end(); ++it)
-            {
-                sortedCategoryNames.add(it.getKey());
-            }
-            sortedCategoryNames.sort(true); // true = ignore case
-
             // Add category groups as sub-items and restore their expansion state
-            for (const auto &categoryName : sortedCategoryNames)
+            addFavoriteCategoryGroups(*favoritesItem, getItemIndicesByUnitIds(favorites));
+
+            for (int i = 0; i < favoritesItem->getNumSubItems(); ++i)
             {
-                juce::String displayName = categoryName.substring(0, 1).toUpperCase() + categoryName.substring(1);
-
-                auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, displayName, this, &cacheManager);
-                favoritesItem->addSubItem(categoryNode);
-
-                // Sort items within this category alphabetically
-                auto &categoryItems = favoriteCategoryGroups.getReference(categoryName);
-                std::vector<GearItem *> sortedItems(categoryItems.begin(), categoryItems.end());
-                std::sort(sortedItems.begin(), sortedItems.end(),
-                          [](const GearItem *a, const GearItem *b)
-                          {
-                              return a->name.compareIgnoreCase(b->name) < 0;
-                          });
-
-                // Add gear items to this category group
-                for (auto *item : sortedItems)
-                {
-                    // Find the index of this item in the original array
-                    int itemIndex = -1;
-                    for (int i = 0; i < gearItems.size(); ++i)
-                    {
-                        if (&gearItems.getReference(i) == item)
-                        {
-                            itemIndex = i;
-                            break;
-                        }
-                    }
+                auto categoryNode = dynamic_cast<GearTreeItem *>(favoritesItem->getSubItem(i));
+                if (categoryNode == nullptr)
+                    continue;
 
-                    if (itemIndex >= 0)
-                    {
-                        categoryNode->addSubItem(new GearTreeItem(GearTreeItem::ItemType::Gear, item->name, this, &cacheManager, item, itemIndex));
-                    }
-                }
+                auto displayName = categoryNode->getItemText();
 
                 // Restore the expansion state for this category
                 if (categoryExpansionState.contains(displayName))
@@ -910,6 +645,47 @@ void GearLibrary::refreshFavoritesSection()
     }
 }
 
+/**
+ * @brief Adds a category group to the My Gear section for each category of the favorites.
+ *
+ * Categories and the items within them are in name order, read from the
+ * catalogue's category index rather than sorted here.
+ *
+ * @param favoritesItem The My Gear section
+ * @param favoriteIndices Indices of the favorite items, ascending
+ */
+void GearLibrary::addFavoriteCategoryGroups(GearTreeItem &favoritesItem, const juce::Array<int> &favoriteIndices)
+{
+    const auto &categoryIndex = catalogue.getCategoryIndex();
+
+    // Find the categories holding favorites
+    juce::Array<bool> hasFavorites;
+    hasFavorites.insertMultiple(0, false, categoryIndex.getNumGroups());
+    for (auto itemIndex : favoriteIndices)
+    {
+        auto group = categoryIndex.getGroupOfEntry(itemIndex);
+        if (group >= 0)
+            hasFavorites.set(group, true);
+    }
+
+    for (auto group : categoryIndex.getGroupsByName())
+    {
+        if (!hasFavorites[group])
+            continue;
+
+        // Keep the favorites, in the index's name order
+        juce::Array<int> categoryIndices;
+        for (auto itemIndex : categoryIndex.getEntriesByName(group))
+            if (std::binary_search(favoriteIndices.begin(), favoriteIndices.end(), itemIndex))
+                categoryIndices.add(itemIndex);
+
+        // Gear rows are created when the category is opened
+        auto categoryNode = new GearTreeItem(GearTreeItem::ItemType::Category, categoryIndex.getDisplayName(group), this, &cacheManager);
+        categoryNode->setItemIndices(categoryIndices);
+        favoritesItem.addSubItem(categoryNode);
+    }
+}
+
 /**
  * @brief Clears the favorites items and refreshes the tree view.
  *
@@ -929,7 +705,7 @@ void GearLibrary::clearFavorites()
  */
 int GearLibrary::getNumRows()
 {
-    return gearItems.size();
+    return catalogue.size();
 }
 
 /**
@@ -943,6 +719,79 @@ void GearLibrary::loadLibrary()
     loadGearItems();
 }
 
+/**
+ * @brief Loads the gear library data on a background thread.
+ *
+ * Fetching, parsing and indexing all happen off the message thread; the
+ * finished catalogue replaces the current one in a single step.
+ */
+void GearLibrary::loadLibraryAsync()
+{
+    libraryLoadRequested = true;
+    juce::URL url(getFullUrl(RemoteResources::LIBRARY_PATH));
+
+    auto build = [this, url](const GearCatalogueLoader::AbortCheck &shouldAbort) -> std::unique_ptr<GearCatalogue>
+    {
+        // A superseded load stops fetching instead of downloading an index nobody will see
+        bool success = false;
+        juce::String jsonData = networkFetcher.fetchJsonAbortable(url, success, shouldAbort);
+
+        if (!success || jsonData.isEmpty() || shouldAbort())
+            return nullptr;
+
+        return buildCatalogue(jsonData, shouldAbort);
+    };
+
+    catalogueLoader.load(build);
+}
+
+/**
+ * @brief Reloads the library when the fetcher has a newer index than the one loaded.
+ *
+ * The reload is applied incrementally, so open groups and the selection stay put.
+ *
+ * @param url The URL whose content changed
+ */
+void GearLibrary::resourceUpdated(const juce::URL &url)
+{
+    if (libraryLoadRequested && url.toString(false) == getFullUrl(RemoteResources::LIBRARY_PATH))
+        loadLibraryAsync();
+}
+
+/**
+ * @brief Waits for a background load to finish and installs its result.
+ *
+ * Must be called on the message thread.
+ *
+ * @param timeoutMs Maximum time to wait, or -1 to wait forever
+ * @return true if no load is left pending
+ */
+bool GearLibrary::waitForLibraryLoad(int timeoutMs)
+{
+    if (!catalogueLoader.waitUntilBuilt(timeoutMs))
+        return false;
+
+    catalogueLoader.deliverPendingResult();
+    return !catalogueLoader.isLoading();
+}
+
+/**
+ * @brief Runs a callback once no background load is pending.
+ *
+ * @param callback Called immediately if the library is not loading,
+ *                 otherwise on the message thread after the load is installed
+ */
+void GearLibrary::callWhenLoaded(std::function<void()> callback)
+{
+    if (callback == nullptr)
+        return;
+
+    if (catalogueLoader.isLoading())
+        loadedCallbacks.push_back(std::move(callback));
+    else
+        callback();
+}
+
 /**
  * @brief Loads gear items.
  *
@@ -973,129 +822,312 @@ void GearLibrary::loadGearItems()
  * @brief Parses the gear library JSON data.
  *
  * Processes JSON data containing gear items and populates the library.
- * Supports both new and legacy JSON formats.
  *
  * @param jsonData The JSON string containing gear library data
  */
 void GearLibrary::parseGearLibrary(const juce::String &jsonData)
 {
-    // Parse JSON data and populate gear items
-    auto json = juce::JSON::parse(jsonData);
+    if (auto loaded = buildCatalogue(jsonData, nullptr))
+        installCatalogue(std::move(loaded));
+}
 
-    // Check if we have a "units" array in the new format
-    if (json.hasProperty("units") && json["units"].isArray())
-    {
-        auto unitsArray = json["units"].getArray();
-        gearItems.clear();
+/**
+ * @brief Builds a catalogue from the library index.
+ *
+ * Units are streamed out of the JSON text straight into catalogue entries, without
+ * building a juce::var tree of the whole document. Touches nothing but the
+ * injected services, so it may run on a background thread.
+ *
+ * @param jsonData The JSON string containing gear library data
+ * @param shouldAbort Optional check polled between units
+ * @return The catalogue, or nullptr if the data has no "units" array, is malformed or the build was aborted
+ */
+std::unique_ptr<GearCatalogue> GearLibrary::buildCatalogue(const juce::String &jsonData,
+                                                           const GearCatalogueLoader::AbortCheck &shouldAbort) const
+{
+    auto catalogue = std::make_unique<GearCatalogue>();
 
-        for (auto &unitJson : *unitsArray)
-        {
-            if (unitJson.isObject())
-            {
-                auto obj = unitJson.getDynamicObject();
-
-                // Extract properties using the new format
-                juce::String unitId = obj->getProperty("unitId");
-                juce::String name = obj->getProperty("name");
-                juce::String manufacturer = obj->getProperty("manufacturer");
-                juce::String category = obj->getProperty("category");
-                juce::String version = obj->getProperty("version");
-                juce::String schemaPath = obj->getProperty("schemaPath");
-                juce::String thumbnailImage = obj->getProperty("thumbnailImage");
-
-                // Process tags with explicit cleanup
-                juce::StringArray tags;
-                if (obj->hasProperty("tags") && obj->getProperty("tags").isArray())
-                {
-                    auto tagsArray = obj->getProperty("tags").getArray();
-                    for (auto &tag : *tagsArray)
-                    {
-                        tags.add(tag.toString());
-                    }
-                    // Clear the temporary array reference to release memory
-                    tagsArray = nullptr;
-                }
+    // Sized up front so the indices are allocated once
+    catalogue->reserve(GearCatalogueParser::countUnits(jsonData));
 
-                // Determine slotSize (default to 1)
-                int slotSize = obj->hasProperty("slotSize") ? static_cast<int>(obj->getProperty("slotSize")) : 1;
+    bool parsed = GearCatalogueParser::parse(jsonData, [&catalogue](GearCatalogueRecord &&record)
+                                             {
+                                                 resolveResourcePaths(record);
+                                                 catalogue->add(record);
+                                             },
+                                             shouldAbort);
 
-                // Create empty controls array (we'll populate this later when loading the full schema)
-                juce::Array<GearControl> controls;
+    if (!parsed || (shouldAbort && shouldAbort()))
+        return nullptr;
 
-                // Ensure schemaPath is properly formatted using our constants
-                if (!schemaPath.startsWith("http") && !schemaPath.isEmpty())
-                {
-                    // If it's a relative path, ensure it's relative to SCHEMAS_PATH
-                    if (!schemaPath.startsWith(RemoteResources::SCHEMAS_PATH) &&
-                        !schemaPath.startsWith("/"))
-                    {
-                        schemaPath = RemoteResources::SCHEMAS_PATH + schemaPath;
-                    }
-                }
+    return catalogue;
+}
 
-                // Do the same for thumbnail images
-                if (!thumbnailImage.startsWith("http") && !thumbnailImage.isEmpty())
-                {
-                    // If it's a relative path and doesn't start with assets/, add the ASSETS_PATH
-                    if (!thumbnailImage.startsWith(RemoteResources::ASSETS_PATH) &&
-                        !thumbnailImage.startsWith("/"))
-                    {
-                        thumbnailImage = RemoteResources::ASSETS_PATH + thumbnailImage;
-                    }
-                }
+/**
+ * @brief Resolves the relative schema and thumbnail paths of a unit of the library index.
+ *
+ * @param record The unit as read from index.json, updated in place
+ */
+void GearLibrary::resolveResourcePaths(GearCatalogueRecord &record)
+{
+    auto &schemaPath = record.schemaPath;
+    auto &thumbnailImage = record.thumbnailImage;
 
-                GearItem item(unitId, name, manufacturer, category, version, schemaPath,
-                              thumbnailImage, tags, networkFetcher, fileSystem, cacheManager, GearType::Other, GearCategory::Other,
-                              slotSize, controls);
+    // Ensure schemaPath is properly formatted using our constants
+    if (!schemaPath.startsWith("http") && !schemaPath.isEmpty())
+    {
+        // If it's a relative path, ensure it's relative to SCHEMAS_PATH
+        if (!schemaPath.startsWith(RemoteResources::SCHEMAS_PATH) &&
+            !schemaPath.startsWith("/"))
+        {
+            schemaPath = RemoteResources::SCHEMAS_PATH + schemaPath;
+        }
+    }
 
-                // Add to list
-                gearItems.add(item);
-            }
+    // Do the same for thumbnail images
+    if (!thumbnailImage.startsWith("http") && !thumbnailImage.isEmpty())
+    {
+        // If it's a relative path and doesn't start with assets/, add the ASSETS_PATH
+        if (!thumbnailImage.startsWith(RemoteResources::ASSETS_PATH) &&
+            !thumbnailImage.startsWith("/"))
+        {
+            thumbnailImage = RemoteResources::ASSETS_PATH + thumbnailImage;
         }
     }
+}
+
+/**
+ * @brief Replaces the catalogue if it differs and updates the tree over it.
+ *
+ * The new catalogue is compared with the current one by unit ID. If nothing
+ * has changed it is discarded and the tree is left alone; otherwise the tree
+ * is updated in place and decoded thumbnails of unchanged units are kept.
+ * Must be called on the message thread.
+ *
+ * @param loaded The new catalogue; receives the old one, which is released afterwards
+ */
+void GearLibrary::installCatalogue(std::unique_ptr<GearCatalogue> loaded)
+{
+    auto changes = loaded->getChangesSince(catalogue);
+    if (changes.isEmpty())
+        return;
+
+    searchWorker.cancel();
+
+    // Thumbnails move to the new index of their unit unless its image has changed
+    juce::HashMap<int, juce::Image> keptThumbnails;
+    for (int i = 0; i < changes.previousIndices.size(); ++i)
+    {
+        auto previousIndex = changes.previousIndices[i];
+        if (previousIndex >= 0 && thumbnails.contains(previousIndex) &&
+            (*loaded)[i].thumbnailImage == catalogue[previousIndex].thumbnailImage &&
+            (*loaded)[i].version == catalogue[previousIndex].version)
+            keptThumbnails.set(i, thumbnails[previousIndex]);
+    }
+
+    // Requested thumbnails are keyed by the old indices
+    thumbnailLoader.cancelAll();
+
+    // The tree refers to entries by index, so it is updated before the old catalogue is released
+    catalogue.swapWith(*loaded);
+    thumbnails.swapWith(keptThumbnails);
 
     // Update the tree view if we have a root item
     if (rootItem != nullptr)
     {
-        rootItem->refreshSubItems();
+        if (currentSearchText.isNotEmpty() || facetFilter.isActive())
+        {
+            updateFilteredItems();
+        }
+        else
+        {
+            facetResult = catalogue.getFacetIndex().filter(facetFilter);
+            updateTreeItems(changes.previousIndices);
+        }
+    }
 
-        // Refresh the recently used section to ensure it's populated on startup
-        refreshRecentlyUsedSection();
+    loaded.reset();
+}
 
-        // Refresh the favorites section to ensure it's populated on startup
-        refreshFavoritesSection();
+/**
+ * @brief Brings the unfiltered tree up to date with the catalogue.
+ *
+ * Existing sections and groups are updated in place, so their openness and
+ * the scroll position are kept.
+ *
+ * @param previousIndices For each entry, the index its unit had in the replaced catalogue, or -1 if it is new
+ */
+void GearLibrary::updateTreeItems(const juce::Array<int> &previousIndices)
+{
+    GearTreeItem *categoriesItem = nullptr;
+    for (int i = 0; i < rootItem->getNumSubItems() && categoriesItem == nullptr; ++i)
+    {
+        auto *item = dynamic_cast<GearTreeItem *>(rootItem->getSubItem(i));
+        if (item != nullptr && item->getItemText() == "Categories")
+            categoriesItem = item;
     }
+
+    if (categoriesItem != nullptr)
+        categoriesItem->updateCategoryGroups(previousIndices);
+    else
+        rootItem->refreshSubItems();
+
+    // Refresh the recently used section to ensure it's populated on startup
+    refreshRecentlyUsedSection();
+
+    // Refresh the favorites section to ensure it's populated on startup
+    refreshFavoritesSection();
 }
 
 /**
- * @brief Gets a gear item by index.
+ * @brief Called on the message thread when a background load finishes.
  *
- * @param index The index of the gear item to retrieve
- * @return Pointer to the gear item, or nullptr if index is invalid
+ * @param loaded The new catalogue, or nullptr if the load failed
  */
-GearItem *GearLibrary::getGearItem(int index)
+void GearLibrary::handleCatalogueLoaded(std::unique_ptr<GearCatalogue> loaded)
 {
-    if (index >= 0 && index < gearItems.size())
-        return &(gearItems.getReference(index));
+    if (loaded != nullptr)
+        installCatalogue(std::move(loaded));
+
+    auto callbacks = std::move(loadedCallbacks);
+    loadedCallbacks.clear();
 
-    return nullptr;
+    for (auto &callback : callbacks)
+        callback();
 }
 
 /**
- * @brief Gets a gear item by unit ID.
+ * @brief Creates a full gear item for a library entry.
  *
- * @param unitId The unit ID of the gear item to retrieve
- * @return Pointer to the gear item, or nullptr if not found
+ * @param index The index of the entry
+ * @param networkFetcherToUse The network fetcher the item loads resources with
+ * @param fileSystemToUse The file system the item uses
+ * @param cacheManagerToUse The cache manager the item uses
+ * @return The new item, or nullptr if the index is invalid
  */
-GearItem *GearLibrary::getGearItemByUnitId(const juce::String &unitId)
+std::unique_ptr<GearItem> GearLibrary::createGearItem(int index, INetworkFetcher &networkFetcherToUse, IFileSystem &fileSystemToUse,
+                                                      CacheManager &cacheManagerToUse) const
 {
-    for (auto &item : gearItems)
+    return catalogue.createItem(index, networkFetcherToUse, fileSystemToUse, cacheManagerToUse);
+}
+
+/**
+ * @brief Creates a full gear item for the library entry with a unit ID.
+ *
+ * @param unitId The unit ID to look up
+ * @param networkFetcherToUse The network fetcher the item loads resources with
+ * @param fileSystemToUse The file system the item uses
+ * @param cacheManagerToUse The cache manager the item uses
+ * @return The new item, or nullptr if no entry has that unit ID
+ */
+std::unique_ptr<GearItem> GearLibrary::createGearItemByUnitId(const juce::String &unitId, INetworkFetcher &networkFetcherToUse,
+                                                              IFileSystem &fileSystemToUse, CacheManager &cacheManagerToUse) const
+{
+    return createGearItem(getItemIndexByUnitId(unitId), networkFetcherToUse, fileSystemToUse, cacheManagerToUse);
+}
+
+/**
+ * @brief Sets the controls given to gear items created for a library entry.
+ *
+ * @param index The index of the entry
+ * @param controls The controls
+ */
+void GearLibrary::setItemControls(int index, const juce::Array<GearControl> &controls)
+{
+    catalogue.setControls(index, controls);
+}
+
+/**
+ * @brief Gets the thumbnail of a library entry if it has been loaded.
+ *
+ * A thumbnail that is not loaded yet is queued on the thumbnail loader, which
+ * fetches, decodes and caches it off the message thread.
+ *
+ * @param index The index of the entry
+ * @return The thumbnail, or an invalid image if it is not loaded yet or the index is invalid
+ */
+juce::Image GearLibrary::getThumbnail(int index)
+{
+    if (thumbnails.contains(index))
+        return thumbnails[index];
+
+    // Rows repaint often while their thumbnail loads
+    if (!juce::isPositiveAndBelow(index, catalogue.size()) || thumbnailLoader.isPending(index))
+        return {};
+
+    // The fields are copied because the catalogue may be replaced while the thumbnail loads
+    const auto entry = catalogue[index];
+    thumbnailLoader.request(index, [this, unitId = entry.unitId, thumbnailPath = entry.thumbnailImage,
+                                    name = entry.name, category = entry.category]
+                            {
+                                return GearItem::loadThumbnail(unitId, thumbnailPath, name, category,
+                                                               networkFetcher, fileSystem, cacheManager);
+                            });
+    return {};
+}
+
+/**
+ * @brief Waits for requested thumbnails to load and stores them.
+ *
+ * @param timeoutMs Maximum time to wait, or -1 to wait forever
+ * @return true if every requested thumbnail has been stored
+ */
+bool GearLibrary::waitForThumbnails(int timeoutMs)
+{
+    if (!thumbnailLoader.waitUntilIdle(timeoutMs))
+        return false;
+
+    thumbnailLoader.deliverPendingResults();
+    return true;
+}
+
+/**
+ * @brief Gets the memory held by the loaded thumbnails and the catalogue records.
+ *
+ * @param images Counts each image once across holders
+ * @return The thumbnails and catalogue
+ */
+MemoryUsage GearLibrary::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    MemoryUsage usage;
+
+    for (auto it = thumbnails.begin(); it != thumbnails.end(); ++it)
+        usage.thumbnails += images.count(it.getValue());
+
+    usage.catalogue = catalogue.getRecordBytes();
+    return usage;
+}
+
+/**
+ * @brief Gets the index of a gear item by unit ID.
+ *
+ * @param unitId The unit ID to look up
+ * @return The index of the first item with that unit ID, or -1 if not found
+ */
+int GearLibrary::getItemIndexByUnitId(const juce::String &unitId) const
+{
+    return catalogue.getIndexOfUnitId(unitId);
+}
+
+/**
+ * @brief Gets the indices of the gear items with any of the given unit IDs.
+ *
+ * @param unitIds The unit IDs to look up; unknown IDs are skipped
+ * @return The matching item indices in catalogue order, without duplicates
+ */
+juce::Array<int> GearLibrary::getItemIndicesByUnitIds(const juce::StringArray &unitIds) const
+{
+    juce::SortedSet<int> indices;
+    for (const auto &unitId : unitIds)
     {
-        if (item.unitId == unitId)
-            return &item;
+        auto itemIndex = getItemIndexByUnitId(unitId);
+        if (itemIndex >= 0)
+            indices.add(itemIndex);
     }
 
-    return nullptr;
+    juce::Array<int> result;
+    result.addArray(indices.begin(), indices.size());
+    return result;
 }
 
 /**
@@ -1137,17 +1169,6 @@ void GearLibrary::mouseDrag(const juce::MouseEvent &e)
  */
 void GearLibrary::addItem(const juce::String &unitId, const juce::String &name, const juce::String &category, const juce::String &description, const juce::String &manufacturer, bool bypassUI)
 {
-    // Create a new GearItem with default controls
-    GearCategory gearCategory;
-    if (category == "EQ")
-        gearCategory = GearCategory::EQ;
-    else if (category == "Preamp")
-        gearCategory = GearCategory::Preamp;
-    else if (category == "Compressor")
-        gearCategory = GearCategory::Compressor;
-    else
-        gearCategory = GearCategory::Other;
-
     // Determine a reasonable default type based on common industry standards
     GearType gearType;
     if (name.containsIgnoreCase("500") || name.containsIgnoreCase("lunchbox"))
@@ -1155,12 +1176,17 @@ void GearLibrary::addItem(const juce::String &unitId, const juce::String &name,
     else
         gearType = GearType::Rack19Inch;
 
-    // Create an empty array of controls and tags
-    juce::Array<GearControl> controls;
-    juce::StringArray emptyTags;
+    // User-created units have no schema, paths or tags
+    GearCatalogueRecord record;
+    record.unitId = unitId;
+    record.name = name;
+    record.manufacturer = manufacturer;
+    record.category = category;
+    record.version = "1.0.0";
+    record.slotSize = 1;
 
-    // Add the new item to the list using the newer constructor
-    gearItems.add(GearItem(unitId, name, manufacturer, category, "1.0.0", "", "", emptyTags, networkFetcher, fileSystem, cacheManager, gearType, gearCategory, 1, controls));
+    // Add the new entry; the category enum is derived from the string as for any other unit
+    catalogue.add(record, gearType);
 
     // Update the UI (skip if bypassUI is true to avoid creating Images/StringArrays in tests)
     if (!bypassUI && rootItem != nullptr)
@@ -1193,6 +1219,6 @@ void GearLibrary::buttonClicked(juce::Button *button)
 {
     if (button == &refreshButton)
     {
-        loadLibrary();
+        loadLibraryAsync();
     }
 }
\ No newline at end of file
@@ -16,7 +16,16 @@
 #include "CacheManager.h"
 #include "IFileSystem.h"
 #include "PresetManager.h" // Added for PresetManager
+#include "GearCatalogue.h"
+#include "GearCatalogueLoader.h"
+#include "GearCatalogueParser.h"
+#include "GearSearchWorker.h"
+#include "GearThumbnailLoader.h"
+#include <functional>
+#include <memory>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 /**
  * @brief Namespace containing remote resource URLs and paths.
@@ -43,7 +52,8 @@ class GearTreeItem;
  * a new hierarchical tree view.
  */
 class GearLibrary : public juce::Component,
-                    public juce::Button::Listener
+                    public juce::Button::Listener,
+                    private INetworkFetcher::Listener
 {
 public:
     /**
@@ -102,27 +112,155 @@ public:
     void buttonClicked(juce::Button *button) override;
 
     /**
-     * @brief Gets a gear item by index.
+     * @brief Creates a gear item for a library entry, to be placed in the rack.
      *
-     * @param index The index of the gear item to retrieve
-     * @return Pointer to the gear item, or nullptr if index is invalid
+     * @param index The index of the entry
+     * @param networkFetcherToUse The network fetcher the item loads resources with
+     * @param fileSystemToUse The file system the item uses
+     * @param cacheManagerToUse The cache manager the item uses
+     * @return The new item, or nullptr if index is invalid
      */
-    GearItem *getGearItem(int index);
+    std::unique_ptr<GearItem> createGearItem(int index, INetworkFetcher &networkFetcherToUse, IFileSystem &fileSystemToUse,
+                                             CacheManager &cacheManagerToUse) const;
 
     /**
-     * @brief Gets a gear item by unit ID.
+     * @brief Creates a gear item for a library entry by unit ID, to be placed in the rack.
      *
-     * @param unitId The unit ID of the gear item to retrieve
-     * @return Pointer to the gear item, or nullptr if not found
+     * @param unitId The unit ID of the entry
+     * @param networkFetcherToUse The network fetcher the item loads resources with
+     * @param fileSystemToUse The file system the item uses
+     * @param cacheManagerToUse The cache manager the item uses
+     * @return The new item, or nullptr if not found
      */
-    GearItem *getGearItemByUnitId(const juce::String &unitId);
+    std::unique_ptr<GearItem> createGearItemByUnitId(const juce::String &unitId, INetworkFetcher &networkFetcherToUse,
+                                                     IFileSystem &fileSystemToUse, CacheManager &cacheManagerToUse) const;
 
     /**
-     * @brief Gets the full array of gear items.
+     * @brief Sets the controls of a library entry that has no schema.
      *
-     * @return Constant reference to the array of gear items
+     * Items created for the entry afterwards start with these controls.
+     *
+     * @param index The index of the entry
+     * @param controls The controls
+     */
+    void setItemControls(int index, const juce::Array<GearControl> &controls);
+
+    /**
+     * @brief Gets the thumbnail of a library entry if it has been loaded.
+     *
+     * Never blocks: a thumbnail that is not loaded yet is queued on the
+     * thumbnail loader, and the tree is repainted once it arrives.
+     *
+     * @param index The index of the entry
+     * @return The thumbnail, or an invalid image if it is not loaded yet or the index is invalid
+     */
+    juce::Image getThumbnail(int index);
+
+    /**
+     * @brief Waits for requested thumbnails to load and stores them.
+     *
+     * Must be called on the message thread.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if every requested thumbnail has been stored
+     */
+    bool waitForThumbnails(int timeoutMs);
+
+    /**
+     * @brief Gets the memory held by the loaded thumbnails and the catalogue records.
+     *
+     * Must be called on the message thread.
+     *
+     * @param images Counts each image once across holders
+     * @return The thumbnails and catalogue
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
+
+    /**
+     * @brief Gets the index of a gear item by unit ID.
+     *
+     * Looks the unit ID up in a hash index maintained alongside the items,
+     * so it costs O(1) regardless of catalogue size.
+     *
+     * @param unitId The unit ID to look up
+     * @return The index of the first item with that unit ID, or -1 if not found
+     */
+    int getItemIndexByUnitId(const juce::String &unitId) const;
+
+    /**
+     * @brief Gets the indices of the gear items with any of the given unit IDs.
+     *
+     * @param unitIds The unit IDs to look up; unknown IDs are skipped
+     * @return The matching item indices in catalogue order, without duplicates
+     */
+    juce::Array<int> getItemIndicesByUnitIds(const juce::StringArray &unitIds) const;
+
+    /**
+     * @brief Gets the catalogue of library entries.
+     *
+     * @return Constant reference to the catalogue
+     */
+    const GearCatalogue &getCatalogue() const { return catalogue; }
+
+    /**
+     * @brief Finds the items matching a search string.
+     *
+     * Matching ignores case and the separator characters returned by
+     * GearCatalogue::getIgnoredCharacters(), against each item's prebuilt search key.
+     * Candidates are taken from a trigram index, so the cost follows the
+     * number of matches rather than the size of the library.
+     *
+     * @param searchText The text typed by the user
+     * @return Indices of the matching items, in library order
+     */
+    juce::Array<int> findMatchingItems(const juce::String &searchText) const;
+
+    /**
+     * @brief Finds the items matching a search string and a facet filter.
+     *
+     * @param searchText The text typed by the user; empty matches every item
+     * @param filter The facet values to filter by
+     * @return Indices of the matching items, in library order
+     */
+    juce::Array<int> findMatchingItems(const juce::String &searchText, const GearFacetIndex::Filter &filter) const;
+
+    /**
+     * @brief Filters the tree by facet values, combined with the search text.
+     *
+     * @param filter The facet values to filter by; an inactive filter shows every item
+     */
+    void setFacetFilter(const GearFacetIndex::Filter &filter);
+
+    /**
+     * @brief Gets the current facet filter.
+     *
+     * @return The facet values the tree is filtered by
+     */
+    const GearFacetIndex::Filter &getFacetFilter() const { return facetFilter; }
+
+    /**
+     * @brief Gets the facet index over the library.
+     *
+     * @return The facet index, parallel to getCatalogue()
+     */
+    const GearFacetIndex &getFacetIndex() const { return catalogue.getFacetIndex(); }
+
+    /**
+     * @brief Gets the items matching the current search and facet filter, with counts per facet value.
+     *
+     * Updated whenever the tree is filtered. While the search text matches
+     * only approximately, the counts cover the shown results.
+     *
+     * @return The facet matches and counts
+     */
+    const GearFacetIndex::Result &getFacetResult() const { return facetResult; }
+
+    /**
+     * @brief Gets the root item of the tree view.
+     *
+     * @return The root item, which owns every section of the tree
      */
-    const juce::Array<GearItem> &getItems() const { return gearItems; }
+    GearTreeItem *getRootTreeItem() const { return rootItem.get(); }
 
     /**
      * @brief Gets the cache manager.
@@ -136,6 +274,31 @@ public:
      */
     void loadLibrary();
 
+    /**
+     * @brief Loads the gear library data on a background thread.
+     *
+     * The current items stay in place until the new catalogue is complete.
+     */
+    void loadLibraryAsync();
+
+    /**
+     * @brief Waits for a background load to finish and installs its result.
+     *
+     * Must be called on the message thread.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if no load is left pending
+     */
+    bool waitForLibraryLoad(int timeoutMs);
+
+    /**
+     * @brief Runs a callback once no background load is pending.
+     *
+     * @param callback Called immediately if the library is not loading,
+     *                 otherwise on the message thread after the load is installed
+     */
+    void callWhenLoaded(std::function<void()> callback);
+
     /**
      * @brief Loads gear items.
      */
@@ -205,7 +368,9 @@ public:
     /**
      * @brief Updates the filtered items in both list and tree views.
      *
-     * Refreshes the display of items based on current search criteria.
+     * Refreshes the display of items based on current search criteria,
+     * matching and ranking immediately. Typing in the search box instead goes through a
+     * debounced background search, and only its final result rebuilds the tree.
      */
     void updateFilteredItems();
 
@@ -250,6 +415,13 @@ public:
     void clearFavorites();
 
 private:
+    /**
+     * @brief Reloads the library when the fetcher has a newer index than the one loaded.
+     *
+     * @param url The URL whose content changed
+     */
+    void resourceUpdated(const juce::URL &url) override;
+
     /**
      * @brief Parses the gear library data from JSON format.
      *
@@ -257,13 +429,79 @@ private:
      */
     void parseGearLibrary(const juce::String &jsonData);
 
+    /**
+     * @brief Builds a catalogue from the library index.
+     *
+     * Safe to call from a background thread.
+     *
+     * @param jsonData The JSON string containing gear library data
+     * @param shouldAbort Optional check polled between units
+     * @return The catalogue, or nullptr if the data is unusable or the build was aborted
+     */
+    std::unique_ptr<GearCatalogue> buildCatalogue(const juce::String &jsonData,
+                                                  const GearCatalogueLoader::AbortCheck &shouldAbort) const;
+
+    /**
+     * @brief Resolves the relative schema and thumbnail paths of a unit.
+     *
+     * @param record The unit as read from index.json
+     */
+    static void resolveResourcePaths(GearCatalogueRecord &record);
+
+    /**
+     * @brief Replaces the catalogue if it differs and updates the tree over it.
+     *
+     * @param loaded The new catalogue; receives the old one, which is released afterwards
+     */
+    void installCatalogue(std::unique_ptr<GearCatalogue> loaded);
+
+    /**
+     * @brief Brings the unfiltered tree up to date with the catalogue.
+     *
+     * Existing sections and groups are updated in place, so their openness
+     * and the scroll position are kept.
+     *
+     * @param previousIndices For each entry, the index its unit had in the replaced catalogue, or -1 if it is new
+     */
+    void updateTreeItems(const juce::Array<int> &previousIndices);
+
+    /**
+     * @brief Adds a category group to the My Gear section for each category of the favorites.
+     *
+     * @param favoritesItem The My Gear section
+     * @param favoriteIndices Indices of the favorite items, ascending
+     */
+    void addFavoriteCategoryGroups(GearTreeItem &favoritesItem, const juce::Array<int> &favoriteIndices);
+
+    /**
+     * @brief Called on the message thread when a background load finishes.
+     *
+     * @param loaded The new catalogue, or nullptr if the load failed
+     */
+    void handleCatalogueLoaded(std::unique_ptr<GearCatalogue> loaded);
+
     /**
      * @brief Determines if a gear item should be shown based on current search.
      *
-     * @param item The gear item to check
+     * @param itemIndex Index of the gear item to check
      * @return true if the item should be shown
      */
-    bool shouldShowItem(const GearItem &item) const;
+    bool shouldShowItem(int itemIndex) const;
+
+    /**
+     * @brief Rebuilds the tree from a set of search matches.
+     *
+     * @param matches Indices of the items matching the current search text
+     *                and facet filter, best first; ignored when neither is active
+     */
+    void showFilteredItems(const juce::Array<int> &matches);
+
+    /**
+     * @brief Gets the facet entries the current filter allows, for the search worker.
+     *
+     * @return The allowed entries, or nullptr if the filter is inactive
+     */
+    std::shared_ptr<const juce::BigInteger> getFacetMask() const;
 
     // UI components
     juce::Label titleLabel{"titleLabel", "Gear Library"};                                                            ///< Title label for the library
@@ -277,25 +515,23 @@ private:
     std::unique_ptr<GearTreeItem> rootItem;       ///< Root item of the tree view
 
     // Data
-    juce::Array<GearItem> gearItems; ///< Array of all gear items
+    GearCatalogue catalogue;                   ///< All library entries with their unit ID, search and facet indices
+    juce::HashMap<int, juce::Image> thumbnails; ///< Thumbnails loaded so far, by entry index
 
     // Search state
-    juce::String currentSearchText; ///< Current search text
-
-    /**
-     * @brief Normalizes text for fuzzy search by removing ignored characters.
-     *
-     * @param text The text to normalize
-     * @return The normalized text (lowercase with ignored characters removed)
-     */
-    juce::String normalizeForSearch(const juce::String &text) const;
-
-    /**
-     * @brief Gets the list of characters to ignore during search.
-     *
-     * @return Array of characters that should be ignored during fuzzy matching
-     */
-    static juce::Array<juce::juce_wchar> getIgnoredCharacters();
+    juce::String currentSearchText;                     ///< Current search text
+    juce::String normalizedSearchText;                                 ///< Current search text after GearCatalogue::normalizeForSearch
+    juce::StringArray searchWords;                                     ///< Current search text split into normalised words
+    GearSearchRanker searchRanker{GearCatalogue::SEARCH_KEY_SEPARATOR}; ///< Orders matches for synchronous updates
+    GearSearchWorker searchWorker;                                     ///< Matches and ranks typed queries off the message thread
+    GearFacetIndex::Filter facetFilter;                                ///< Facet values the tree is filtered by
+    GearFacetIndex::Result facetResult;                                ///< Matches and counts for the current search and facet filter
+
+    // Loading state
+    GearCatalogueLoader catalogueLoader;                  ///< Fetches and parses the library off the message thread
+    std::vector<std::function<void()>> loadedCallbacks; ///< Waiting for the current background load to be installed
+    bool libraryLoadRequested = false;                  ///< Whether loadLibraryAsync() has been called, so updates should reload
+    GearThumbnailLoader thumbnailLoader;                  ///< Fetches and decodes thumbnails off the paint path
 
     INetworkFetcher &networkFetcher; ///< Reference to the network fetcher
     IFileSystem &fileSystem;         ///< Reference to the file system
@@ -334,11 +570,10 @@ public:
      * @param nameIn The name of the item
      * @param ownerIn Pointer to the owning GearLibrary
      * @param cacheManagerIn Reference to the cache manager
-     * @param gearItemIn Pointer to the associated gear item (for gear items)
-     * @param gearIndexIn Index of the gear item (for gear items)
+     * @param itemIndexIn Index of the library entry (for gear items)
      */
-    GearTreeItem(ItemType typeIn, const juce::String &nameIn, GearLibrary *ownerIn, CacheManager *cacheManagerIn = nullptr, GearItem *gearItemIn = nullptr, int itemIndexIn = -1)
-        : type(typeIn), name(nameIn), owner(ownerIn), cacheManager(cacheManagerIn), gearItem(gearItemIn), itemIndex(itemIndexIn)
+    GearTreeItem(ItemType typeIn, const juce::String &nameIn, GearLibrary *ownerIn, CacheManager *cacheManagerIn = nullptr, int itemIndexIn = -1)
+        : type(typeIn), name(nameIn), owner(ownerIn), cacheManager(cacheManagerIn), itemIndex(itemIndexIn)
     {
         // Debug: Log cacheManager for gear items
         // juce::Logger::writeToLog("GearTreeItem constructor for: " + nameIn + " - cacheManager: " + (cacheManagerIn != nullptr ? "valid" : "null"));
@@ -389,13 +624,13 @@ public:
             // Debug: Log cacheManager state for Categories tree items
             if (name.contains("LA-2A") || name.contains("1176"))
             {
-                // juce::Logger::writeToLog("paintItem for: " + name + " - cacheManager: " + (cacheManager != nullptr ? "valid" : "null") + " gearItem: " + (gearItem != nullptr ? "valid" : "null"));
+                // juce::Logger::writeToLog("paintItem for: " + name + " - cacheManager: " + (cacheManager != nullptr ? "valid" : "null") + " entry: " + (hasEntry() ? "valid" : "null"));
             }
 
             // Draw star icon for favorites first (far left)
-            if (gearItem != nullptr && cacheManager != nullptr)
+            if (hasEntry() && cacheManager != nullptr)
             {
-                bool isFavorite = cacheManager->isFavorite(gearItem->unitId);
+                bool isFavorite = cacheManager->isFavorite(getUnitId());
 
                 // Debug: Log star drawing for Categories tree
                 if (name.contains("LA-2A") || name.contains("1176")) // Common test items
@@ -427,7 +662,7 @@ public:
                 // Debug: Log when star is not drawn
                 if (name.contains("LA-2A") || name.contains("1176"))
                 {
-                    // juce::Logger::writeToLog("NOT drawing star for: " + name + " - gearItem: " + (gearItem != nullptr ? "valid" : "null") + " cacheManager: " + (cacheManager != nullptr ? "valid" : "null"));
+                    // juce::Logger::writeToLog("NOT drawing star for: " + name + " - entry: " + (hasEntry() ? "valid" : "null") + " cacheManager: " + (cacheManager != nullptr ? "valid" : "null"));
                 }
             }
 
@@ -437,18 +672,15 @@ public:
             const int iconSize = 24;
             const int iconY = (height - iconSize) / 2;
 
-            if (gearItem != nullptr)
-            {
-                // Try to load image if not already loaded
-                if (!gearItem->image.isValid())
-                {
-                    gearItem->loadImage();
-                }
+            // Requests the thumbnail if it is not loaded; the placeholder is drawn until it arrives
+            auto thumbnail = hasEntry() ? owner->getThumbnail(itemIndex) : juce::Image();
 
-                if (gearItem->image.isValid())
+            if (hasEntry())
+            {
+                if (thumbnail.isValid())
                 {
                     // Use the gear item's thumbnail image if available
-                    g.drawImageWithin(gearItem->image,
+                    g.drawImageWithin(thumbnail,
                                       textX, iconY,
                                       iconSize, iconSize,
                                       juce::RectanglePlacement::centred | juce::RectanglePlacement::onlyReduceInSize);
@@ -481,8 +713,183 @@ public:
      */
     void itemOpennessChanged(bool isNowOpen) override
     {
-        if (isNowOpen && getNumSubItems() == 0)
-            refreshSubItems();
+        if (isNowOpen)
+        {
+            if (getNumSubItems() == 0)
+                refreshSubItems();
+        }
+        else if (hasItemIndices)
+        {
+            // Closed groups give their rows back; they are rebuilt from the index list on reopening
+            clearSubItems();
+        }
+    }
+
+    /**
+     * @brief Sets the library items this group shows when opened.
+     *
+     * Gear rows are only created when the group is opened and are released
+     * again when it is closed, so closed groups cost a single row however
+     * many items they hold.
+     *
+     * @param indices Indices into the library's items, in display order
+     */
+    void setItemIndices(const juce::Array<int> &indices)
+    {
+        itemIndices = indices;
+        hasItemIndices = true;
+
+        if (getNumSubItems() > 0)
+            clearSubItems();
+    }
+
+    /**
+     * @brief Gets the library items this group shows when opened.
+     *
+     * @return Indices into the library's items, in display order
+     */
+    const juce::Array<int> &getItemIndices() const
+    {
+        return itemIndices;
+    }
+
+    /**
+     * @brief Updates the library items of a group after the library has changed.
+     *
+     * Unlike setItemIndices(), an open group stays open and keeps the rows of
+     * units it still holds: they are re-pointed at their unit's new index and
+     * renamed if needed, and rows are only created or removed for units that
+     * joined or left the group.
+     *
+     * @param indices Indices into the library's items, in display order
+     * @param previousIndices For each library item, the index its unit had when the rows were made, or -1 if it is new
+     */
+    void updateItemIndices(const juce::Array<int> &indices, const juce::Array<int> &previousIndices)
+    {
+        itemIndices = indices;
+        hasItemIndices = true;
+
+        // Closed groups build their rows when opened
+        if (getNumSubItems() == 0 || owner == nullptr)
+            return;
+
+        juce::HashMap<int, int> newIndexOf;
+        for (int i = 0; i < previousIndices.size(); ++i)
+            if (previousIndices[i] >= 0)
+                newIndexOf.set(previousIndices[i], i);
+
+        // Re-point the rows of kept units and drop the rest
+        std::unordered_set<int> wanted(indices.begin(), indices.end());
+        for (int i = getNumSubItems(); --i >= 0;)
+        {
+            auto *row = dynamic_cast<GearTreeItem *>(getSubItem(i));
+            const int newIndex = row != nullptr && row->type == ItemType::Gear && newIndexOf.contains(row->itemIndex)
+                                     ? newIndexOf[row->itemIndex]
+                                     : -1;
+
+            if (newIndex < 0 || wanted.count(newIndex) == 0)
+            {
+                removeSubItem(i);
+                continue;
+            }
+
+            row->itemIndex = newIndex;
+            if (row->name != row->getUnitName())
+            {
+                row->name = row->getUnitName();
+                row->repaintItem();
+            }
+        }
+
+        // Put the kept rows in display order and add rows for units new to the group
+        const auto &items = owner->getCatalogue();
+        for (int position = 0; position < indices.size(); ++position)
+        {
+            const int index = indices[position];
+            if (!juce::isPositiveAndBelow(index, items.size()))
+                continue;
+
+            auto *row = position < getNumSubItems() ? dynamic_cast<GearTreeItem *>(getSubItem(position)) : nullptr;
+            if (row != nullptr && row->itemIndex == index)
+                continue;
+
+            GearTreeItem *keptRow = nullptr;
+            for (int i = position + 1; i < getNumSubItems() && keptRow == nullptr; ++i)
+            {
+                auto *candidate = dynamic_cast<GearTreeItem *>(getSubItem(i));
+                if (candidate != nullptr && candidate->itemIndex == index)
+                {
+                    removeSubItem(i, false);
+                    keptRow = candidate;
+                }
+            }
+
+            addSubItem(keptRow != nullptr ? keptRow : new GearTreeItem(ItemType::Gear, items[index].name, owner, &owner->getCacheManager(), index),
+                       position);
+        }
+
+        if (getNumSubItems() == 0)
+            addSubItem(new GearTreeItem(ItemType::Message, "No items in this category", owner, &owner->getCacheManager()));
+    }
+
+    /**
+     * @brief Updates the groups of the Categories section after the library has changed.
+     *
+     * Groups whose category is still present are kept, with their openness;
+     * groups are only added for new categories and removed for ones that
+     * have no items left.
+     *
+     * @param previousIndices For each library item, the index its unit had before the change, or -1 if it is new
+     */
+    void updateCategoryGroups(const juce::Array<int> &previousIndices)
+    {
+        jassert(type == ItemType::Category && name == "Categories");
+
+        if (owner == nullptr)
+            return;
+
+        // Groups are created when the section is first opened; one opened while empty is filled now
+        if (getNumSubItems() == 0)
+        {
+            if (TreeViewItem::isOpen())
+                refreshSubItems();
+            return;
+        }
+
+        const auto &categoryIndex = owner->getCatalogue().getCategoryIndex();
+        const int numGroups = categoryIndex.getNumGroups();
+
+        for (int c = 0; c < numGroups; ++c)
+        {
+            const auto &displayName = categoryIndex.getDisplayName(c);
+
+            // Look for the group among the ones not yet placed
+            GearTreeItem *categoryNode = nullptr;
+            for (int i = c; i < getNumSubItems() && categoryNode == nullptr; ++i)
+            {
+                auto *candidate = dynamic_cast<GearTreeItem *>(getSubItem(i));
+                if (candidate != nullptr && candidate->hasItemIndices && candidate->name == displayName)
+                {
+                    if (i != c)
+                    {
+                        removeSubItem(i, false);
+                        addSubItem(candidate, c);
+                    }
+                    categoryNode = candidate;
+                }
+            }
+
+            if (categoryNode == nullptr)
+            {
+                categoryNode = new GearTreeItem(ItemType::Category, displayName, owner, &owner->getCacheManager());
+                addSubItem(categoryNode, c);
+            }
+
+            categoryNode->updateItemIndices(categoryIndex.getEntries(c), previousIndices);
+        }
+
+        while (getNumSubItems() > numGroups)
+            removeSubItem(getNumSubItems() - 1);
     }
 
     /**
@@ -516,67 +923,52 @@ public:
 
                 if (!recentlyUsed.isEmpty())
                 {
-                    // Get all items from the library
-                    const auto &items = owner->getItems();
-
                     // Add each recently used item
                     for (const auto &unitId : recentlyUsed)
                     {
-                        // Find the gear item in the library
-                        for (int i = 0; i < items.size(); ++i)
-                        {
-                            const auto &item = items.getReference(i);
-                            if (item.unitId == unitId)
-                            {
-                                addSubItem(new GearTreeItem(ItemType::Gear, item.name, owner, cacheManager,
-                                                            const_cast<GearItem *>(&item), i));
-                                break;
-                            }
-                        }
+                        auto index = owner->getItemIndexByUnitId(unitId);
+                        if (index >= 0)
+                            addSubItem(new GearTreeItem(ItemType::Gear, owner->getCatalogue()[index].name, owner, cacheManager, index));
                     }
                 }
             }
         }
         else if (type == ItemType::Category && name == "Categories")
         {
-            // Get all items from the library
-            const auto &items = owner->getItems();
-
-            // Collect unique categories from the items
-            juce::StringArray categories;
+            const auto &categoryIndex = owner->getCatalogue().getCategoryIndex();
 
-            // First pass - gather all unique categories
-            for (int i = 0; i < items.size(); ++i)
+            // Add a GearTreeItem for each category; its gear rows are created when it is opened
+            for (int c = 0; c < categoryIndex.getNumGroups(); ++c)
             {
-                const auto &item = items.getReference(i);
-                if (!categories.contains(item.categoryString))
-                    categories.add(item.categoryString);
+                auto *categoryNode = new GearTreeItem(ItemType::Category, categoryIndex.getDisplayName(c), owner, &owner->getCacheManager());
+                categoryNode->setItemIndices(categoryIndex.getEntries(c));
+                addSubItem(categoryNode);
             }
-
-            // Add a GearTreeItem for each category
-            for (const auto &category : categories)
+        }
+        else if (type == ItemType::Category && hasItemIndices)
+        {
+            const auto &items = owner->getCatalogue();
+            for (auto index : itemIndices)
             {
-                // Format category name for display (capitalize first letter)
-                juce::String displayName = category.substring(0, 1).toUpperCase() + category.substring(1);
-                addSubItem(new GearTreeItem(ItemType::Category, displayName, owner, &owner->getCacheManager()));
+                if (juce::isPositiveAndBelow(index, items.size()))
+                    addSubItem(new GearTreeItem(ItemType::Gear, items[index].name, owner, &owner->getCacheManager(), index));
             }
+
+            if (getNumSubItems() == 0)
+                addSubItem(new GearTreeItem(ItemType::Message, "No items in this category", owner, &owner->getCacheManager()));
         }
         else if (type == ItemType::Category)
         {
-            // Get all items from the library
-            const auto &items = owner->getItems();
-            bool hasItems = false;
-            for (int i = 0; i < items.size(); ++i)
-            {
-                const auto &item = items.getReference(i);
-                if (item.categoryString.equalsIgnoreCase(name))
-                {
-                    addSubItem(new GearTreeItem(ItemType::Gear, item.name, owner, &owner->getCacheManager(),
-                                                const_cast<GearItem *>(&item), i));
-                    hasItems = true;
-                }
-            }
-            if (!hasItems)
+            // Look the category up by name
+            const auto &items = owner->getCatalogue();
+            const auto &categoryIndex = items.getCategoryIndex();
+            auto group = categoryIndex.findGroup(name);
+
+            if (group >= 0)
+                for (auto index : categoryIndex.getEntries(group))
+                    addSubItem(new GearTreeItem(ItemType::Gear, items[index].name, owner, &owner->getCacheManager(), index));
+
+            if (getNumSubItems() == 0)
             {
                 addSubItem(new GearTreeItem(ItemType::Message, "No items in this category", owner, &owner->getCacheManager()));
             }
@@ -653,7 +1045,7 @@ public:
         }
 
         // Handle star icon clicks for gear items
-        if (type == ItemType::Gear && gearItem != nullptr && e.mods.isLeftButtonDown())
+        if (type == ItemType::Gear && hasEntry() && e.mods.isLeftButtonDown())
         {
             // Check if click is in the left portion of the item where the star would be
             // The star is drawn at the left edge, so check if click is in the left 20 pixels
@@ -664,15 +1056,16 @@ public:
                 // Toggle favorite status
                 if (cacheManager != nullptr)
                 {
-                    bool isFavorite = cacheManager->isFavorite(gearItem->unitId);
+                    auto unitId = getUnitId();
+                    bool isFavorite = cacheManager->isFavorite(unitId);
 
                     if (isFavorite)
                     {
-                        cacheManager->removeFromFavorites(gearItem->unitId);
+                        cacheManager->removeFromFavorites(unitId);
                     }
                     else
                     {
-                        cacheManager->addToFavorites(gearItem->unitId);
+                        cacheManager->addToFavorites(unitId);
                     }
                 }
 
@@ -690,7 +1083,7 @@ public:
         TreeViewItem::itemClicked(e);
 
         // If this is a gear item, make it draggable
-        if (type == ItemType::Gear && gearItem != nullptr && e.mods.isLeftButtonDown())
+        if (type == ItemType::Gear && hasEntry() && e.mods.isLeftButtonDown())
         {
             // Find the parent drag container
             juce::Component *comp = getOwnerView();
@@ -718,10 +1111,10 @@ public:
 
             g.setColour(juce::Colours::white);
             g.setFont(14.0f);
-            g.drawText(gearItem->name, 30, 5, itemWidth - 40, 30, juce::Justification::centredLeft);
+            g.drawText(name, 30, 5, itemWidth - 40, 30, juce::Justification::centredLeft);
 
             // Create a structured drag description that the rack can recognize
-            juce::String dragDesc = "GEAR:" + juce::String(itemIndex) + ":" + gearItem->name;
+            juce::String dragDesc = "GEAR:" + juce::String(itemIndex) + ":" + name;
 
             // Calculate the drag image offset from the mouse
             juce::Point<int> imageOffset(e.x - 10, e.y - itemHeight / 2);
@@ -780,7 +1173,7 @@ public:
      */
     bool getOpenness() const
     {
-        return isOpen;
+        return TreeViewItem::isOpen();
     }
 
     juce::String getItemText() const
@@ -788,18 +1181,47 @@ public:
         return name;
     }
 
-    GearItem *getGearItem() const
+    /**
+     * @brief Gets the library entry this row shows.
+     *
+     * @return Index of the entry (for gear items), or -1
+     */
+    int getItemIndex() const
     {
-        return gearItem;
+        return itemIndex;
     }
 
 private:
-    ItemType type;              ///< Type of this tree item
-    juce::String name;          ///< Name of this tree item
-    GearLibrary *owner;         ///< Pointer to the owning GearLibrary
-    CacheManager *cacheManager; ///< Reference to the cache manager
-    GearItem *gearItem;         ///< Associated gear item (for gear items)
-    int itemIndex;              ///< Index of the gear item (for gear items)
-    bool isVisible{true};       ///< Whether this item is visible
-    bool isOpen{false};         ///< Whether this item is open
+    /**
+     * @brief Checks whether this row shows a library entry that still exists.
+     */
+    bool hasEntry() const
+    {
+        return owner != nullptr && juce::isPositiveAndBelow(itemIndex, owner->getCatalogue().size());
+    }
+
+    /**
+     * @brief Gets the unit ID of the entry this row shows.
+     */
+    juce::String getUnitId() const
+    {
+        return owner->getCatalogue()[itemIndex].unitId;
+    }
+
+    /**
+     * @brief Gets the current name of the entry this row shows.
+     */
+    juce::String getUnitName() const
+    {
+        return owner->getCatalogue()[itemIndex].name;
+    }
+
+    ItemType type;                ///< Type of this tree item
+    juce::String name;            ///< Name of this tree item
+    GearLibrary *owner;           ///< Pointer to the owning GearLibrary
+    CacheManager *cacheManager;   ///< Reference to the cache manager
+    int itemIndex;                ///< Index of the library entry (for gear items)
+    bool isVisible{true};         ///< Whether this item is visible
+    juce::Array<int> itemIndices; ///< Items shown when this group is opened
+    bool hasItemIndices{false};   ///< Whether sub-items come from itemIndices
 };
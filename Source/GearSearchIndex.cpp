@@ -0,0 +1,161 @@
+/**
+ * @file GearSearchIndex.cpp
+ * @brief Implementation of the GearSearchIndex class.
+ *
+ * This file implements trigram extraction, posting list construction and
+ * smallest-first posting list intersection for gear library searches.
+ */
+
+#include "GearSearchIndex.h"
+#include <algorithm>
+
+GearSearchIndex::GearSearchIndex(juce::juce_wchar fieldSeparator)
+    : separator(fieldSeparator)
+{
+}
+
+void GearSearchIndex::clear()
+{
+    keys.clear();
+    postingLists.clear();
+}
+
+void GearSearchIndex::reserve(int numEntries)
+{
+    keys.ensureStorageAllocated(numEntries);
+}
+
+int GearSearchIndex::addEntry(const juce::String &key)
+{
+    const int entryIndex = keys.size();
+    keys.add(key);
+
+    for (auto trigram : getTrigrams(key))
+    {
+        // Entries are appended in order, so each list stays sorted
+        auto &postings = postingLists[trigram];
+        if (postings.empty() || postings.back() != entryIndex)
+            postings.push_back(entryIndex);
+    }
+
+    return entryIndex;
+}
+
+const juce::String &GearSearchIndex::getKey(int entryIndex) const
+{
+    static const juce::String empty;
+    return juce::isPositiveAndBelow(entryIndex, keys.size()) ? keys.getReference(entryIndex) : empty;
+}
+
+bool GearSearchIndex::matches(int entryIndex, const juce::String &normalizedQuery) const
+{
+    return getKey(entryIndex).contains(normalizedQuery);
+}
+
+juce::Array<int> GearSearchIndex::find(const juce::String &normalizedQuery, const AbortCheck &shouldAbort) const
+{
+    juce::Array<int> result;
+
+    if (normalizedQuery.length() < 3)
+    {
+        // Too short to have a trigram; these queries match most of the catalogue anyway
+        for (int i = 0; i < keys.size(); ++i)
+        {
+            if (shouldAbort && (i % ABORT_CHECK_INTERVAL) == 0 && shouldAbort())
+                return {};
+
+            if (keys.getReference(i).contains(normalizedQuery))
+                result.add(i);
+        }
+        return result;
+    }
+
+    // Gather the posting lists, giving up as soon as one trigram is unknown
+    std::vector<const std::vector<int> *> lists;
+    for (auto trigram : getTrigrams(normalizedQuery))
+    {
+        auto it = postingLists.find(trigram);
+        if (it == postingLists.end())
+            return result;
+        lists.push_back(&it->second);
+    }
+
+    if (lists.empty())
+        return result;
+
+    // Intersect smallest first so the candidate set only shrinks
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<int> *a, const std::vector<int> *b)
+              { return a->size() < b->size(); });
+
+    std::vector<int> candidates(*lists.front());
+    std::vector<int> intersection;
+    for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i)
+    {
+        if (shouldAbort && shouldAbort())
+            return {};
+
+        intersection.clear();
+        std::set_intersection(candidates.begin(), candidates.end(),
+                              lists[i]->begin(), lists[i]->end(),
+                              std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+
+    // Sharing every trigram does not guarantee the trigrams are contiguous
+    result.ensureStorageAllocated((int)candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        if (shouldAbort && (i % (size_t)ABORT_CHECK_INTERVAL) == 0 && shouldAbort())
+            return {};
+
+        if (keys.getReference(candidates[i]).contains(normalizedQuery))
+            result.add(candidates[i]);
+    }
+
+    return result;
+}
+
+juce::Array<int> GearSearchIndex::refine(const juce::Array<int> &candidates, const juce::String &normalizedQuery,
+                                         const AbortCheck &shouldAbort) const
+{
+    juce::Array<int> result;
+    result.ensureStorageAllocated(candidates.size());
+
+    for (int i = 0; i < candidates.size(); ++i)
+    {
+        if (shouldAbort && (i % ABORT_CHECK_INTERVAL) == 0 && shouldAbort())
+            return {};
+
+        const int entryIndex = candidates.getUnchecked(i);
+        if (juce::isPositiveAndBelow(entryIndex, keys.size()) && keys.getReference(entryIndex).contains(normalizedQuery))
+            result.add(entryIndex);
+    }
+
+    return result;
+}
+
+std::vector<GearSearchIndex::Trigram> GearSearchIndex::getTrigrams(const juce::String &text) const
+{
+    std::vector<Trigram> trigrams;
+
+    auto a = text.getCharPointer();
+    if (a.isEmpty())
+        return trigrams;
+
+    auto b = a + 1;
+    if (b.isEmpty())
+        return trigrams;
+
+    for (auto c = b + 1; !c.isEmpty(); ++a, ++b, ++c)
+    {
+        if (*a == separator || *b == separator || *c == separator)
+            continue;
+
+        trigrams.push_back(makeTrigram(*a, *b, *c));
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
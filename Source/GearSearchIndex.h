@@ -0,0 +1,146 @@
+/**
+ * @file GearSearchIndex.h
+ * @brief Header file for the GearSearchIndex class.
+ *
+ * This file defines the GearSearchIndex class, a trigram inverted index over
+ * the normalised search keys of the gear library, used to find substring
+ * matches without scanning every item.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Trigram inverted index over normalised search keys.
+ *
+ * Each key is split into overlapping three-character sequences, and every
+ * trigram maps to the ascending list of entries containing it. A query of
+ * three or more characters intersects the posting lists of its trigrams,
+ * smallest first, and only the surviving candidates are checked with a
+ * substring test, so the cost follows the number of matches rather than the
+ * size of the catalogue. Shorter queries match too much of the catalogue for
+ * an index to help and fall back to a scan.
+ *
+ * Keys may hold several fields separated by a separator character; trigrams
+ * spanning the separator are not indexed, because queries never contain it.
+ */
+class GearSearchIndex
+{
+public:
+    /**
+     * @brief Polled during long searches; returning true abandons the search.
+     */
+    using AbortCheck = std::function<bool()>;
+
+    /**
+     * @brief Constructs an empty index.
+     *
+     * @param fieldSeparator Character separating fields within a key
+     */
+    explicit GearSearchIndex(juce::juce_wchar fieldSeparator = '\n');
+
+    /**
+     * @brief Removes every entry.
+     */
+    void clear();
+
+    /**
+     * @brief Reserves space for a number of entries.
+     *
+     * @param numEntries The expected number of entries
+     */
+    void reserve(int numEntries);
+
+    /**
+     * @brief Appends an entry to the index.
+     *
+     * @param key The normalised search key for the entry
+     * @return The index of the new entry
+     */
+    int addEntry(const juce::String &key);
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @return The number of entries added since the last clear()
+     */
+    int size() const { return keys.size(); }
+
+    /**
+     * @brief Gets the character separating fields within a key.
+     *
+     * @return The field separator
+     */
+    juce::juce_wchar getFieldSeparator() const { return separator; }
+
+    /**
+     * @brief Gets the key of an entry.
+     *
+     * @param entryIndex The entry index
+     * @return The key, or an empty string if the index is out of range
+     */
+    const juce::String &getKey(int entryIndex) const;
+
+    /**
+     * @brief Finds the entries whose key contains a normalised query.
+     *
+     * @param normalizedQuery The query, already normalised like the keys
+     * @param shouldAbort Optional check polled while searching
+     * @return Indices of the matching entries, in ascending order; empty if aborted
+     */
+    juce::Array<int> find(const juce::String &normalizedQuery, const AbortCheck &shouldAbort = nullptr) const;
+
+    /**
+     * @brief Narrows an earlier result set down to the entries matching a query.
+     *
+     * When a query extends the one that produced the candidates, every match
+     * is already among them, so only the candidates need checking.
+     *
+     * @param candidates Ascending entry indices from an earlier search of this index
+     * @param normalizedQuery The query, already normalised like the keys
+     * @param shouldAbort Optional check polled while searching
+     * @return Indices of the matching entries, in ascending order; empty if aborted
+     */
+    juce::Array<int> refine(const juce::Array<int> &candidates, const juce::String &normalizedQuery,
+                            const AbortCheck &shouldAbort = nullptr) const;
+
+    /**
+     * @brief Checks whether a single entry contains a normalised query.
+     *
+     * @param entryIndex The entry index
+     * @param normalizedQuery The query, already normalised like the keys
+     * @return true if the entry matches
+     */
+    bool matches(int entryIndex, const juce::String &normalizedQuery) const;
+
+private:
+    using Trigram = juce::uint64;
+
+    static constexpr int ABORT_CHECK_INTERVAL = 1024; ///< Entries checked between abort checks
+
+    /**
+     * @brief Packs three characters into a trigram code.
+     */
+    static Trigram makeTrigram(juce::juce_wchar a, juce::juce_wchar b, juce::juce_wchar c)
+    {
+        return ((Trigram)(juce::uint32)a << 42) | ((Trigram)(juce::uint32)b << 21) | (Trigram)(juce::uint32)c;
+    }
+
+    /**
+     * @brief Collects the distinct trigrams of a string, skipping those that span a separator.
+     *
+     * @param text The string to split
+     * @return The trigram codes
+     */
+    std::vector<Trigram> getTrigrams(const juce::String &text) const;
+
+    juce::juce_wchar separator;                                  ///< Field separator within keys
+    juce::Array<juce::String> keys;                             ///< Key per entry
+    std::unordered_map<Trigram, std::vector<int>> postingLists; ///< Trigram -> ascending entry indices
+
+    JUCE_LEAK_DETECTOR(GearSearchIndex)
+};
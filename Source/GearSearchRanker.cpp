@@ -0,0 +1,292 @@
+/**
+ * @file GearSearchRanker.cpp
+ * @brief Implementation of the GearSearchRanker class.
+ *
+ * This file implements word scoring, approximate substring matching and
+ * bounded top-K selection for ranked gear library searches. Keys and words
+ * are compared as UTF-8 bytes so scoring a key allocates nothing.
+ */
+
+#include "GearSearchRanker.h"
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <vector>
+
+namespace
+{
+    /** Longer words are not matched approximately. */
+    constexpr int maxApproximateWordLength = 64;
+
+    /** A run of UTF-8 bytes inside a key or word. */
+    struct Span
+    {
+        const char *data = nullptr;
+        int length = 0;
+    };
+
+    Span toSpan(const juce::String &text)
+    {
+        return {text.toRawUTF8(), (int)text.getNumBytesAsUTF8()};
+    }
+
+    bool startsWith(Span field, Span word)
+    {
+        return field.length >= word.length && std::memcmp(field.data, word.data, (size_t)word.length) == 0;
+    }
+
+    bool contains(Span field, Span word)
+    {
+        return std::search(field.data, field.data + field.length, word.data, word.data + word.length) != field.data + field.length;
+    }
+
+    /** Score for the word as an in-order subsequence, favouring compact matches; 0 if it is not one. */
+    int scoreSubsequence(Span field, Span word)
+    {
+        if (word.length < 3)
+            return 0;
+
+        int first = -1;
+        int position = 0;
+        for (int i = 0; i < word.length; ++i)
+        {
+            while (position < field.length && field.data[position] != word.data[i])
+                ++position;
+
+            if (position == field.length)
+                return 0;
+
+            if (first < 0)
+                first = position;
+            ++position;
+        }
+
+        const int span = position - first;
+        return 10 + (GearSearchRanker::SCORE_SUBSEQUENCE - 10) * word.length / span;
+    }
+
+    /** Sellers' algorithm: edit distance from the word to the best matching substring of the field. */
+    int substringDistance(Span word, Span field, int maxDistance)
+    {
+        int previous[maxApproximateWordLength + 1];
+        int current[maxApproximateWordLength + 1];
+
+        for (int j = 0; j <= word.length; ++j)
+            previous[j] = j;
+
+        int best = previous[word.length];
+        for (int i = 0; i < field.length && best > 0; ++i)
+        {
+            current[0] = 0; // A match may start anywhere in the field
+
+            for (int j = 1; j <= word.length; ++j)
+            {
+                const int substitution = previous[j - 1] + (word.data[j - 1] != field.data[i] ? 1 : 0);
+                current[j] = std::min({substitution, previous[j] + 1, current[j - 1] + 1});
+            }
+
+            best = std::min(best, current[word.length]);
+            std::copy(current, current + word.length + 1, previous);
+        }
+
+        return std::min(best, maxDistance + 1);
+    }
+
+    int scoreSpan(Span word, Span field)
+    {
+        if (word.length == 0 || field.length == 0)
+            return 0;
+
+        if (startsWith(field, word))
+            return field.length == word.length ? GearSearchRanker::SCORE_WHOLE_FIELD : GearSearchRanker::SCORE_PREFIX;
+
+        if (contains(field, word))
+            return GearSearchRanker::SCORE_SUBSTRING;
+
+        if (auto subsequenceScore = scoreSubsequence(field, word))
+            return subsequenceScore;
+
+        const int maxTypos = GearSearchRanker::getMaxTypos(word.length);
+        if (maxTypos > 0 && word.length <= maxApproximateWordLength)
+        {
+            const int distance = substringDistance(word, field, maxTypos);
+            if (distance <= maxTypos)
+                return GearSearchRanker::SCORE_TYPO - 10 * (distance - 1);
+        }
+
+        return 0;
+    }
+
+    /** Orders entries best first: higher score, then earlier in the catalogue. */
+    struct ScoredEntry
+    {
+        int entryIndex;
+        int score;
+    };
+
+    struct IsBetter
+    {
+        bool operator()(const ScoredEntry &a, const ScoredEntry &b) const
+        {
+            return a.score != b.score ? a.score > b.score : a.entryIndex < b.entryIndex;
+        }
+    };
+}
+
+GearSearchRanker::GearSearchRanker(juce::juce_wchar fieldSeparator, const juce::Array<int> &fieldWeights)
+    : separator((char)fieldSeparator),
+      fieldWeights(fieldWeights)
+{
+    jassert(fieldSeparator < 128);
+
+    if (this->fieldWeights.isEmpty())
+        this->fieldWeights.add(100);
+}
+
+juce::Array<int> GearSearchRanker::getDefaultFieldWeights()
+{
+    return {100, 70, 40, 50};
+}
+
+int GearSearchRanker::getFieldWeight(int fieldIndex) const
+{
+    return fieldWeights[juce::jmin(fieldIndex, fieldWeights.size() - 1)];
+}
+
+int GearSearchRanker::getMaxTypos(int wordLength)
+{
+    if (wordLength < 4)
+        return 0;
+
+    return wordLength < 8 ? 1 : 2;
+}
+
+int GearSearchRanker::scoreField(const juce::String &word, const juce::String &field)
+{
+    return scoreSpan(toSpan(word), toSpan(field));
+}
+
+int GearSearchRanker::substringEditDistance(const juce::String &word, const juce::String &text, int maxDistance)
+{
+    auto wordSpan = toSpan(word);
+    if (wordSpan.length > maxApproximateWordLength)
+        return maxDistance + 1;
+
+    return substringDistance(wordSpan, toSpan(text), maxDistance);
+}
+
+int GearSearchRanker::scoreKey(const juce::String &key, const juce::StringArray &queryWords) const
+{
+    if (queryWords.isEmpty())
+        return 0;
+
+    const Span keySpan = toSpan(key);
+    int total = 0;
+
+    for (const auto &queryWord : queryWords)
+    {
+        const Span word = toSpan(queryWord);
+        int best = 0;
+
+        const char *fieldStart = keySpan.data;
+        const char *keyEnd = keySpan.data + keySpan.length;
+        for (int fieldIndex = 0;; ++fieldIndex)
+        {
+            auto *fieldEnd = std::find(fieldStart, keyEnd, separator);
+            const Span field{fieldStart, (int)(fieldEnd - fieldStart)};
+
+            // Weighted scores can only be beaten by a better match in a heavier field
+            const int weight = getFieldWeight(fieldIndex);
+            if (SCORE_WHOLE_FIELD * weight / 100 > best)
+                best = juce::jmax(best, scoreSpan(word, field) * weight / 100);
+
+            if (fieldEnd == keyEnd)
+                break;
+
+            fieldStart = fieldEnd + 1;
+        }
+
+        if (best == 0)
+            return 0;
+
+        total += best;
+    }
+
+    return total;
+}
+
+juce::Array<int> GearSearchRanker::rank(const GearSearchIndex &index,
+                                        const juce::Array<int> &exactMatches,
+                                        const juce::StringArray &queryWords,
+                                        int maxResults,
+                                        const GearSearchIndex::AbortCheck &shouldAbort,
+                                        const juce::BigInteger *allowedEntries) const
+{
+    jassert(index.getFieldSeparator() == (juce::juce_wchar)separator);
+
+    if (queryWords.isEmpty() || maxResults <= 0)
+        return {};
+
+    // Bounded heap with the worst kept entry on top
+    std::priority_queue<ScoredEntry, std::vector<ScoredEntry>, IsBetter> best;
+    const IsBetter isBetter;
+
+    auto consider = [&](int entryIndex, int score)
+    {
+        ScoredEntry entry{entryIndex, score};
+        if ((int)best.size() < maxResults)
+        {
+            best.push(entry);
+        }
+        else if (isBetter(entry, best.top()))
+        {
+            best.pop();
+            best.push(entry);
+        }
+    };
+
+    const bool fuzzy = exactMatches.isEmpty();
+    const int numToScore = fuzzy ? index.size() : exactMatches.size();
+
+    for (int i = 0; i < numToScore; ++i)
+    {
+        if (shouldAbort && (i % ABORT_CHECK_INTERVAL) == 0 && shouldAbort())
+            return {};
+
+        const int entryIndex = fuzzy ? i : exactMatches.getUnchecked(i);
+        if (allowedEntries != nullptr && !(*allowedEntries)[entryIndex])
+            continue;
+
+        const int score = scoreKey(index.getKey(entryIndex), queryWords);
+
+        if (score > 0)
+            consider(entryIndex, score);
+        else if (!fuzzy)
+            consider(entryIndex, 1); // Contains the whole query, so it always matches
+    }
+
+    juce::Array<int> result;
+    result.resize((int)best.size());
+    for (int i = result.size(); --i >= 0;)
+    {
+        result.set(i, best.top().entryIndex);
+        best.pop();
+    }
+
+    return result;
+}
+
+juce::StringArray GearSearchRanker::splitIntoWords(const juce::String &text,
+                                                   const std::function<juce::String(const juce::String &)> &normalizeWord)
+{
+    juce::StringArray words;
+
+    for (const auto &token : juce::StringArray::fromTokens(text, " \t", ""))
+    {
+        auto word = normalizeWord ? normalizeWord(token) : token;
+        if (word.isNotEmpty())
+            words.add(word);
+    }
+
+    return words;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file GearSearchRanker.h
+ * @brief Header file for the GearSearchRanker class.
+ *
+ * This file defines the GearSearchRanker class, which scores gear library
+ * search keys against the words of a query, tolerating typos and words
+ * spread across fields, and keeps only the best results.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearSearchIndex.h"
+#include <functional>
+
+/**
+ * @brief Scores and ranks search keys against a multi-word query.
+ *
+ * Each query word is scored against every field of a key and the best field
+ * counts, weighted by which field it was (name above manufacturer above
+ * category and tags). A word scores highest as the whole field, then as a
+ * prefix, then as a substring, then as an in-order subsequence, and finally
+ * as an approximate substring within a small edit distance. A key matches
+ * only if every word scores.
+ *
+ * The best results are selected with a bounded min-heap, so ranking costs
+ * O(n log k) for n scored keys and k results. Words longer than 64 bytes
+ * are not matched approximately.
+ */
+class GearSearchRanker
+{
+public:
+    /**
+     * @brief Default number of results kept by rank().
+     */
+    static constexpr int DEFAULT_MAX_RESULTS = 100;
+
+    /**
+     * @brief Constructs a ranker.
+     *
+     * @param fieldSeparator Character separating fields within a key; must be ASCII
+     * @param fieldWeights Percentage weight per field in key order; the last
+     *                     weight applies to every further field
+     */
+    explicit GearSearchRanker(juce::juce_wchar fieldSeparator = '\n',
+                              const juce::Array<int> &fieldWeights = getDefaultFieldWeights());
+
+    /**
+     * @brief Gets the default field weights.
+     *
+     * Name 100%, manufacturer 70%, category 40%, and 50% for each tag.
+     *
+     * @return Percentage weight per field in key order
+     */
+    static juce::Array<int> getDefaultFieldWeights();
+
+    /**
+     * @brief Ranks the entries matching a query.
+     *
+     * If exactMatches is not empty only those entries are ranked, since they
+     * already contain the whole query. Otherwise every entry of the index is
+     * scored fuzzily, so typos and words spread over several fields still match.
+     * When allowedEntries is given, entries outside it are never returned;
+     * exact matches should already be restricted to it, see GearFacetIndex::intersect.
+     *
+     * @param index The index holding the keys
+     * @param exactMatches Entries containing the whole normalised query, from GearSearchIndex::find
+     * @param queryWords The normalised words of the query
+     * @param maxResults Maximum number of results to return
+     * @param shouldAbort Optional check polled while scoring
+     * @param allowedEntries Optional bitset of the entries that may match, such as a facet filter
+     * @return Matching entry indices, best first; empty if aborted
+     */
+    juce::Array<int> rank(const GearSearchIndex &index,
+                          const juce::Array<int> &exactMatches,
+                          const juce::StringArray &queryWords,
+                          int maxResults = DEFAULT_MAX_RESULTS,
+                          const GearSearchIndex::AbortCheck &shouldAbort = nullptr,
+                          const juce::BigInteger *allowedEntries = nullptr) const;
+
+    /**
+     * @brief Scores a key against the words of a query.
+     *
+     * @param key The normalised search key
+     * @param queryWords The normalised words of the query
+     * @return The weighted score, or 0 if any word does not match
+     */
+    int scoreKey(const juce::String &key, const juce::StringArray &queryWords) const;
+
+    /**
+     * @brief Scores one word against one field.
+     *
+     * @param word The normalised word
+     * @param field The normalised field
+     * @return The unweighted score, or 0 if the word does not match
+     */
+    static int scoreField(const juce::String &word, const juce::String &field);
+
+    /**
+     * @brief Finds the smallest edit distance between a word and any substring of a text.
+     *
+     * @param word The word to look for
+     * @param text The text to search
+     * @param maxDistance The largest distance of interest
+     * @return The distance, or maxDistance + 1 if it is larger than maxDistance
+     */
+    static int substringEditDistance(const juce::String &word, const juce::String &text, int maxDistance);
+
+    /**
+     * @brief Number of typos tolerated in a word of a given length.
+     *
+     * @param wordLength Length of the word in characters
+     * @return The largest edit distance that still matches
+     */
+    static int getMaxTypos(int wordLength);
+
+    /**
+     * @brief Splits typed text into words.
+     *
+     * @param text The text typed by the user
+     * @param normalizeWord Normalises each word like the keys; empty results are dropped
+     * @return The normalised words
+     */
+    static juce::StringArray splitIntoWords(const juce::String &text,
+                                            const std::function<juce::String(const juce::String &)> &normalizeWord);
+
+    // Unweighted scores for each kind of match
+    static constexpr int SCORE_WHOLE_FIELD = 100; ///< Word equals the field
+    static constexpr int SCORE_PREFIX = 80;       ///< Field starts with the word
+    static constexpr int SCORE_SUBSTRING = 60;    ///< Field contains the word
+    static constexpr int SCORE_SUBSEQUENCE = 40;  ///< Best in-order subsequence score
+    static constexpr int SCORE_TYPO = 30;         ///< Approximate substring with one typo
+
+private:
+    /**
+     * @brief Gets the weight of a field.
+     *
+     * @param fieldIndex Position of the field in the key
+     * @return The percentage weight
+     */
+    int getFieldWeight(int fieldIndex) const;
+
+    char separator;                ///< Field separator within keys
+    juce::Array<int> fieldWeights; ///< Percentage weight per field in key order
+
+    static constexpr int ABORT_CHECK_INTERVAL = 256; ///< Keys scored between abort checks
+
+    JUCE_LEAK_DETECTOR(GearSearchRanker)
+};
@@ -0,0 +1,188 @@
+/**
+ * @file GearSearchWorker.cpp
+ * @brief Implementation of the GearSearchWorker class.
+ *
+ * This file implements the debounce loop, cancellation by generation count,
+ * incremental refinement and delivery of results to the message thread.
+ */
+
+#include "GearSearchWorker.h"
+
+GearSearchWorker::GearSearchWorker(int debounceMs, int maxResults)
+    : juce::Thread("AnalogIQ Gear Search"),
+      debounceMs(juce::jmax(0, debounceMs)),
+      maxResults(juce::jmax(1, maxResults))
+{
+    idleEvent.signal();
+}
+
+GearSearchWorker::~GearSearchWorker()
+{
+    cancel();
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+    cancelPendingUpdate();
+}
+
+void GearSearchWorker::search(std::shared_ptr<const GearSearchIndex> index, const juce::String &normalizedQuery,
+                              const juce::StringArray &queryWords,
+                              std::shared_ptr<const juce::BigInteger> allowedEntries)
+{
+    if (index == nullptr)
+        return;
+
+    {
+        const juce::ScopedLock lock(requestLock);
+        pendingRequest.index = std::move(index);
+        pendingRequest.query = normalizedQuery;
+        pendingRequest.words = queryWords.isEmpty() ? juce::StringArray(normalizedQuery) : queryWords;
+        pendingRequest.allowedEntries = std::move(allowedEntries);
+        pendingRequest.generation = ++latestGeneration;
+        hasPendingRequest = true;
+        lastRequestTime = juce::Time::getMillisecondCounter();
+        idleEvent.reset();
+    }
+
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::normal);
+
+    notify();
+}
+
+void GearSearchWorker::cancel()
+{
+    {
+        const juce::ScopedLock lock(requestLock);
+        ++latestGeneration;
+        hasPendingRequest = false;
+        pendingRequest = {};
+        hasCompletedResult = false;
+        completedResult = {};
+    }
+
+    notify();
+}
+
+bool GearSearchWorker::waitUntilIdle(int timeoutMs)
+{
+    return idleEvent.wait(timeoutMs);
+}
+
+void GearSearchWorker::deliverPendingResult()
+{
+    handleUpdateNowIfNeeded();
+}
+
+void GearSearchWorker::run()
+{
+    while (!threadShouldExit())
+    {
+        Request request;
+
+        {
+            const juce::ScopedLock lock(requestLock);
+
+            if (!hasPendingRequest)
+            {
+                idleEvent.signal();
+            }
+            else
+            {
+                // Keep waiting while keystrokes are still arriving
+                auto elapsed = (int)(juce::Time::getMillisecondCounter() - lastRequestTime);
+                if (elapsed >= debounceMs)
+                {
+                    request = std::move(pendingRequest);
+                    pendingRequest = {};
+                    hasPendingRequest = false;
+                }
+            }
+        }
+
+        if (request.index == nullptr)
+        {
+            int waitMs;
+            {
+                const juce::ScopedLock lock(requestLock);
+                waitMs = hasPendingRequest ? juce::jmax(1, debounceMs - (int)(juce::Time::getMillisecondCounter() - lastRequestTime)) : -1;
+            }
+            wait(waitMs);
+            continue;
+        }
+
+        Result result;
+        if (!runSearch(request, result))
+            continue;
+
+        {
+            const juce::ScopedLock lock(requestLock);
+
+            // A newer query or a cancel arrived while this one was finishing
+            if (request.generation != latestGeneration.load())
+                continue;
+
+            completedResult = result;
+            completedGeneration = request.generation;
+            hasCompletedResult = true;
+        }
+
+        triggerAsyncUpdate();
+    }
+}
+
+bool GearSearchWorker::runSearch(const Request &request, Result &result)
+{
+    const auto generation = request.generation;
+    auto shouldAbort = [this, generation]
+    {
+        return threadShouldExit() || latestGeneration.load() != generation;
+    };
+
+    result.query = request.query;
+
+    // Every match for an extended query is also a match for the shorter one
+    result.refined = previousIndex == request.index && previousQuery.isNotEmpty() && request.query.contains(previousQuery);
+
+    juce::Array<int> exactMatches;
+    if (result.refined)
+        exactMatches = request.index->refine(previousExactMatches, request.query, shouldAbort);
+    else
+        exactMatches = request.index->find(request.query, shouldAbort);
+
+    if (shouldAbort())
+        return false;
+
+    previousIndex = request.index;
+    previousQuery = request.query;
+    previousExactMatches = exactMatches;
+
+    // Refinement works on every exact match, so the allowed entries are applied afterwards
+    auto *allowedEntries = request.allowedEntries.get();
+    auto allowedMatches = allowedEntries != nullptr ? GearFacetIndex::intersect(exactMatches, *allowedEntries) : exactMatches;
+
+    result.exactMatches = std::move(exactMatches);
+    result.fuzzy = allowedMatches.isEmpty();
+    result.matches = ranker.rank(*request.index, allowedMatches, request.words, maxResults, shouldAbort, allowedEntries);
+
+    return !shouldAbort();
+}
+
+void GearSearchWorker::handleAsyncUpdate()
+{
+    Result result;
+
+    {
+        const juce::ScopedLock lock(requestLock);
+
+        if (!hasCompletedResult || completedGeneration != latestGeneration.load())
+            return;
+
+        result = std::move(completedResult);
+        completedResult = {};
+        hasCompletedResult = false;
+    }
+
+    if (onResult)
+        onResult(result);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file GearSearchWorker.h
+ * @brief Header file for the GearSearchWorker class.
+ *
+ * This file defines the GearSearchWorker class, which runs gear library
+ * searches on a background thread so typing in the search box never waits
+ * for matching or for intermediate tree rebuilds.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "GearFacetIndex.h"
+#include "GearSearchIndex.h"
+#include "GearSearchRanker.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Debounced background search over a GearSearchIndex.
+ *
+ * Each call to search() replaces any query that has not finished. The worker
+ * waits until no new query has arrived for the debounce interval, matches the
+ * latest one, ranks the matches with a GearSearchRanker and hands the best
+ * ones to onResult on the message thread. A query that is superseded while it
+ * runs is abandoned, and results for stale queries are never delivered.
+ *
+ * Keys containing the whole query are found through the index and ranked;
+ * only when there are none is every key scored fuzzily. When a query extends
+ * the previous completed query on the same index, the previous exact matches
+ * are narrowed down instead of searching the index again.
+ */
+class GearSearchWorker : private juce::Thread,
+                         private juce::AsyncUpdater
+{
+public:
+    /**
+     * @brief Default quiet period after the last keystroke before searching.
+     */
+    static constexpr int DEFAULT_DEBOUNCE_MS = 150;
+
+    /**
+     * @brief The outcome of a completed search.
+     */
+    struct Result
+    {
+        juce::String query;       ///< The normalised query that was matched
+        juce::Array<int> matches;      ///< Indices of the best matching allowed entries, best first
+        juce::Array<int> exactMatches; ///< Every entry containing the whole query, allowed or not, in index order
+        bool refined = false;          ///< Whether the previous exact matches were narrowed instead of searching the index
+        bool fuzzy = false;            ///< Whether no allowed key contained the whole query, so matches are approximate
+    };
+
+    /**
+     * @brief Constructs a search worker.
+     *
+     * @param debounceMs Quiet period after the last query before searching
+     * @param maxResults Maximum number of matches delivered per query
+     */
+    explicit GearSearchWorker(int debounceMs = DEFAULT_DEBOUNCE_MS,
+                              int maxResults = GearSearchRanker::DEFAULT_MAX_RESULTS);
+
+    /**
+     * @brief Destructor. Abandons any search in progress and stops the thread.
+     */
+    ~GearSearchWorker() override;
+
+    /**
+     * @brief Called on the message thread with the result of the latest query.
+     */
+    std::function<void(const Result &)> onResult;
+
+    /**
+     * @brief Queues a query, replacing any query that has not finished.
+     *
+     * @param index The index to search; it must not be modified while shared with the worker
+     * @param normalizedQuery The whole query, already normalised like the index keys
+     * @param queryWords The normalised words of the query, used for ranking;
+     *                   if empty the whole query is ranked as one word
+     * @param allowedEntries Optional bitset of the entries that may match, such as a facet filter
+     */
+    void search(std::shared_ptr<const GearSearchIndex> index, const juce::String &normalizedQuery,
+                const juce::StringArray &queryWords = {},
+                std::shared_ptr<const juce::BigInteger> allowedEntries = nullptr);
+
+    /**
+     * @brief Abandons any queued or running query without delivering a result.
+     */
+    void cancel();
+
+    /**
+     * @brief Waits until no query is queued or running.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if the worker became idle within the timeout
+     */
+    bool waitUntilIdle(int timeoutMs);
+
+    /**
+     * @brief Delivers a completed result now instead of waiting for the message loop.
+     *
+     * Must be called on the message thread.
+     */
+    void deliverPendingResult();
+
+private:
+    /**
+     * @brief A query waiting to run.
+     */
+    struct Request
+    {
+        std::shared_ptr<const GearSearchIndex> index;           ///< The index to search
+        juce::String query;                                     ///< The normalised query
+        juce::StringArray words;                                ///< The normalised words of the query
+        std::shared_ptr<const juce::BigInteger> allowedEntries; ///< Entries that may match, or nullptr for all
+        juce::uint32 generation = 0;                            ///< Generation the query was submitted as
+    };
+
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    /**
+     * @brief Matches a request, refining the previous result when possible.
+     *
+     * Called on the worker thread.
+     *
+     * @param request The request to match
+     * @param result Receives the result
+     * @return false if the request was superseded before it finished
+     */
+    bool runSearch(const Request &request, Result &result);
+
+    const int debounceMs;                        ///< Quiet period before searching
+    const int maxResults;                        ///< Matches delivered per query
+    const GearSearchRanker ranker;               ///< Orders the matches
+    juce::CriticalSection requestLock;           ///< Guards the pending request and result
+    Request pendingRequest;                      ///< The latest queued query
+    bool hasPendingRequest = false;              ///< Whether pendingRequest still has to run
+    juce::uint32 lastRequestTime = 0;            ///< Millisecond counter when the latest query arrived
+    std::atomic<juce::uint32> latestGeneration{0}; ///< Generation of the latest query or cancel
+
+    Result completedResult;                      ///< Result waiting for the message thread
+    juce::uint32 completedGeneration = 0;        ///< Generation of completedResult
+    bool hasCompletedResult = false;             ///< Whether completedResult is waiting
+
+    std::shared_ptr<const GearSearchIndex> previousIndex; ///< Index of the last completed search (worker thread only)
+    juce::String previousQuery;                           ///< Query of the last completed search (worker thread only)
+    juce::Array<int> previousExactMatches;                ///< Unranked exact matches of the last completed search (worker thread only)
+
+    juce::WaitableEvent idleEvent{true}; ///< Signalled while nothing is queued or running
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearSearchWorker)
+};
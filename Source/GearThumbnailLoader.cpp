@@ -0,0 +1,161 @@
+/**
+ * @file GearThumbnailLoader.cpp
+ * @brief Implementation of the GearThumbnailLoader class.
+ *
+ * This file implements the prioritised thumbnail queue and its background
+ * thread.
+ */
+
+#include "GearThumbnailLoader.h"
+#include <algorithm>
+
+GearThumbnailLoader::GearThumbnailLoader()
+    : juce::Thread("AnalogIQ Thumbnail Loader")
+{
+    idleEvent.signal();
+    startThread(juce::Thread::Priority::low);
+}
+
+GearThumbnailLoader::~GearThumbnailLoader()
+{
+    cancelAll();
+    signalThreadShouldExit();
+    workAvailable.signal();
+    stopThread(-1);
+}
+
+void GearThumbnailLoader::request(int key, LoadFunction load)
+{
+    if (load == nullptr)
+        return;
+
+    {
+        const juce::ScopedLock sl(lock);
+
+        if (isInFlight(key))
+            return;
+
+        auto queued = std::find_if(queue.begin(), queue.end(), [key](const Request &r)
+                                   { return r.key == key; });
+        if (queued != queue.end())
+            queue.erase(queued);
+
+        queue.push_back({key, std::move(load)});
+
+        // The oldest requests belong to rows that have most likely scrolled away
+        if ((int)queue.size() > MAX_QUEUED_REQUESTS)
+            queue.erase(queue.begin(), queue.begin() + ((int)queue.size() - MAX_QUEUED_REQUESTS));
+
+        idleEvent.reset();
+    }
+
+    workAvailable.signal();
+}
+
+void GearThumbnailLoader::cancelAll()
+{
+    {
+        const juce::ScopedLock sl(lock);
+        queue.clear();
+        results.clear();
+        ++generation;
+
+        if (!isLoadingThumbnail)
+            idleEvent.signal();
+    }
+
+    cancelPendingUpdate();
+}
+
+bool GearThumbnailLoader::waitUntilIdle(int timeoutMs)
+{
+    return idleEvent.wait(timeoutMs);
+}
+
+void GearThumbnailLoader::deliverPendingResults()
+{
+    handleUpdateNowIfNeeded();
+}
+
+bool GearThumbnailLoader::isPending(int key) const
+{
+    const juce::ScopedLock sl(lock);
+    return isInFlight(key);
+}
+
+bool GearThumbnailLoader::isInFlight(int key) const
+{
+    // A load from before cancelAll() will be discarded, so it does not hold the key
+    if (isLoadingThumbnail && loadingKey == key && loadingGeneration == generation)
+        return true;
+
+    return std::any_of(results.begin(), results.end(), [key](const Result &r)
+                       { return r.key == key; });
+}
+
+void GearThumbnailLoader::run()
+{
+    while (!threadShouldExit())
+    {
+        Request next;
+        juce::uint32 requestGeneration = 0;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            if (queue.empty())
+            {
+                idleEvent.signal();
+            }
+            else
+            {
+                // Newest first: the latest requests are for the rows on screen
+                next = std::move(queue.back());
+                queue.pop_back();
+                loadingKey = next.key;
+                isLoadingThumbnail = true;
+                loadingGeneration = generation;
+                requestGeneration = generation;
+            }
+        }
+
+        if (next.load == nullptr)
+        {
+            workAvailable.wait(-1);
+            continue;
+        }
+
+        auto image = next.load();
+
+        {
+            const juce::ScopedLock sl(lock);
+            isLoadingThumbnail = false;
+
+            if (requestGeneration == generation)
+                results.push_back({next.key, image});
+            else
+                staleResultDropped = true;
+        }
+
+        triggerAsyncUpdate();
+    }
+}
+
+void GearThumbnailLoader::handleAsyncUpdate()
+{
+    std::vector<Result> finished;
+    bool reportDropped = false;
+
+    {
+        const juce::ScopedLock sl(lock);
+        finished.swap(results);
+        std::swap(reportDropped, staleResultDropped);
+    }
+
+    if (onLoaded)
+        for (const auto &result : finished)
+            onLoaded(result.key, result.image);
+
+    if (reportDropped && onStaleResultDropped)
+        onStaleResultDropped();
+}
@@ -0,0 +1,147 @@
+/**
+ * @file GearThumbnailLoader.h
+ * @brief Header file for the GearThumbnailLoader class.
+ *
+ * This file defines the GearThumbnailLoader class, which fetches and decodes
+ * library thumbnails on a background thread so painting the tree never waits
+ * for the network, the disk cache or an image decoder.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Loads thumbnails on a background thread, most recently requested first.
+ *
+ * Rows request their thumbnail when they are painted, so the latest requests
+ * are for the rows on screen. The queue is served newest first, requesting a
+ * queued thumbnail again moves it to the front, and once more than
+ * MAX_QUEUED_REQUESTS are waiting the oldest, whose rows have most likely
+ * scrolled away, are dropped; they are requested again if painted again.
+ *
+ * Finished thumbnails are handed to onLoaded on the message thread, with the
+ * key they were requested under. cancelAll() drops every request and any
+ * result not yet delivered, for when the keys change meaning; a load it
+ * overtakes is dropped when it finishes and reported to onStaleResultDropped.
+ */
+class GearThumbnailLoader : private juce::Thread,
+                            private juce::AsyncUpdater
+{
+public:
+    /**
+     * @brief Number of requests kept waiting before the oldest are dropped.
+     */
+    static constexpr int MAX_QUEUED_REQUESTS = 64;
+
+    /**
+     * @brief Loads one thumbnail; runs on the loader's thread.
+     */
+    using LoadFunction = std::function<juce::Image()>;
+
+    /**
+     * @brief Constructs a loader and starts its thread.
+     */
+    GearThumbnailLoader();
+
+    /**
+     * @brief Destructor. Drops every request and stops the thread.
+     */
+    ~GearThumbnailLoader() override;
+
+    /**
+     * @brief Called on the message thread with each loaded thumbnail and its key.
+     */
+    std::function<void(int, const juce::Image &)> onLoaded;
+
+    /**
+     * @brief Called on the message thread after a load overtaken by cancelAll() finishes and is dropped.
+     *
+     * Rows painted while it was loading may be waiting for a repaint to request their thumbnail.
+     */
+    std::function<void()> onStaleResultDropped;
+
+    /**
+     * @brief Queues a thumbnail, or moves it to the front if it is already queued.
+     *
+     * Does nothing if the thumbnail is loading or waiting to be delivered.
+     *
+     * @param key Identifies the thumbnail to onLoaded
+     * @param load The function that loads it
+     */
+    void request(int key, LoadFunction load);
+
+    /**
+     * @brief Checks whether a thumbnail is loading or waiting to be delivered.
+     *
+     * A load overtaken by cancelAll() does not count, so the key can be requested again at once.
+     *
+     * @param key The key the thumbnail was requested under
+     * @return true if requesting it again would do nothing
+     */
+    bool isPending(int key) const;
+
+    /**
+     * @brief Drops every queued request and any result not yet delivered.
+     *
+     * A thumbnail that is loading is finished but never delivered.
+     */
+    void cancelAll();
+
+    /**
+     * @brief Waits until nothing is queued or loading.
+     *
+     * @param timeoutMs Maximum time to wait, or -1 to wait forever
+     * @return true if the loader became idle within the timeout
+     */
+    bool waitUntilIdle(int timeoutMs);
+
+    /**
+     * @brief Delivers finished thumbnails now instead of waiting for the message loop.
+     *
+     * Must be called on the message thread.
+     */
+    void deliverPendingResults();
+
+private:
+    /**
+     * @brief A thumbnail waiting to load.
+     */
+    struct Request
+    {
+        int key = 0;       ///< Key the thumbnail was requested under
+        LoadFunction load; ///< Loads the thumbnail
+    };
+
+    /**
+     * @brief A loaded thumbnail waiting for the message thread.
+     */
+    struct Result
+    {
+        int key = 0;       ///< Key the thumbnail was requested under
+        juce::Image image; ///< The thumbnail, or an invalid image if it could not be loaded
+    };
+
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    /**
+     * @brief Checks whether a key is loading or waiting to be delivered. Called with the lock held.
+     */
+    bool isInFlight(int key) const;
+
+    juce::CriticalSection lock;         ///< Guards the queue, the loading key and the results
+    std::vector<Request> queue;         ///< Waiting requests, newest last
+    std::vector<Result> results;        ///< Loaded thumbnails waiting for the message thread
+    int loadingKey = 0;                 ///< Key of the thumbnail being loaded
+    bool isLoadingThumbnail = false;    ///< Whether a thumbnail is being loaded
+    juce::uint32 loadingGeneration = 0; ///< Generation the thumbnail being loaded was requested in
+    juce::uint32 generation = 0;        ///< Bumped by cancelAll() so loads already running are discarded
+    bool staleResultDropped = false;    ///< Whether a discarded load has not been reported yet
+    juce::WaitableEvent workAvailable;  ///< Signalled when a request is queued or the thread should stop
+    juce::WaitableEvent idleEvent{true}; ///< Signalled while nothing is queued or loading
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GearThumbnailLoader)
+};
@@ -2,6 +2,98 @@
 
 #include <JuceHeader.h>
 
+/**
+ * @brief Read-only view over the contents of a file.
+ *
+ * A view is either backed by a memory-mapped file (zero-copy, used by the
+ * real file system) or by an owned memory block (used by in-memory
+ * implementations). The data remains valid for the lifetime of the view.
+ */
+class FileView
+{
+public:
+    /**
+     * @brief Constructs an empty, invalid view.
+     */
+    FileView() = default;
+
+    /**
+     * @brief Constructs a view backed by a memory-mapped file.
+     *
+     * @param mappedFile The mapped file to take ownership of
+     */
+    explicit FileView(std::unique_ptr<juce::MemoryMappedFile> mappedFile)
+        : mapped(std::move(mappedFile)) {}
+
+    /**
+     * @brief Constructs a view backed by an in-memory block.
+     *
+     * @param data The data to take ownership of
+     */
+    explicit FileView(juce::MemoryBlock data)
+        : block(std::move(data)) {}
+
+    FileView(FileView &&) = default;
+    FileView &operator=(FileView &&) = default;
+
+    /**
+     * @brief Gets a pointer to the start of the file data.
+     *
+     * @return Pointer to the data, or nullptr if the view is invalid
+     */
+    const void *getData() const
+    {
+        if (mapped != nullptr)
+            return mapped->getData();
+
+        return block.getSize() > 0 ? block.getData() : nullptr;
+    }
+
+    /**
+     * @brief Gets the number of bytes in the view.
+     *
+     * @return The size of the data in bytes
+     */
+    size_t getSize() const
+    {
+        return mapped != nullptr ? mapped->getSize() : block.getSize();
+    }
+
+    /**
+     * @brief Checks whether the view holds any data.
+     *
+     * @return true if the view has data, false otherwise
+     */
+    bool isValid() const { return getData() != nullptr && getSize() > 0; }
+
+    /**
+     * @brief Interprets the view as UTF-8 text.
+     *
+     * @return The file contents as a string
+     */
+    juce::String toString() const
+    {
+        return isValid() ? juce::String::fromUTF8(static_cast<const char *>(getData()), (int)getSize()) : juce::String();
+    }
+
+private:
+    std::unique_ptr<juce::MemoryMappedFile> mapped; ///< Mapped file, when backed by the OS
+    juce::MemoryBlock block;                        ///< Owned data, when backed by memory
+
+    JUCE_DECLARE_NON_COPYABLE(FileView)
+};
+
+/**
+ * @brief Metadata for one entry returned by IFileSystem::listDirectory().
+ */
+struct DirectoryEntry
+{
+    juce::String name;             ///< Entry name without the directory path
+    juce::int64 size = 0;          ///< File size in bytes (0 for directories)
+    juce::Time modificationTime;   ///< Last modification time
+    bool isDirectory = false;      ///< Whether the entry is a directory
+};
+
 /**
  * @brief Interface for file system operations.
  *
@@ -40,6 +132,57 @@ public:
      */
     virtual bool writeFile(const juce::String &path, const juce::MemoryBlock &data) = 0;
 
+    /**
+     * @brief Queues text to be written to a file without blocking the caller.
+     *
+     * Repeated writes to the same path before the queue drains are coalesced so
+     * only the last one reaches disk. Reads through this interface observe queued
+     * content immediately. The default implementation writes synchronously.
+     *
+     * @param path The file path to write to
+     * @param content The content to write to the file
+     * @return true if the write was queued (or completed), false otherwise; a queued
+     *         write that fails later is reported by flushPendingWrites()
+     */
+    virtual bool writeFileAsync(const juce::String &path, const juce::String &content)
+    {
+        return writeFile(path, content);
+    }
+
+    /**
+     * @brief Queues binary data to be written to a file without blocking the caller.
+     *
+     * @param path The file path to write to
+     * @param data The binary data to write to the file
+     * @return true if the write was queued (or completed), false otherwise
+     */
+    virtual bool writeFileAsync(const juce::String &path, const juce::MemoryBlock &data)
+    {
+        return writeFile(path, data);
+    }
+
+    /**
+     * @brief Blocks until every queued write has reached disk.
+     *
+     * Call before shutdown, before operations that scan the disk directly,
+     * and in tests. writeFileAsync() only reports whether a write was queued,
+     * so this is where a write that later failed is reported. The default
+     * implementation has nothing to flush.
+     *
+     * @return true if every write queued since the previous flush reached disk, false otherwise
+     */
+    virtual bool flushPendingWrites() { return true; }
+
+    /**
+     * @brief Forgets anything cached about a path after it changed externally.
+     *
+     * Called when another process is known to have modified the path, for
+     * example by a DirectoryWatcher. The default implementation caches nothing.
+     *
+     * @param path The file or directory that changed
+     */
+    virtual void invalidateCachedMetadata(const juce::String &path) { juce::ignoreUnused(path); }
+
     /**
      * @brief Reads content from a file at the specified path.
      *
@@ -56,6 +199,14 @@ public:
      */
     virtual juce::MemoryBlock readBinaryFile(const juce::String &path) = 0;
 
+    /**
+     * @brief Maps a file for read-only access without copying its contents.
+     *
+     * @param path The file path to map
+     * @return A view over the file data, or an invalid view if mapping failed
+     */
+    virtual FileView mapFile(const juce::String &path) = 0;
+
     /**
      * @brief Checks if a file exists at the specified path.
      *
@@ -88,6 +239,14 @@ public:
      */
     virtual juce::StringArray getDirectories(const juce::String &directory) = 0;
 
+    /**
+     * @brief Lists the direct children of a directory with their metadata in a single pass.
+     *
+     * @param directory The directory path to list
+     * @return One entry per file and subdirectory, in no particular order
+     */
+    virtual juce::Array<DirectoryEntry> listDirectory(const juce::String &directory) = 0;
+
     /**
      * @brief Gets the size of a file in bytes.
      *
@@ -22,6 +22,48 @@ public:
     */
     virtual juce::MemoryBlock fetchBinaryBlocking(const juce::URL &url, bool &success) = 0;
 
+    /** Performs a blocking fetch that gives up once shouldAbort returns true.
+        For callers on background threads that may be abandoned mid-fetch. The
+        default implementation only checks before fetching.
+        @param url The JUCE URL to fetch.
+        @param success Output flag indicating whether the fetch succeeded; false if it was aborted.
+        @param shouldAbort Polled while fetching; returning true abandons the fetch.
+        @return The content returned by the URL as a String, or an empty String on failure.
+    */
+    virtual juce::String fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort)
+    {
+        if (shouldAbort != nullptr && shouldAbort())
+        {
+            success = false;
+            return {};
+        }
+
+        return fetchJsonBlocking(url, success);
+    }
+
+    /** Receives notice that a resource fetched earlier has newer content. */
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+
+        /** Called on the message thread once fetching the URL again would return newer content.
+            @param url The URL whose content changed.
+        */
+        virtual void resourceUpdated(const juce::URL &url) = 0;
+    };
+
+    /** Registers a listener for resources that change after they were served.
+        The default implementation never serves content that changes later.
+        @param listener The listener to add.
+    */
+    virtual void addListener(Listener *listener) { juce::ignoreUnused(listener); }
+
+    /** Unregisters a listener added with addListener().
+        @param listener The listener to remove.
+    */
+    virtual void removeListener(Listener *listener) { juce::ignoreUnused(listener); }
+
     /**
      * @brief Returns a reference to a dummy network fetcher (Null Object Pattern).
      *
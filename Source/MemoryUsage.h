@@ -0,0 +1,142 @@
+/**
+ * @file MemoryUsage.h
+ * @brief Header file for the MemoryUsage struct.
+ *
+ * This file defines MemoryUsage, the bytes held by decoded images, the
+ * library catalogue, preset data and pooled instances, as reported by the
+ * rack, the library, the cache manager, the preset manager and the processor.
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_graphics/juce_graphics.h>
+#include <unordered_set>
+
+/**
+ * @brief Bytes held in memory, by kind of data.
+ *
+ * Image sizes are the decoded pixels: width times height times the bytes per
+ * pixel of the format. Strings count their UTF-8 bytes plus the handle, and
+ * arrays their elements, so records are estimates that ignore allocator
+ * overhead and the sharing of copied strings.
+ */
+struct MemoryUsage
+{
+    /**
+     * @brief Counts each decoded image once, however many holders share its pixels.
+     *
+     * Instances of a unit share their definition's faceplate and sprites, so
+     * a total over several holders should pass them all the same counter.
+     */
+    class ImageCounter
+    {
+    public:
+        /**
+         * @brief Gets the bytes of an image the first time its pixels are seen.
+         *
+         * @param image The image
+         * @return The bytes of its pixels, or 0 if it is invalid or was already counted
+         */
+        juce::int64 count(const juce::Image &image)
+        {
+            if (!image.isValid() || !seen.insert(&*image.getPixelData()).second)
+                return 0;
+
+            return getImageBytes(image);
+        }
+
+    private:
+        std::unordered_set<const void *> seen; ///< Pixel data already counted
+    };
+
+    juce::int64 faceplates = 0;      ///< Decoded faceplate images
+    juce::int64 controlImages = 0;   ///< Decoded knob and fader images and switch and button sprite sheets
+    juce::int64 thumbnails = 0;      ///< Decoded library and instance thumbnails
+    juce::int64 catalogue = 0;       ///< Library catalogue records
+    juce::int64 presetData = 0;      ///< Preset listings and the control state presets save and restore
+    juce::int64 pooledInstances = 0; ///< Released rack instances kept for reuse
+
+    /**
+     * @brief Gets the bytes held across every kind of data.
+     *
+     * @return The total in bytes
+     */
+    juce::int64 getTotal() const { return faceplates + controlImages + thumbnails + catalogue + presetData + pooledInstances; }
+
+    /**
+     * @brief Adds another report to this one.
+     *
+     * @param other The report to add
+     * @return Reference to this report
+     */
+    MemoryUsage &operator+=(const MemoryUsage &other)
+    {
+        faceplates += other.faceplates;
+        controlImages += other.controlImages;
+        thumbnails += other.thumbnails;
+        catalogue += other.catalogue;
+        presetData += other.presetData;
+        pooledInstances += other.pooledInstances;
+        return *this;
+    }
+
+    /**
+     * @brief Describes the report for logs, with sizes in readable units.
+     *
+     * @return The total followed by each kind of data
+     */
+    juce::String toString() const
+    {
+        auto describe = [](juce::int64 bytes)
+        {
+            return juce::File::descriptionOfSizeInBytes(bytes);
+        };
+
+        return describe(getTotal()) + " (faceplates " + describe(faceplates) + ", control images " + describe(controlImages)
+               + ", thumbnails " + describe(thumbnails) + ", catalogue " + describe(catalogue) + ", preset data "
+               + describe(presetData) + ", pooled instances " + describe(pooledInstances) + ")";
+    }
+
+    /**
+     * @brief Gets the bytes of an image's decoded pixels.
+     *
+     * @param image The image
+     * @return The bytes, or 0 if the image is invalid
+     */
+    static juce::int64 getImageBytes(const juce::Image &image)
+    {
+        if (!image.isValid())
+            return 0;
+
+        juce::int64 bytesPerPixel = 0;
+        switch (image.getFormat())
+        {
+        case juce::Image::ARGB:
+            bytesPerPixel = 4;
+            break;
+        case juce::Image::RGB:
+            bytesPerPixel = 3;
+            break;
+        case juce::Image::SingleChannel:
+            bytesPerPixel = 1;
+            break;
+        default:
+            break;
+        }
+
+        return (juce::int64)image.getWidth() * image.getHeight() * bytesPerPixel;
+    }
+
+    /**
+     * @brief Gets the bytes a string holds.
+     *
+     * @param text The string
+     * @return The handle, plus the UTF-8 bytes and terminator unless it is empty
+     */
+    static juce::int64 getStringBytes(const juce::String &text)
+    {
+        const auto handle = (juce::int64)sizeof(juce::String);
+        return text.isEmpty() ? handle : handle + (juce::int64)text.getNumBytesAsUTF8() + 1;
+    }
+};
@@ -49,6 +49,45 @@ juce::MemoryBlock NetworkFetcher::fetchBinaryBlocking(const juce::URL &url, bool
     return data;
 }
 
+juce::String NetworkFetcher::fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort)
+{
+    success = false;
+
+    auto aborted = [&shouldAbort]
+    {
+        return shouldAbort != nullptr && shouldAbort();
+    };
+
+    if (aborted())
+        return {};
+
+    std::unique_ptr<juce::InputStream> stream = url.createInputStream(
+        juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+            .withConnectionTimeoutMs(10000)
+            .withNumRedirectsToFollow(5));
+
+    if (stream == nullptr)
+        return {};
+
+    // Read in chunks so an abandoned fetch stops between them
+    juce::MemoryOutputStream content;
+    char buffer[16384];
+    for (;;)
+    {
+        if (aborted())
+            return {};
+
+        auto numRead = stream->read(buffer, (int)sizeof(buffer));
+        if (numRead <= 0)
+            break;
+
+        content.write(buffer, (size_t)numRead);
+    }
+
+    success = true;
+    return content.toUTF8();
+}
+
 // Null Object Pattern: DummyNetworkFetcher implementation
 class DummyNetworkFetcher : public INetworkFetcher
 {
@@ -18,4 +18,5 @@ class NetworkFetcher : public INetworkFetcher
 public:
     juce::String fetchJsonBlocking(const juce::URL &url, bool &success) override;
     juce::MemoryBlock fetchBinaryBlocking(const juce::URL &url, bool &success) override;
+    juce::String fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort) override;
 };
\ No newline at end of file
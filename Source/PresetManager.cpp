@@ -28,6 +28,49 @@ PresetManager::PresetManager(IFileSystem &fileSystem, CacheManager &cacheManager
 {
 }
 
+/**
+ * @brief Destructor. Detaches from the directory watcher, if any.
+ */
+PresetManager::~PresetManager()
+{
+    if (directoryWatcher != nullptr)
+        directoryWatcher->removeListener(this);
+}
+
+/**
+ * @brief Watches the presets directory so the preset list is maintained incrementally.
+ *
+ * @param watcher The watcher to register with
+ */
+void PresetManager::attachWatcher(DirectoryWatcher &watcher)
+{
+    if (directoryWatcher != nullptr)
+        directoryWatcher->removeListener(this);
+
+    initializePresetsDirectory();
+
+    directoryWatcher = &watcher;
+    presetListingsValid = false;
+    watcher.addWatch(getPresetsDirectory(), this);
+}
+
+/**
+ * @brief Records changed preset files; called on the watcher thread.
+ *
+ * @param directory The presets directory
+ * @param changedNames The changed filenames, or empty for a full rescan
+ */
+void PresetManager::directoryChanged(const juce::String &directory, const juce::StringArray &changedNames)
+{
+    juce::ignoreUnused(directory);
+
+    const juce::ScopedLock lock(pendingChangesLock);
+    if (changedNames.isEmpty())
+        pendingRescan = true;
+    else
+        pendingChangedFiles.mergeArray(changedNames);
+}
+
 /**
  * @brief Gets the presets directory.
  *
@@ -175,12 +218,12 @@ juce::String PresetManager::serializeRackToJSON(Rack *rack) const
                     const auto &control = item->controls[j];
                     juce::DynamicObject::Ptr controlObj = new juce::DynamicObject();
                     controlObj->setProperty("index", j);
-                    controlObj->setProperty("value", control.value);
+                    controlObj->setProperty("value", item->getControlValue(j));
                     controlObj->setProperty("initialValue", control.initialValue);
 
                     if (control.type == GearControl::Type::Switch || control.type == GearControl::Type::Button)
                     {
-                        controlObj->setProperty("currentIndex", control.currentIndex);
+                        controlObj->setProperty("currentIndex", item->getControlCurrentIndex(j));
                     }
 
                     controlsArray.add(juce::var(controlObj));
@@ -245,24 +288,11 @@ bool PresetManager::deserializeJSONToRack(const juce::String &jsonData, Rack *ra
 
                     if (slotIndex >= 0 && slotIndex < rack->getNumSlots() && !unitId.isEmpty())
                     {
-                        // Find the gear item in the library
-                        const auto &items = gearLibrary->getItems();
-                        const GearItem *sourceItem = nullptr;
-
-                        for (int i = 0; i < items.size(); ++i)
-                        {
-                            const auto &item = items.getReference(i);
-                            if (item.unitId == unitId)
-                            {
-                                sourceItem = &item;
-                                break;
-                            }
-                        }
+                        // Create a new instance of the gear item from the library
+                        GearItem *newItem = rack->adoptGearItem(gearLibrary->createGearItemByUnitId(unitId, INetworkFetcher::getDummy(), fileSystem, cacheManager));
 
-                        if (sourceItem != nullptr)
+                        if (newItem != nullptr)
                         {
-                            // Create a new instance of the gear item
-                            GearItem *newItem = new GearItem(*sourceItem, INetworkFetcher::getDummy(), fileSystem, cacheManager);
 
                             // Check if this was an instance and restore instance properties
                             auto instanceIdVar = slotObj->getProperty("instanceId");
@@ -316,7 +346,7 @@ bool PresetManager::deserializeJSONToRack(const juce::String &jsonData, Rack *ra
                                 // Trigger the same loading sequence as normal gear item addition
                                 // This will fetch schema, faceplate, and control images
                                 // After schema parsing, apply the saved control values
-                                rack->fetchSchemaForGearItem(newItem, [newItem, savedControls]()
+                                rack->fetchSchemaForGearItem(newItem, [newItem, savedControls = std::move(savedControls)]()
                                                              {
                                     // Apply saved control values after schema parsing
                                     // Note: initialValue is preserved from schema, not restored from saved state
@@ -324,13 +354,13 @@ bool PresetManager::deserializeJSONToRack(const juce::String &jsonData, Rack *ra
                                     {
                                         if (saved.index >= 0 && saved.index < newItem->controls.size())
                                         {
-                                            auto &control = newItem->controls.getReference(saved.index);
-                                            control.value = saved.value;
+                                            const auto &control = newItem->controls.getReference(saved.index);
+                                            newItem->setControlValue(saved.index, saved.value);
                                             // Don't restore initialValue - keep the schema default
 
                                             if (control.type == GearControl::Type::Switch || control.type == GearControl::Type::Button)
                                             {
-                                                control.currentIndex = saved.currentIndex;
+                                                newItem->setControlCurrentIndex(saved.index, saved.currentIndex);
                                             }
                                         }
                                     } });
@@ -402,6 +432,7 @@ bool PresetManager::savePreset(const juce::String &name, Rack *rack)
 
     // Save to file
     auto presetFile = getPresetFile(name);
+    invalidatePresetListing(name);
     if (!fileSystem.writeFile(presetFile, jsonData))
     {
         lastErrorMessage = "Failed to write preset file to disk.";
@@ -501,6 +532,7 @@ bool PresetManager::deletePreset(const juce::String &name)
         return false;
     }
 
+    invalidatePresetListing(name);
     if (!fileSystem.deleteFile(presetFile))
     {
         lastErrorMessage = "Failed to delete preset file.";
@@ -517,28 +549,147 @@ bool PresetManager::deletePreset(const juce::String &name)
  */
 juce::StringArray PresetManager::getPresetNames() const
 {
+    updatePresetListings();
+
     juce::StringArray names;
+    names.ensureStorageAllocated((int)presetListings.size());
+    for (const auto &listing : presetListings)
+        names.add(listing.first);
 
-    // Use OS-agnostic approach through the injected fileSystem
-    juce::String cacheRoot = fileSystem.getCacheRootDirectory();
-    juce::String presetsDir = fileSystem.joinPath(cacheRoot, "presets");
+    // Sort alphabetically
+    names.sort(true);
+
+    return names;
+}
+
+/**
+ * @brief Gets the memory held by the preset listings kept between scans.
+ *
+ * Presets themselves are not kept in memory once loaded; the control
+ * values they restore are reported by the rack's instances.
+ *
+ * @return The preset data
+ */
+MemoryUsage PresetManager::getMemoryUsage() const
+{
+    MemoryUsage usage;
+
+    for (const auto &listing : presetListings)
+        usage.presetData += MemoryUsage::getStringBytes(listing.first) + (juce::int64)sizeof(PresetListing);
+
+    const juce::ScopedLock lock(pendingChangesLock);
+    for (const auto &name : pendingChangedFiles)
+        usage.presetData += MemoryUsage::getStringBytes(name);
+
+    return usage;
+}
+
+/**
+ * @brief Scans the presets directory once and refreshes the preset listings.
+ */
+void PresetManager::refreshPresetListings() const
+{
+    std::unordered_map<juce::String, PresetListing> fresh;
 
-    if (fileSystem.directoryExists(presetsDir))
+    // Size, time and type all come from the one listing pass
+    for (const auto &entry : fileSystem.listDirectory(getPresetsDirectory()))
     {
-        auto files = fileSystem.getFiles(presetsDir);
-        for (auto &filename : files)
+        if (entry.isDirectory || !entry.name.endsWith(".json"))
+            continue;
+
+        juce::String name = filenameToName(entry.name);
+        PresetListing listing;
+        listing.size = entry.size;
+        listing.modificationTime = entry.modificationTime;
+
+        // Keep the parsed timestamp while the file is unchanged
+        auto previous = presetListings.find(name);
+        if (previous != presetListings.end() &&
+            previous->second.size == listing.size &&
+            previous->second.modificationTime == listing.modificationTime)
         {
-            if (filename.endsWith(".json"))
-            {
-                names.add(filenameToName(filename));
-            }
+            listing.timestamp = previous->second.timestamp;
         }
 
-        // Sort alphabetically
-        names.sort(true);
+        fresh[name] = listing;
     }
 
-    return names;
+    presetListings = std::move(fresh);
+    presetListingsValid = true;
+}
+
+/**
+ * @brief Forgets the listing for a preset after it is written or deleted.
+ *
+ * @param name The preset name
+ */
+void PresetManager::invalidatePresetListing(const juce::String &name) const
+{
+    presetListings.erase(name);
+
+    if (directoryWatcher == nullptr)
+    {
+        presetListingsValid = false;
+        return;
+    }
+
+    // Re-check just this file rather than waiting for the watcher to report our own write
+    const juce::ScopedLock lock(pendingChangesLock);
+    pendingChangedFiles.addIfNotAlreadyThere(nameToFilename(name));
+}
+
+void PresetManager::updatePresetListings() const
+{
+    if (directoryWatcher == nullptr)
+    {
+        refreshPresetListings();
+        return;
+    }
+
+    juce::StringArray changedFiles;
+    bool rescan = false;
+    {
+        const juce::ScopedLock lock(pendingChangesLock);
+        changedFiles.swapWith(pendingChangedFiles);
+        rescan = pendingRescan;
+        pendingRescan = false;
+    }
+
+    if (rescan || !presetListingsValid)
+    {
+        refreshPresetListings();
+        return;
+    }
+
+    const juce::String presetsDirectory = getPresetsDirectory();
+    for (const auto &filename : changedFiles)
+    {
+        if (!filename.endsWith(".json"))
+            continue;
+
+        juce::String name = filenameToName(filename);
+        juce::String presetFile = fileSystem.joinPath(presetsDirectory, filename);
+
+        if (!fileSystem.fileExists(presetFile))
+        {
+            presetListings.erase(name);
+            continue;
+        }
+
+        PresetListing listing;
+        listing.size = fileSystem.getFileSize(presetFile);
+        listing.modificationTime = fileSystem.getFileTime(presetFile);
+
+        auto previous = presetListings.find(name);
+        if (previous != presetListings.end() &&
+            previous->second.size == listing.size &&
+            previous->second.modificationTime == listing.modificationTime)
+        {
+            listing.timestamp = previous->second.timestamp;
+        }
+
+        presetListings[name] = listing;
+    }
 }
 
 /**
@@ -576,14 +727,28 @@ juce::int64 PresetManager::getPresetTimestamp(const juce::String &name) const
     if (name.isEmpty())
         return 0;
 
-    auto presetFile = getPresetFile(name);
-    if (!fileSystem.fileExists(presetFile))
+    if (directoryWatcher != nullptr)
+        updatePresetListings();
+
+    auto listing = presetListings.find(name);
+    if (!presetListingsValid || listing == presetListings.end())
+    {
+        refreshPresetListings();
+        listing = presetListings.find(name);
+    }
+
+    if (listing == presetListings.end())
         return 0;
 
-    // Try to get timestamp from file modification time
-    juce::int64 fileTime = fileSystem.getFileTime(presetFile).toMilliseconds();
+    if (listing->second.timestamp >= 0)
+        return listing->second.timestamp;
 
-    // If that fails, try to get it from the JSON
+    // Fall back to the file modification time recorded by the listing
+    juce::int64 fileTime = listing->second.modificationTime.toMilliseconds();
+    listing->second.timestamp = fileTime;
+
+    // Prefer the timestamp stored in the JSON
+    auto presetFile = getPresetFile(name);
     juce::String jsonData = fileSystem.readFile(presetFile);
     if (!jsonData.isEmpty())
     {
@@ -596,7 +761,8 @@ juce::int64 PresetManager::getPresetTimestamp(const juce::String &name) const
                 auto timestampVar = jsonObj->getProperty("timestamp");
                 if (timestampVar.isInt64())
                 {
-                    return timestampVar;
+                    listing->second.timestamp = timestampVar;
+                    return listing->second.timestamp;
                 }
             }
         }
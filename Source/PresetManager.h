@@ -13,6 +13,8 @@
 #include "GearLibrary.h"
 #include "IFileSystem.h"
 #include "FileSystem.h"
+#include "DirectoryWatcher.h"
+#include <unordered_map>
 
 // Forward declarations
 class Rack;
@@ -25,8 +27,11 @@ class GearLibrary;
  * as presets. Each preset contains the ordered list of gear units, their instance
  * states, and control values. Presets are stored as JSON files in the user's
  * application data directory.
+ *
+ * When a DirectoryWatcher is attached, the preset list is kept up to date from
+ * change notifications instead of re-listing the presets directory on every call.
  */
-class PresetManager
+class PresetManager : public DirectoryWatcher::Listener
 {
 public:
     /**
@@ -38,9 +43,9 @@ public:
     PresetManager(IFileSystem &fileSystem, CacheManager &cacheManager);
 
     /**
-     * @brief Destructor.
+     * @brief Destructor. Detaches from the directory watcher, if any.
      */
-    ~PresetManager() = default;
+    ~PresetManager() override;
 
     // Prevent copying and assignment
     PresetManager(const PresetManager &) = delete;
@@ -81,6 +86,13 @@ public:
      */
     juce::StringArray getPresetNames() const;
 
+    /**
+     * @brief Gets the memory held by the preset listings kept between scans.
+     *
+     * @return The preset data
+     */
+    MemoryUsage getMemoryUsage() const;
+
     // Utility methods
     /**
      * @brief Gets the presets directory.
@@ -179,11 +191,66 @@ public:
      */
     juce::var getPresetInfo(const juce::String &name, juce::String &errorMessage) const;
 
+    /**
+     * @brief Watches the presets directory so the preset list is maintained incrementally.
+     *
+     * @param watcher The watcher to register with, which must outlive this object
+     */
+    void attachWatcher(DirectoryWatcher &watcher);
+
+    /**
+     * @brief Records changed preset files reported by the directory watcher.
+     *
+     * @param directory The presets directory
+     * @param changedNames The changed filenames, or empty if the whole directory must be rescanned
+     */
+    void directoryChanged(const juce::String &directory, const juce::StringArray &changedNames) override;
+
 private:
+    /**
+     * @brief What the last directory listing recorded about a preset file.
+     */
+    struct PresetListing
+    {
+        juce::int64 size = 0;         ///< File size when listed
+        juce::Time modificationTime;  ///< Modification time when listed
+        juce::int64 timestamp = -1;   ///< Timestamp parsed from the JSON, or -1 if not read yet
+    };
+
     mutable juce::String lastErrorMessage; ///< Stores the last error message
     IFileSystem &fileSystem;               ///< Reference to the file system implementation
     CacheManager &cacheManager;            ///< Reference to the cache manager
 
+    mutable std::unordered_map<juce::String, PresetListing> presetListings; ///< Preset name -> listing from the last scan
+    mutable bool presetListingsValid = false;                              ///< Whether presetListings reflects a scan
+
+    DirectoryWatcher *directoryWatcher = nullptr;  ///< Watcher maintaining the listings, or nullptr to rescan on demand
+    mutable juce::CriticalSection pendingChangesLock; ///< Guards the pending change fields below
+    mutable juce::StringArray pendingChangedFiles; ///< Filenames reported changed since the last update
+    mutable bool pendingRescan = false;            ///< Whether the watcher asked for a full rescan
+
+    /**
+     * @brief Scans the presets directory once and refreshes presetListings.
+     *
+     * Parsed timestamps are kept for files whose size and modification time are unchanged.
+     */
+    void refreshPresetListings() const;
+
+    /**
+     * @brief Forgets the listing for a preset after it is written or deleted.
+     *
+     * @param name The preset name
+     */
+    void invalidatePresetListing(const juce::String &name) const;
+
+    /**
+     * @brief Brings presetListings up to date.
+     *
+     * Without a watcher this rescans the directory. With one, only the files
+     * reported as changed since the last call are checked.
+     */
+    void updatePresetListings() const;
+
     /**
      * @brief Converts a preset name to a safe filename.
      *
@@ -59,17 +59,14 @@ Rack::~Rack()
             GearItem *item = slot->getGearItem();
             if (item != nullptr)
             {
-                // Clear the main images
+                // Clear the main images and release the unit's shared definition
                 item->image = juce::Image();
-                item->faceplateImage = juce::Image();
+                item->definition = nullptr;
 
                 // Clear images in controls
                 for (auto &control : item->controls)
                 {
                     control.loadedImage = juce::Image();
-                    control.switchSpriteSheet = juce::Image();
-                    control.faderImage = juce::Image();
-                    control.buttonSpriteSheet = juce::Image();
                 }
             }
         }
@@ -103,12 +100,12 @@ int Rack::getSlotHeight(int slotIndex) const
 
     // If the slot has a gear item with a faceplate image, use the image's height plus padding
     GearItem *item = slot->getGearItem();
-    if (item != nullptr && item->faceplateImage.isValid())
+    if (item != nullptr && item->getFaceplateImage().isValid())
     {
         // Calculate a reasonable height based on the faceplate image
         // Use aspect ratio of the image, but constrained to reasonable bounds
-        int imageHeight = item->faceplateImage.getHeight();
-        int imageWidth = item->faceplateImage.getWidth();
+        int imageHeight = item->getFaceplateImage().getHeight();
+        int imageWidth = item->getFaceplateImage().getWidth();
 
         if (imageHeight > 0 && imageWidth > 0)
         {
@@ -275,16 +272,14 @@ void Rack::itemDropped(const juce::DragAndDropTarget::SourceDetails &details)
     if (details.description.isInt() && gearLibrary != nullptr)
     {
         int gearIndex = static_cast<int>(details.description);
-        GearItem *item = gearLibrary->getGearItem(gearIndex);
 
-        if (item != nullptr)
+        // Create a new instance of the library entry
+        if (auto *newItem = adoptGearItem(gearLibrary->createGearItem(gearIndex, networkFetcher, fileSystem, cacheManager)))
         {
-            // Create a new instance of the item
-            GearItem *newItem = new GearItem(*item, networkFetcher, fileSystem, cacheManager); // Use copy constructor
             targetSlot->setGearItem(newItem);
 
             // Track this item as recently used
-            cacheManager.addToRecentlyUsed(item->unitId);
+            cacheManager.addToRecentlyUsed(newItem->unitId);
 
             // Refresh the gear library tree view to update recently used items
             if (gearLibrary != nullptr)
@@ -309,16 +304,14 @@ void Rack::itemDropped(const juce::DragAndDropTarget::SourceDetails &details)
             if (parts.size() >= 3)
             {
                 int gearIndex = parts[1].getIntValue();
-                GearItem *item = gearLibrary->getGearItem(gearIndex);
 
-                if (item != nullptr)
+                // Create a new instance of the library entry
+                if (auto *newItem = adoptGearItem(gearLibrary->createGearItem(gearIndex, networkFetcher, fileSystem, cacheManager)))
                 {
-                    // Create a new instance of the item
-                    GearItem *newItem = new GearItem(*item, networkFetcher, fileSystem, cacheManager); // Use copy constructor
                     targetSlot->setGearItem(newItem);
 
                     // Track this item as recently used
-                    cacheManager.addToRecentlyUsed(item->unitId);
+                    cacheManager.addToRecentlyUsed(newItem->unitId);
 
                     // Refresh the gear library tree view to update recently used items
                     if (gearLibrary != nullptr)
@@ -445,7 +438,12 @@ RackSlot *Rack::findNearestSlot(const juce::Point<int> &position)
 /**
  * @brief Fetches the schema for a gear item.
  *
+ * The schema is loaded once per unit into the unit's shared definition.
+ * Instances placed while it loads wait for it; instances placed once it has
+ * loaded get their controls straight away.
+ *
  * @param item The gear item to fetch the schema for
+ * @param onComplete Optional callback to execute when schema loading is complete
  */
 void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComplete)
 {
@@ -456,6 +454,25 @@ void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComple
         return;
     }
 
+    GearDefinition::Ptr definition = getDefinition(*item);
+
+    // Another instance of the unit has already loaded the schema
+    if (definition->state == GearDefinition::State::Loaded)
+    {
+        item->useDefinitionControls();
+        if (onComplete)
+            onComplete();
+        return;
+    }
+
+    definition->waiters.add(GearDefinition::Waiter{item, std::move(onComplete)});
+
+    // Another instance of the unit is already loading it
+    if (definition->state == GearDefinition::State::Loading)
+        return;
+
+    definition->state = GearDefinition::State::Loading;
+
     // Extract unit ID from schema path for caching
     juce::String unitId = item->unitId;
 
@@ -465,7 +482,7 @@ void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComple
         juce::String cachedSchema = cacheManager.loadUnitFromCache(unitId);
         if (cachedSchema.isNotEmpty())
         {
-            parseSchema(cachedSchema, item, onComplete);
+            finishLoadingDefinition(*definition, parseSchema(cachedSchema, *definition));
             return;
         }
     }
@@ -484,7 +501,7 @@ void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComple
      * @brief Thread for downloading and processing schema data.
      *
      * This struct handles the asynchronous download and processing of schema data
-     * for gear items, ensuring UI updates happen on the message thread.
+     * into a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct SchemaDownloader : public juce::Thread
     {
@@ -492,14 +509,13 @@ void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComple
          * @brief Constructs a new SchemaDownloader.
          *
          * @param urlToUse The URL to download the schema from
-         * @param itemToUpdate The gear item to update with the schema
+         * @param definitionToUpdate The definition to fill with the schema
          * @param rackToNotify The rack to notify when the schema is loaded
          * @param unitIdToCache The unit ID to use for caching
-         * @param onComplete Optional callback to execute when parsing is complete
          */
-        SchemaDownloader(juce::URL urlToUse, GearItem *itemToUpdate, Rack *rackToNotify, const juce::String &unitIdToCache, CacheManager &cacheManagerRef, std::function<void()> onComplete = nullptr)
+        SchemaDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, Rack *rackToNotify, const juce::String &unitIdToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Schema Downloader"),
-              url(urlToUse), item(itemToUpdate), rack(rackToNotify), unitId(unitIdToCache), cacheManager(cacheManagerRef), completionCallback(onComplete)
+              url(urlToUse), definition(definitionToUpdate), rack(rackToNotify), unitId(unitIdToCache), cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -522,62 +538,59 @@ void Rack::fetchSchemaForGearItem(GearItem *item, std::function<void()> onComple
         void run() override
         {
             // Download the schema data
-            schemaData = url.readEntireTextStream(false);
+            bool fetched = false;
+            schemaData = networkFetcher.fetchJsonBlocking(url, fetched);
 
             if (threadShouldExit())
                 return;
 
-            success = schemaData.isNotEmpty();
+            // An error page is not a schema, whatever its length
+            success = fetched && schemaData.isNotEmpty();
 
             // Need to get back on the message thread to update the UI
             juce::MessageManager::callAsync([this]()
                                             {
+                bool parsed = false;
                 if (success)
                 {
-                                // Cache the downloaded schema
-            cacheManager.saveUnitToCache(unitId, schemaData);
-                    
-                    rack->parseSchema(schemaData, item, completionCallback);
-                }
-                else
-                {
-                    // Call completion callback even on failure
-                    if (completionCallback) completionCallback();
+                    // Cache the downloaded schema
+                    cacheManager.saveUnitToCache(unitId, schemaData);
+
+                    parsed = rack->parseSchema(schemaData, *definition);
                 }
+
+                // Complete the waiting instances even on failure
+                rack->finishLoadingDefinition(*definition, parsed);
                 delete this; });
         }
 
-        juce::URL url;                            ///< The URL to download from
-        GearItem *item;                           ///< The gear item to update
-        Rack *rack;                               ///< The rack to notify
-        juce::String schemaData;                  ///< The downloaded schema data
-        bool success = false;                     ///< Whether the download was successful
-        juce::String unitId;                      ///< The unit ID to use for caching
-        CacheManager &cacheManager;               ///< Reference to cache manager
-        std::function<void()> completionCallback; ///< Optional completion callback
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition to fill
+        Rack *rack;                      ///< The rack to notify
+        juce::String schemaData;         ///< The downloaded schema data
+        bool success = false;            ///< Whether the download was successful
+        juce::String unitId;             ///< The unit ID to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new SchemaDownloader(schemaUrl, item, this, unitId, cacheManager, onComplete);
+    new SchemaDownloader(schemaUrl, definition, this, unitId, cacheManager, networkFetcher);
 }
 
 /**
- * @brief Parses the schema data for a gear item.
+ * @brief Parses schema data into a unit's definition.
  *
  * @param schemaData The JSON schema data to parse
- * @param item The gear item to update with the parsed schema
- * @param onComplete Optional callback to execute when parsing is complete
+ * @param definition The definition to fill with the faceplate and controls
+ * @return true if the schema could be parsed
  */
-void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::function<void()> onComplete)
+bool Rack::parseSchema(const juce::String &schemaData, GearDefinition &definition)
 {
     // Parse the JSON schema
     auto schemaJson = juce::JSON::parse(schemaData);
     if (!schemaJson.isObject())
-    {
-        if (onComplete)
-            onComplete();
-        return;
-    }
+        return false;
 
     // Look for faceplate image properties
     juce::StringArray faceplateProperties = {"faceplateImage", "thumbnailImage"};
@@ -593,11 +606,11 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
             {
                 foundFaceplate = true;
 
-                // Store the path in the gear item
-                item->faceplateImagePath = faceplateImagePath;
+                // Store the path in the definition
+                definition.faceplateImagePath = faceplateImagePath;
 
                 // Fetch the faceplate image
-                fetchFaceplateImage(item);
+                loadFaceplateImage(definition);
                 break;
             }
         }
@@ -610,7 +623,7 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
     // Update controls if available
     if (schemaJson.hasProperty("controls") && schemaJson["controls"].isArray())
     {
-        item->controls.clear();
+        definition.controls.clear();
 
         auto controlsArray = schemaJson["controls"].getArray();
         for (auto &controlVar : *controlsArray)
@@ -640,7 +653,7 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
 
             // Check if we already have a control with this ID
             bool controlExists = false;
-            for (const auto &existingControl : item->controls)
+            for (const auto &existingControl : definition.controls)
             {
                 if (existingControl.id == controlId)
                 {
@@ -665,7 +678,7 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
             // Create control
             GearControl control(controlType, controlName, position);
             control.id = controlId; // Set the control ID
-            control.value = controlVar.getProperty("value", 0.0f);
+            control.initialValue = controlVar.getProperty("value", 0.0f);
 
             // Set type-specific properties
             switch (control.type)
@@ -673,9 +686,7 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
             case GearControl::Type::Switch:
             {
                 // Get switch-specific properties
-                control.orientation = controlVar.getProperty("orientation", "vertical").toString();
-                control.currentIndex = controlVar.getProperty("currentIndex", 0);        // Primary state: which option is selected
-                control.value = (float)controlVar.getProperty("currentIndex", 0);        // Derived: float representation of currentIndex
+                control.orientation = GearControl::parseOrientation(controlVar.getProperty("orientation", "vertical").toString());
                 control.initialValue = (float)controlVar.getProperty("currentIndex", 0); // Schema default: which option should be selected by default
                 control.image = controlVar.getProperty("image", "").toString();
 
@@ -701,19 +712,19 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
                                 frame.height = frameObj.getProperty("height", 0);
                             }
 
-                            control.switchFrames.add(frame);
-                            control.options.add(frame.value);
+                            control.selector().frames.add(frame);
+                            control.selector().options.add(frame.value);
                         }
                     }
                 }
 
-                // Add control to item before fetching sprite sheet
-                item->controls.add(control);
+                // Add control to the definition before fetching sprite sheet
+                definition.controls.add(control);
 
                 // Fetch the switch sprite sheet if one is specified
                 if (control.image.isNotEmpty())
                 {
-                    fetchSwitchSpriteSheet(item, item->controls.size() - 1);
+                    loadSwitchSpriteSheet(definition, definition.controls.size() - 1);
                 }
                 else
                 {
@@ -724,19 +735,18 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
             case GearControl::Type::Fader:
             {
                 // Get fader-specific properties
-                control.orientation = controlVar.getProperty("orientation", "vertical").toString();
-                control.length = controlVar.getProperty("length", 100);
-                control.value = controlVar.getProperty("value", 0.0f);
+                control.orientation = GearControl::parseOrientation(controlVar.getProperty("orientation", "vertical").toString());
+                control.fader().length = controlVar.getProperty("length", 100);
                 control.initialValue = controlVar.getProperty("value", 0.0f); // Store schema default value
                 control.image = controlVar.getProperty("image", "").toString();
 
-                // Add control to item before fetching image
-                item->controls.add(control);
+                // Add control to the definition before fetching image
+                definition.controls.add(control);
 
                 // Fetch the fader image if one is specified
                 if (control.image.isNotEmpty())
                 {
-                    fetchFaderImage(item, item->controls.size() - 1);
+                    loadFaderImage(definition, definition.controls.size() - 1);
                 }
                 else
                 {
@@ -751,9 +761,8 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
                 float endAngle = controlVar.getProperty("endAngle", 360.0f);
                 float value = controlVar.getProperty("value", 0.0f);
 
-                control.startAngle = startAngle;
-                control.endAngle = endAngle;
-                control.value = value;
+                control.knob().startAngle = startAngle;
+                control.knob().endAngle = endAngle;
                 control.initialValue = value; // Store the initial value from schema
                 control.image = controlVar.getProperty("image", "").toString();
 
@@ -762,18 +771,18 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
                 {
                     juce::Array<juce::var> *stepsArray = controlVar["steps"].getArray();
                     for (const auto &step : *stepsArray)
-                        control.steps.add(step);
-                    control.currentStepIndex = controlVar.getProperty("currentStepIndex", 0);
+                        control.knob().steps.add(step);
+                    control.knob().currentStepIndex = controlVar.getProperty("currentStepIndex", 0);
                 }
 
-                // Add control to item before fetching image
-                item->controls.add(control);
+                // Add control to the definition before fetching image
+                definition.controls.add(control);
 
                 // Fetch the knob image if one is specified
                 if (control.image.isNotEmpty())
                 {
                     // Pass the index of the control we just added
-                    fetchKnobImage(item, item->controls.size() - 1);
+                    loadKnobImage(definition, definition.controls.size() - 1);
                 }
                 else
                 {
@@ -785,7 +794,6 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
             {
                 // Get button-specific properties
                 control.momentary = controlVar.getProperty("momentary", false);
-                control.value = controlVar.getProperty("value", 0.0f);        // Primary state: button on/off value
                 control.initialValue = controlVar.getProperty("value", 0.0f); // Schema default: button default state
                 control.image = controlVar.getProperty("image", "").toString();
 
@@ -811,29 +819,19 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
                                 frame.height = frameObj.getProperty("height", 0);
                             }
 
-                            control.buttonFrames.add(frame);
-                            control.options.add(frame.value);
+                            control.selector().frames.add(frame);
+                            control.selector().options.add(frame.value);
                         }
                     }
                 }
 
-                // Set currentIndex based on value (derived from primary state)
-                if (control.momentary)
-                {
-                    control.currentIndex = control.value > 0.5f ? 1 : 0;
-                }
-                else
-                {
-                    control.currentIndex = (int)control.value;
-                }
-
-                // Add control to item before fetching sprite sheet
-                item->controls.add(control);
+                // Add control to the definition before fetching sprite sheet
+                definition.controls.add(control);
 
                 // Fetch the button sprite sheet if one is specified
                 if (control.image.isNotEmpty())
                 {
-                    fetchButtonSpriteSheet(item, item->controls.size() - 1);
+                    loadButtonSpriteSheet(definition, definition.controls.size() - 1);
                 }
                 else
                 {
@@ -843,15 +841,170 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
 
             default:
                 // For non-knob controls, just add them
-                item->controls.add(control);
+                definition.controls.add(control);
                 break;
             }
         }
     }
 
-    // Call the completion callback if provided
-    if (onComplete)
-        onComplete();
+    return true;
+}
+
+/**
+ * @brief Gets the shared definition of a gear item's unit, attaching it if needed.
+ *
+ * @param item The gear item
+ * @return The definition
+ */
+GearDefinition::Ptr Rack::getDefinition(GearItem &item)
+{
+    if (item.definition == nullptr)
+    {
+        // Units no longer placed anywhere give up their assets first
+        definitions.purgeUnused();
+
+        item.definition = definitions.getOrCreate(item.unitId, item.version);
+
+        // Units without a schema are defined by their own controls
+        if (item.definition->state == GearDefinition::State::Empty && item.definition->controls.isEmpty())
+            item.definition->controls = item.controls;
+    }
+
+    return item.definition;
+}
+
+/**
+ * @brief Takes ownership of a new gear item so it can be placed in a slot.
+ *
+ * @param item The item to place, as created by the gear library
+ * @return The rack's instance, or nullptr if there is no item
+ */
+GearItem *Rack::adoptGearItem(std::unique_ptr<GearItem> item)
+{
+    if (item == nullptr)
+        return nullptr;
+
+    releaseUnusedInstances();
+    return instances.acquire(std::move(*item));
+}
+
+/**
+ * @brief Releases the instances the rack owns that no slot holds any more.
+ *
+ * Slots are cleared and refilled while rearranging, so instances are only
+ * reclaimed here, before the next one is placed, never as a slot is cleared.
+ *
+ * @return The number of instances released
+ */
+int Rack::releaseUnusedInstances()
+{
+    juce::Array<GearItem *> placed;
+    for (auto *slot : slots)
+    {
+        if (auto *item = slot->getGearItem())
+            placed.add(item);
+    }
+
+    return instances.releaseAllExcept(placed);
+}
+
+/**
+ * @brief Gets the memory the instance in a slot refers to.
+ *
+ * @param slotIndex The index of the slot
+ * @return The slot's usage, or nothing if the slot is empty or out of range
+ */
+MemoryUsage Rack::getSlotMemoryUsage(int slotIndex) const
+{
+    auto *slot = slots[slotIndex];
+    if (slot == nullptr || slot->getGearItem() == nullptr)
+        return {};
+
+    MemoryUsage::ImageCounter images;
+    return slot->getGearItem()->getMemoryUsage(images);
+}
+
+/**
+ * @brief Gets the memory the rack holds, counting shared assets once.
+ *
+ * @return The unit definitions' assets, the placed instances' own images and state, and the released instances kept for reuse
+ */
+MemoryUsage Rack::getMemoryUsage() const
+{
+    MemoryUsage::ImageCounter images;
+    return getMemoryUsage(images);
+}
+
+/**
+ * @brief Gets the memory the rack holds, skipping images other holders reported already.
+ *
+ * Definitions are counted first, so instances only add what is their own.
+ *
+ * @param images Counts each image once across holders
+ * @return The unit definitions' assets, the placed instances' own images and state, and the released instances kept for reuse
+ */
+MemoryUsage Rack::getMemoryUsage(MemoryUsage::ImageCounter &images) const
+{
+    auto usage = definitions.getMemoryUsage(images);
+
+    for (auto *slot : slots)
+    {
+        if (auto *item = slot->getGearItem())
+            usage += item->getMemoryUsage(images);
+    }
+
+    usage += instances.getMemoryUsage(images);
+    return usage;
+}
+
+/**
+ * @brief Gives the instances waiting for a definition their controls and completes them.
+ *
+ * @param definition The definition whose schema finished loading
+ * @param success Whether the schema was fetched and parsed
+ */
+void Rack::finishLoadingDefinition(GearDefinition &definition, bool success)
+{
+    definition.state = success ? GearDefinition::State::Loaded : GearDefinition::State::Empty;
+
+    // Completion callbacks may place further instances, so take the list first
+    juce::Array<GearDefinition::Waiter> waiters;
+    waiters.swapWith(definition.waiters);
+
+    for (auto &waiter : waiters)
+    {
+        if (success && waiter.item != nullptr)
+            waiter.item->useDefinitionControls();
+
+        if (waiter.onComplete)
+            waiter.onComplete();
+    }
+
+    shareDefinitionAssets(definition);
+}
+
+/**
+ * @brief Gives every instance of a unit in the rack the definition's current assets.
+ *
+ * @param definition The definition whose assets changed
+ * @param faceplateChanged Whether the faceplate changed, which can change slot heights
+ */
+void Rack::shareDefinitionAssets(GearDefinition &definition, bool faceplateChanged)
+{
+    for (int i = 0; i < getNumSlots(); ++i)
+    {
+        RackSlot *slot = getSlot(i);
+        GearItem *item = slot != nullptr ? slot->getGearItem() : nullptr;
+        if (item != nullptr && item->definition.get() == &definition)
+        {
+            item->useDefinitionAssets();
+            slot->repaint();
+        }
+    }
+
+    // Trigger a re-layout to adjust slot heights for the new image
+    if (faceplateChanged)
+        resized();
 }
 
 /**
@@ -861,46 +1014,47 @@ void Rack::parseSchema(const juce::String &schemaData, GearItem *item, std::func
  */
 void Rack::fetchFaceplateImage(GearItem *item)
 {
-    if (item == nullptr || item->faceplateImagePath.isEmpty())
+    if (item != nullptr)
+        loadFaceplateImage(*getDefinition(*item));
+}
+
+/**
+ * @brief Loads the faceplate image of a unit into its definition.
+ *
+ * @param definition The definition to load the faceplate for
+ */
+void Rack::loadFaceplateImage(GearDefinition &definition)
+{
+    if (definition.faceplateImagePath.isEmpty())
     {
         return;
     }
 
     // Check if faceplate is already loaded to prevent duplicate fetching
-    if (item->faceplateImage.isValid())
+    if (definition.faceplateImage.isValid())
     {
         return;
     }
 
     // Extract filename from faceplate path
-    juce::String filename = fileSystem.getFileName(item->faceplateImagePath);
+    juce::String filename = fileSystem.getFileName(definition.faceplateImagePath);
 
     // Check cache first
-    if (cacheManager.isFaceplateCached(item->unitId, filename))
+    if (cacheManager.isFaceplateCached(definition.unitId, filename))
     {
-        juce::Image cachedImage = cacheManager.loadFaceplateFromCache(item->unitId, filename);
+        juce::Image cachedImage = cacheManager.loadFaceplateFromCache(definition.unitId, filename);
         if (cachedImage.isValid())
         {
-            item->faceplateImage = cachedImage;
-
-            // Notify any slots that have this item to repaint
-            for (int i = 0; i < getNumSlots(); ++i)
-            {
-                RackSlot *slot = getSlot(i);
-                if (slot && slot->getGearItem() == item)
-                {
-                    slot->repaint();
-                }
-            }
+            definition.faceplateImage = cachedImage;
 
-            // Trigger a re-layout to adjust slot heights for the new image
-            resized();
+            // Give every instance of the unit the image and repaint them
+            shareDefinitionAssets(definition, true);
             return;
         }
     }
 
     // Construct the full URL if it's a relative path
-    juce::String fullUrl = item->faceplateImagePath;
+    juce::String fullUrl = definition.faceplateImagePath;
     if (!fullUrl.startsWith("http"))
     {
         // Check if the path is already a full path or needs the base URL
@@ -919,7 +1073,7 @@ void Rack::fetchFaceplateImage(GearItem *item)
      * @brief Thread for downloading faceplate images.
      *
      * This struct handles the asynchronous download and processing of faceplate images
-     * for gear items, ensuring UI updates happen on the message thread.
+     * into a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct FaceplateImageDownloader : public juce::Thread
     {
@@ -927,13 +1081,13 @@ void Rack::fetchFaceplateImage(GearItem *item)
          * @brief Constructs a new FaceplateImageDownloader.
          *
          * @param urlToUse The URL to download the image from
-         * @param itemToUpdate The gear item to update with the image
+         * @param definitionToUpdate The definition to update with the image
          * @param parentRack The rack to notify when the image is loaded
          * @param filenameToCache The filename to use for caching
          */
-        FaceplateImageDownloader(juce::URL urlToUse, GearItem *itemToUpdate, Rack *parentRack, const juce::String &filenameToCache, CacheManager &cacheManagerRef)
+        FaceplateImageDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, Rack *parentRack, const juce::String &filenameToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Faceplate Image Downloader"),
-              url(urlToUse), item(itemToUpdate), rack(parentRack), filename(filenameToCache), cacheManager(cacheManagerRef)
+              url(urlToUse), definition(definitionToUpdate), rack(parentRack), filename(filenameToCache), cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -955,8 +1109,12 @@ void Rack::fetchFaceplateImage(GearItem *item)
          */
         void run() override
         {
-            // Try to download using the simple API - this is for older JUCE versions
-            std::unique_ptr<juce::InputStream> inputStream = url.createInputStream(false);
+            // Download through the fetcher so bundled resources are served without the network
+            bool fetched = false;
+            juce::MemoryBlock downloadedData = networkFetcher.fetchBinaryBlocking(url, fetched);
+            std::unique_ptr<juce::InputStream> inputStream;
+            if (fetched)
+                inputStream = std::make_unique<juce::MemoryInputStream>(downloadedData, false);
 
             if (inputStream == nullptr || threadShouldExit())
             {
@@ -964,10 +1122,7 @@ void Rack::fetchFaceplateImage(GearItem *item)
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr)
-                    {
-                        item->faceplateImage = juce::Image();
-                    }
+                    definition->faceplateImage = juce::Image();
                     delete this; });
                 return;
             }
@@ -1003,36 +1158,15 @@ void Rack::fetchFaceplateImage(GearItem *item)
                 // Need to get back on the message thread to update the UI
                 juce::MessageManager::callAsync([this, downloadedImage]()
                                                 {
-                    // Clear any existing images first
-                    if (item != nullptr)
-                    {
-                        item->faceplateImage = juce::Image();
-                    }
-                    
-                    // Update the item's faceplate image
-                    if (item != nullptr)
-                    {
-                        item->faceplateImage = downloadedImage;
-                        
-                        // Cache the downloaded image
-                        cacheManager.saveFaceplateToCache(item->unitId, filename, downloadedImage);
-                    }
-                    
-                    // Notify any slots that have this item to repaint
+                    // Update the definition's faceplate image
+                    definition->faceplateImage = downloadedImage;
+
+                    // Cache the downloaded image
+                    cacheManager.saveFaceplateToCache(definition->unitId, filename, downloadedImage);
+
+                    // Give every instance of the unit the image and re-layout for its height
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                            }
-                        }
-                        
-                        // Trigger a re-layout to adjust slot heights for the new image
-                        rack->resized();
-                    }
+                        rack->shareDefinitionAssets(*definition, true);
                     
                     delete this; });
             }
@@ -1041,12 +1175,6 @@ void Rack::fetchFaceplateImage(GearItem *item)
                 // Image loading failed, clean up
                 juce::MessageManager::callAsync([this]()
                                                 {
-                    // Clear any existing images
-                    if (item != nullptr)
-                    {
-                        item->faceplateImage = juce::Image();
-                    }
-                    
                     // Create a placeholder image instead
                     juce::Image placeholderImage(juce::Image::RGB, 200, 100, true);
                     juce::Graphics g(placeholderImage);
@@ -1055,40 +1183,26 @@ void Rack::fetchFaceplateImage(GearItem *item)
                     g.drawText("Faceplate Unavailable", placeholderImage.getBounds(), juce::Justification::centred, true);
                     
                     // Set as faceplate image
-                    if (item != nullptr)
-                    {
-                        item->faceplateImage = placeholderImage;
-                    }
-                    
-                    // Repaint any slots with this item
+                    definition->faceplateImage = placeholderImage;
+
+                    // Give every instance of the unit the placeholder and re-layout for its height
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                            }
-                        }
-                        
-                        // Trigger a re-layout to adjust slot heights for the placeholder image
-                        rack->resized();
-                    }
+                        rack->shareDefinitionAssets(*definition, true);
                     
                     delete this; });
             }
         }
 
-        juce::URL url;              ///< The URL to download from
-        GearItem *item;             ///< The gear item to update
-        Rack *rack;                 ///< The rack to notify
-        juce::String filename;      ///< The filename to use for caching
-        CacheManager &cacheManager; ///< Reference to cache manager
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition to update
+        Rack *rack;                      ///< The rack to notify
+        juce::String filename;           ///< The filename to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new FaceplateImageDownloader(imageUrl, item, this, filename, cacheManager);
+    new FaceplateImageDownloader(imageUrl, &definition, this, filename, cacheManager, networkFetcher);
 }
 
 /**
@@ -1099,12 +1213,24 @@ void Rack::fetchFaceplateImage(GearItem *item)
  */
 void Rack::fetchKnobImage(GearItem *item, int controlIndex)
 {
-    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+    if (item != nullptr)
+        loadKnobImage(*getDefinition(*item), controlIndex);
+}
+
+/**
+ * @brief Loads the knob image of a control into its unit's definition.
+ *
+ * @param definition The definition containing the control
+ * @param controlIndex The index of the control
+ */
+void Rack::loadKnobImage(GearDefinition &definition, int controlIndex)
+{
+    if (controlIndex < 0 || controlIndex >= definition.controls.size())
     {
         return;
     }
 
-    GearControl &control = item->controls.getReference(controlIndex);
+    GearControl &control = definition.controls.getReference(controlIndex);
     if (control.image.isEmpty())
     {
         return;
@@ -1124,16 +1250,8 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
         {
             control.loadedImage = cachedImage;
 
-            // Notify any slots that have this item to repaint
-            for (int i = 0; i < getNumSlots(); ++i)
-            {
-                RackSlot *slot = getSlot(i);
-                if (slot != nullptr && slot->getGearItem() == item)
-                {
-                    slot->repaint();
-                    break;
-                }
-            }
+            // Give every instance of the unit the image and repaint them
+            shareDefinitionAssets(definition);
             return;
         }
     }
@@ -1157,7 +1275,7 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
      * @brief Thread for downloading knob images.
      *
      * This struct handles the asynchronous download and processing of knob images
-     * for gear controls, ensuring UI updates happen on the message thread.
+     * for the controls of a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct KnobImageDownloader : public juce::Thread
     {
@@ -1165,21 +1283,21 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
          * @brief Constructs a new KnobImageDownloader.
          *
          * @param urlToUse The URL to download the image from
-         * @param itemToUpdate The gear item containing the control
+         * @param definitionToUpdate The definition containing the control
          * @param controlIndexToUpdate The index of the control to update
          * @param parentRack The rack to notify when the image is loaded
          * @param assetPathToCache The asset path to use for caching
          */
-        KnobImageDownloader(juce::URL urlToUse, GearItem *itemToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef)
+        KnobImageDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Knob Image Downloader"),
               url(urlToUse),
-              item(itemToUpdate),
+              definition(definitionToUpdate),
               controlIndex(controlIndexToUpdate),
               rack(parentRack),
-              controlId(itemToUpdate->controls[controlIndexToUpdate].id),
-              controlName(itemToUpdate->controls[controlIndexToUpdate].name),
+              controlId(definitionToUpdate->controls[controlIndexToUpdate].id),
+              controlName(definitionToUpdate->controls[controlIndexToUpdate].name),
               assetPath(assetPathToCache),
-              cacheManager(cacheManagerRef)
+              cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -1201,17 +1319,21 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
          */
         void run() override
         {
-            // Try to download using the simple API - this is for older JUCE versions
-            std::unique_ptr<juce::InputStream> inputStream = url.createInputStream(false);
+            // Download through the fetcher so bundled resources are served without the network
+            bool fetched = false;
+            juce::MemoryBlock downloadedData = networkFetcher.fetchBinaryBlocking(url, fetched);
+            std::unique_ptr<juce::InputStream> inputStream;
+            if (fetched)
+                inputStream = std::make_unique<juce::MemoryInputStream>(downloadedData, false);
 
             if (inputStream == nullptr || threadShouldExit())
             {
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].loadedImage = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
                 return;
@@ -1248,15 +1370,15 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
                 // Need to get back on the message thread to update the UI
                 juce::MessageManager::callAsync([this, downloadedImage]()
                                                 {
-                    // Validate item and control index are still valid
-                    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+                    // Validate the control index is still valid
+                    if (controlIndex < 0 || controlIndex >= definition->controls.size())
                     {
                         delete this;
                         return;
                     }
 
                     // Validate control ID matches
-                    GearControl &control = item->controls.getReference(controlIndex);
+                    GearControl &control = definition->controls.getReference(controlIndex);
                     if (control.id != controlId)
                     {
                         delete this;
@@ -1285,19 +1407,9 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
                     
                     cacheManager.saveControlAssetToCache(assetPath, imageData);
                     
-                    // Notify any slots that have this item to repaint
+                    // Give every instance of the unit the image and repaint them
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot != nullptr && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                                break;
-                            }
-                        }
-                    }
+                        rack->shareDefinitionAssets(*definition);
                     
                     delete this; });
             }
@@ -1306,26 +1418,27 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].loadedImage = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
             }
         }
 
-        juce::URL url;              ///< The URL to download from
-        GearItem *item;             ///< The gear item containing the control
-        int controlIndex;           ///< The index of the control to update
-        Rack *rack;                 ///< The rack to notify
-        juce::String controlId;     ///< The ID of the control being updated
-        juce::String controlName;   ///< The name of the control being updated
-        juce::String assetPath;     ///< The asset path to use for caching
-        CacheManager &cacheManager; ///< Reference to cache manager
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition containing the control
+        int controlIndex;                ///< The index of the control to update
+        Rack *rack;                      ///< The rack to notify
+        juce::String controlId;          ///< The ID of the control being updated
+        juce::String controlName;        ///< The name of the control being updated
+        juce::String assetPath;          ///< The asset path to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new KnobImageDownloader(imageUrl, item, controlIndex, this, control.image, cacheManager);
+    new KnobImageDownloader(imageUrl, &definition, controlIndex, this, control.image, cacheManager, networkFetcher);
 }
 
 /**
@@ -1336,19 +1449,31 @@ void Rack::fetchKnobImage(GearItem *item, int controlIndex)
  */
 void Rack::fetchFaderImage(GearItem *item, int controlIndex)
 {
-    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+    if (item != nullptr)
+        loadFaderImage(*getDefinition(*item), controlIndex);
+}
+
+/**
+ * @brief Loads the fader image of a control into its unit's definition.
+ *
+ * @param definition The definition containing the control
+ * @param controlIndex The index of the control
+ */
+void Rack::loadFaderImage(GearDefinition &definition, int controlIndex)
+{
+    if (controlIndex < 0 || controlIndex >= definition.controls.size())
     {
         return;
     }
 
-    GearControl &control = item->controls.getReference(controlIndex);
+    GearControl &control = definition.controls.getReference(controlIndex);
     if (control.image.isEmpty())
     {
         return;
     }
 
     // Check if image is already loaded to prevent duplicate loading
-    if (control.faderImage.isValid())
+    if (control.loadedImage.isValid())
     {
         return;
     }
@@ -1359,18 +1484,10 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
         juce::Image cachedImage = cacheManager.loadControlAssetFromCache(control.image);
         if (cachedImage.isValid())
         {
-            control.faderImage = cachedImage;
+            control.loadedImage = cachedImage;
 
-            // Notify any slots that have this item to repaint
-            for (int i = 0; i < getNumSlots(); ++i)
-            {
-                RackSlot *slot = getSlot(i);
-                if (slot != nullptr && slot->getGearItem() == item)
-                {
-                    slot->repaint();
-                    break;
-                }
-            }
+            // Give every instance of the unit the image and repaint them
+            shareDefinitionAssets(definition);
             return;
         }
     }
@@ -1394,7 +1511,7 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
      * @brief Thread for downloading fader images.
      *
      * This struct handles the asynchronous download and processing of fader images
-     * for gear controls, ensuring UI updates happen on the message thread.
+     * for the controls of a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct FaderImageDownloader : public juce::Thread
     {
@@ -1402,21 +1519,21 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
          * @brief Constructs a new FaderImageDownloader.
          *
          * @param urlToUse The URL to download the image from
-         * @param itemToUpdate The gear item containing the control
+         * @param definitionToUpdate The definition containing the control
          * @param controlIndexToUpdate The index of the control to update
          * @param parentRack The rack to notify when the image is loaded
          * @param assetPathToCache The asset path to use for caching
          */
-        FaderImageDownloader(juce::URL urlToUse, GearItem *itemToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef)
+        FaderImageDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Fader Image Downloader"),
               url(urlToUse),
-              item(itemToUpdate),
+              definition(definitionToUpdate),
               controlIndex(controlIndexToUpdate),
               rack(parentRack),
-              controlId(itemToUpdate->controls[controlIndexToUpdate].id),
-              controlName(itemToUpdate->controls[controlIndexToUpdate].name),
+              controlId(definitionToUpdate->controls[controlIndexToUpdate].id),
+              controlName(definitionToUpdate->controls[controlIndexToUpdate].name),
               assetPath(assetPathToCache),
-              cacheManager(cacheManagerRef)
+              cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -1438,17 +1555,21 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
          */
         void run() override
         {
-            // Try to download using the simple API - this is for older JUCE versions
-            std::unique_ptr<juce::InputStream> inputStream = url.createInputStream(false);
+            // Download through the fetcher so bundled resources are served without the network
+            bool fetched = false;
+            juce::MemoryBlock downloadedData = networkFetcher.fetchBinaryBlocking(url, fetched);
+            std::unique_ptr<juce::InputStream> inputStream;
+            if (fetched)
+                inputStream = std::make_unique<juce::MemoryInputStream>(downloadedData, false);
 
             if (inputStream == nullptr || threadShouldExit())
             {
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].faderImage = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
                 return;
@@ -1486,15 +1607,15 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this, downloadedImage]()
                                                 {
                     
-                    // Validate item and control index are still valid
-                    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+                    // Validate the control index is still valid
+                    if (controlIndex < 0 || controlIndex >= definition->controls.size())
                     {
                         delete this;
                         return;
                     }
 
                     // Validate control ID matches
-                    GearControl &control = item->controls.getReference(controlIndex);
+                    GearControl &control = definition->controls.getReference(controlIndex);
                     if (control.id != controlId)
                     {
                         delete this;
@@ -1502,7 +1623,7 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
                     }
 
                     // Update the control's fader image
-                    control.faderImage = downloadedImage;
+                    control.loadedImage = downloadedImage;
                     
                     // Cache the downloaded image
                     juce::MemoryBlock imageData;
@@ -1523,19 +1644,9 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
                     
                     cacheManager.saveControlAssetToCache(assetPath, imageData);
                     
-                    // Notify any slots that have this item to repaint
+                    // Give every instance of the unit the image and repaint them
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot != nullptr && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                                break;
-                            }
-                        }
-                    }
+                        rack->shareDefinitionAssets(*definition);
                     
                     delete this; });
             }
@@ -1544,26 +1655,27 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].faderImage = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
             }
         }
 
-        juce::URL url;              ///< The URL to download from
-        GearItem *item;             ///< The gear item containing the control
-        int controlIndex;           ///< The index of the control to update
-        Rack *rack;                 ///< The rack to notify
-        juce::String controlId;     ///< The ID of the control being updated
-        juce::String controlName;   ///< The name of the control being updated
-        juce::String assetPath;     ///< The asset path to use for caching
-        CacheManager &cacheManager; ///< Reference to cache manager
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition containing the control
+        int controlIndex;                ///< The index of the control to update
+        Rack *rack;                      ///< The rack to notify
+        juce::String controlId;          ///< The ID of the control being updated
+        juce::String controlName;        ///< The name of the control being updated
+        juce::String assetPath;          ///< The asset path to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new FaderImageDownloader(imageUrl, item, controlIndex, this, control.image, cacheManager);
+    new FaderImageDownloader(imageUrl, &definition, controlIndex, this, control.image, cacheManager, networkFetcher);
 }
 
 /**
@@ -1574,19 +1686,31 @@ void Rack::fetchFaderImage(GearItem *item, int controlIndex)
  */
 void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
 {
-    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+    if (item != nullptr)
+        loadSwitchSpriteSheet(*getDefinition(*item), controlIndex);
+}
+
+/**
+ * @brief Loads the switch sprite sheet of a control into its unit's definition.
+ *
+ * @param definition The definition containing the control
+ * @param controlIndex The index of the control
+ */
+void Rack::loadSwitchSpriteSheet(GearDefinition &definition, int controlIndex)
+{
+    if (controlIndex < 0 || controlIndex >= definition.controls.size())
     {
         return;
     }
 
-    GearControl &control = item->controls.getReference(controlIndex);
+    GearControl &control = definition.controls.getReference(controlIndex);
     if (control.image.isEmpty())
     {
         return;
     }
 
     // Check if image is already loaded to prevent duplicate loading
-    if (control.switchSpriteSheet.isValid())
+    if (control.loadedImage.isValid())
     {
         return;
     }
@@ -1597,18 +1721,10 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
         juce::Image cachedImage = cacheManager.loadControlAssetFromCache(control.image);
         if (cachedImage.isValid())
         {
-            control.switchSpriteSheet = cachedImage;
+            control.loadedImage = cachedImage;
 
-            // Notify any slots that have this item to repaint
-            for (int i = 0; i < getNumSlots(); ++i)
-            {
-                RackSlot *slot = getSlot(i);
-                if (slot != nullptr && slot->getGearItem() == item)
-                {
-                    slot->repaint();
-                    break;
-                }
-            }
+            // Give every instance of the unit the image and repaint them
+            shareDefinitionAssets(definition);
             return;
         }
     }
@@ -1632,7 +1748,7 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
      * @brief Thread for downloading switch sprite sheets.
      *
      * This struct handles the asynchronous download and processing of switch sprite sheets
-     * for gear controls, ensuring UI updates happen on the message thread.
+     * for the controls of a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct SwitchSpriteSheetDownloader : public juce::Thread
     {
@@ -1640,21 +1756,21 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
          * @brief Constructs a new SwitchSpriteSheetDownloader.
          *
          * @param urlToUse The URL to download the sprite sheet from
-         * @param itemToUpdate The gear item containing the control
+         * @param definitionToUpdate The definition containing the control
          * @param controlIndexToUpdate The index of the control to update
          * @param parentRack The rack to notify when the sprite sheet is loaded
          * @param assetPathToCache The asset path to use for caching
          */
-        SwitchSpriteSheetDownloader(juce::URL urlToUse, GearItem *itemToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef)
+        SwitchSpriteSheetDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Switch Sprite Sheet Downloader"),
               url(urlToUse),
-              item(itemToUpdate),
+              definition(definitionToUpdate),
               controlIndex(controlIndexToUpdate),
               rack(parentRack),
-              controlId(itemToUpdate->controls[controlIndexToUpdate].id),
-              controlName(itemToUpdate->controls[controlIndexToUpdate].name),
+              controlId(definitionToUpdate->controls[controlIndexToUpdate].id),
+              controlName(definitionToUpdate->controls[controlIndexToUpdate].name),
               assetPath(assetPathToCache),
-              cacheManager(cacheManagerRef)
+              cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -1676,17 +1792,21 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
          */
         void run() override
         {
-            // Try to download using the simple API - this is for older JUCE versions
-            std::unique_ptr<juce::InputStream> inputStream = url.createInputStream(false);
+            // Download through the fetcher so bundled resources are served without the network
+            bool fetched = false;
+            juce::MemoryBlock downloadedData = networkFetcher.fetchBinaryBlocking(url, fetched);
+            std::unique_ptr<juce::InputStream> inputStream;
+            if (fetched)
+                inputStream = std::make_unique<juce::MemoryInputStream>(downloadedData, false);
 
             if (inputStream == nullptr || threadShouldExit())
             {
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].switchSpriteSheet = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
                 return;
@@ -1724,15 +1844,15 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this, downloadedImage]()
                                                 {
                     
-                    // Validate item and control index are still valid
-                    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+                    // Validate the control index is still valid
+                    if (controlIndex < 0 || controlIndex >= definition->controls.size())
                     {
                         delete this;
                         return;
                     }
 
                     // Validate control ID matches
-                    GearControl &control = item->controls.getReference(controlIndex);
+                    GearControl &control = definition->controls.getReference(controlIndex);
                     if (control.id != controlId)
                     {
                         delete this;
@@ -1740,7 +1860,7 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
                     }
 
                     // Update the control's sprite sheet
-                    control.switchSpriteSheet = downloadedImage;
+                    control.loadedImage = downloadedImage;
                     
                     // Cache the downloaded image
                     juce::MemoryBlock imageData;
@@ -1761,19 +1881,9 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
                     
                     cacheManager.saveControlAssetToCache(assetPath, imageData);
                     
-                    // Notify any slots that have this item to repaint
+                    // Give every instance of the unit the image and repaint them
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot != nullptr && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                                break;
-                            }
-                        }
-                    }
+                        rack->shareDefinitionAssets(*definition);
                     
                     delete this; });
             }
@@ -1782,26 +1892,27 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].switchSpriteSheet = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
             }
         }
 
-        juce::URL url;              ///< The URL to download from
-        GearItem *item;             ///< The gear item containing the control
-        int controlIndex;           ///< The index of the control to update
-        Rack *rack;                 ///< The rack to notify
-        juce::String controlId;     ///< The ID of the control being updated
-        juce::String controlName;   ///< The name of the control being updated
-        juce::String assetPath;     ///< The asset path to use for caching
-        CacheManager &cacheManager; ///< Reference to cache manager
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition containing the control
+        int controlIndex;                ///< The index of the control to update
+        Rack *rack;                      ///< The rack to notify
+        juce::String controlId;          ///< The ID of the control being updated
+        juce::String controlName;        ///< The name of the control being updated
+        juce::String assetPath;          ///< The asset path to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new SwitchSpriteSheetDownloader(imageUrl, item, controlIndex, this, control.image, cacheManager);
+    new SwitchSpriteSheetDownloader(imageUrl, &definition, controlIndex, this, control.image, cacheManager, networkFetcher);
 }
 
 /**
@@ -1812,19 +1923,31 @@ void Rack::fetchSwitchSpriteSheet(GearItem *item, int controlIndex)
  */
 void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
 {
-    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+    if (item != nullptr)
+        loadButtonSpriteSheet(*getDefinition(*item), controlIndex);
+}
+
+/**
+ * @brief Loads the button sprite sheet of a control into its unit's definition.
+ *
+ * @param definition The definition containing the control
+ * @param controlIndex The index of the control
+ */
+void Rack::loadButtonSpriteSheet(GearDefinition &definition, int controlIndex)
+{
+    if (controlIndex < 0 || controlIndex >= definition.controls.size())
     {
         return;
     }
 
-    GearControl &control = item->controls.getReference(controlIndex);
+    GearControl &control = definition.controls.getReference(controlIndex);
     if (control.image.isEmpty())
     {
         return;
     }
 
     // Check if image is already loaded to prevent duplicate loading
-    if (control.buttonSpriteSheet.isValid())
+    if (control.loadedImage.isValid())
     {
         return;
     }
@@ -1835,18 +1958,10 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
         juce::Image cachedImage = cacheManager.loadControlAssetFromCache(control.image);
         if (cachedImage.isValid())
         {
-            control.buttonSpriteSheet = cachedImage;
+            control.loadedImage = cachedImage;
 
-            // Notify any slots that have this item to repaint
-            for (int i = 0; i < getNumSlots(); ++i)
-            {
-                RackSlot *slot = getSlot(i);
-                if (slot != nullptr && slot->getGearItem() == item)
-                {
-                    slot->repaint();
-                    break;
-                }
-            }
+            // Give every instance of the unit the image and repaint them
+            shareDefinitionAssets(definition);
             return;
         }
     }
@@ -1870,7 +1985,7 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
      * @brief Thread for downloading button sprite sheets.
      *
      * This struct handles the asynchronous download and processing of button sprite sheets
-     * for gear controls, ensuring UI updates happen on the message thread.
+     * for the controls of a unit's definition, ensuring UI updates happen on the message thread.
      */
     struct ButtonSpriteSheetDownloader : public juce::Thread
     {
@@ -1878,21 +1993,21 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
          * @brief Constructs a new ButtonSpriteSheetDownloader.
          *
          * @param urlToUse The URL to download the sprite sheet from
-         * @param itemToUpdate The gear item containing the control
+         * @param definitionToUpdate The definition containing the control
          * @param controlIndexToUpdate The index of the control to update
          * @param parentRack The rack to notify when the sprite sheet is loaded
          * @param assetPathToCache The asset path to use for caching
          */
-        ButtonSpriteSheetDownloader(juce::URL urlToUse, GearItem *itemToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef)
+        ButtonSpriteSheetDownloader(juce::URL urlToUse, GearDefinition::Ptr definitionToUpdate, int controlIndexToUpdate, Rack *parentRack, const juce::String &assetPathToCache, CacheManager &cacheManagerRef, INetworkFetcher &networkFetcherRef)
             : juce::Thread("Button Sprite Sheet Downloader"),
               url(urlToUse),
-              item(itemToUpdate),
+              definition(definitionToUpdate),
               controlIndex(controlIndexToUpdate),
               rack(parentRack),
-              controlId(itemToUpdate->controls[controlIndexToUpdate].id),
-              controlName(itemToUpdate->controls[controlIndexToUpdate].name),
+              controlId(definitionToUpdate->controls[controlIndexToUpdate].id),
+              controlName(definitionToUpdate->controls[controlIndexToUpdate].name),
               assetPath(assetPathToCache),
-              cacheManager(cacheManagerRef)
+              cacheManager(cacheManagerRef), networkFetcher(networkFetcherRef)
         {
             startThread();
         }
@@ -1914,17 +2029,21 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
          */
         void run() override
         {
-            // Try to download using the simple API - this is for older JUCE versions
-            std::unique_ptr<juce::InputStream> inputStream = url.createInputStream(false);
+            // Download through the fetcher so bundled resources are served without the network
+            bool fetched = false;
+            juce::MemoryBlock downloadedData = networkFetcher.fetchBinaryBlocking(url, fetched);
+            std::unique_ptr<juce::InputStream> inputStream;
+            if (fetched)
+                inputStream = std::make_unique<juce::MemoryInputStream>(downloadedData, false);
 
             if (inputStream == nullptr || threadShouldExit())
             {
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].buttonSpriteSheet = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
                 return;
@@ -1962,15 +2081,15 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this, downloadedImage]()
                                                 {
                     
-                    // Validate item and control index are still valid
-                    if (item == nullptr || controlIndex < 0 || controlIndex >= item->controls.size())
+                    // Validate the control index is still valid
+                    if (controlIndex < 0 || controlIndex >= definition->controls.size())
                     {
                         delete this;
                         return;
                     }
 
                     // Validate control ID matches
-                    GearControl &control = item->controls.getReference(controlIndex);
+                    GearControl &control = definition->controls.getReference(controlIndex);
                     if (control.id != controlId)
                     {
                         delete this;
@@ -1978,7 +2097,7 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
                     }
 
                     // Update the control's sprite sheet
-                    control.buttonSpriteSheet = downloadedImage;
+                    control.loadedImage = downloadedImage;
                     
                     // Cache the downloaded image
                     juce::MemoryBlock imageData;
@@ -1999,19 +2118,9 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
                     
                     cacheManager.saveControlAssetToCache(assetPath, imageData);
                     
-                    // Notify any slots that have this item to repaint
+                    // Give every instance of the unit the image and repaint them
                     if (rack != nullptr)
-                    {
-                        for (int i = 0; i < rack->getNumSlots(); ++i)
-                        {
-                            RackSlot *slot = rack->getSlot(i);
-                            if (slot != nullptr && slot->getGearItem() == item)
-                            {
-                                slot->repaint();
-                                break;
-                            }
-                        }
-                    }
+                        rack->shareDefinitionAssets(*definition);
                     
                     delete this; });
             }
@@ -2020,26 +2129,27 @@ void Rack::fetchButtonSpriteSheet(GearItem *item, int controlIndex)
                 juce::MessageManager::callAsync([this]()
                                                 { 
                     // Clear any existing images
-                    if (item != nullptr && controlIndex >= 0 && controlIndex < item->controls.size())
+                    if (controlIndex >= 0 && controlIndex < definition->controls.size())
                     {
-                        item->controls[controlIndex].buttonSpriteSheet = juce::Image();
+                        definition->controls[controlIndex].loadedImage = juce::Image();
                     }
                     delete this; });
             }
         }
 
-        juce::URL url;              ///< The URL to download from
-        GearItem *item;             ///< The gear item containing the control
-        int controlIndex;           ///< The index of the control to update
-        Rack *rack;                 ///< The rack to notify
-        juce::String controlId;     ///< The ID of the control being updated
-        juce::String controlName;   ///< The name of the control being updated
-        juce::String assetPath;     ///< The asset path to use for caching
-        CacheManager &cacheManager; ///< Reference to cache manager
+        juce::URL url;                   ///< The URL to download from
+        GearDefinition::Ptr definition;  ///< The definition containing the control
+        int controlIndex;                ///< The index of the control to update
+        Rack *rack;                      ///< The rack to notify
+        juce::String controlId;          ///< The ID of the control being updated
+        juce::String controlName;        ///< The name of the control being updated
+        juce::String assetPath;          ///< The asset path to use for caching
+        CacheManager &cacheManager;      ///< Reference to cache manager
+        INetworkFetcher &networkFetcher; ///< Fetcher used for the download
     };
 
     // Create and start the download thread (it will delete itself when done)
-    new ButtonSpriteSheetDownloader(imageUrl, item, controlIndex, this, control.image, cacheManager);
+    new ButtonSpriteSheetDownloader(imageUrl, &definition, controlIndex, this, control.image, cacheManager, networkFetcher);
 }
 
 /**
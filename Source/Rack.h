@@ -12,6 +12,7 @@
 #include <JuceHeader.h>
 #include "RackSlot.h"
 #include "GearItem.h"
+#include "GearInstancePool.h"
 #include "GearLibrary.h"
 #include "INetworkFetcher.h"
 #include "RackStateListener.h"
@@ -208,23 +209,100 @@ public:
     /**
      * @brief Fetches the schema for a gear item.
      *
+     * The schema is loaded once per unit into a definition shared by every
+     * instance; an instance of a unit already loaded gets its controls at once.
+     *
      * @param item The gear item to fetch the schema for
      * @param onComplete Optional callback to execute when schema loading is complete
      */
     void fetchSchemaForGearItem(GearItem *item, std::function<void()> onComplete = nullptr);
 
     /**
-     * @brief Parses the schema data for a gear item.
+     * @brief Parses schema data into a unit's definition.
      *
      * @param schemaData The JSON schema data to parse
-     * @param item The gear item to update with the parsed schema
-     * @param onComplete Optional callback to execute when parsing is complete
+     * @param definition The definition to fill with the faceplate and controls
+     * @return true if the schema could be parsed
      */
-    void parseSchema(const juce::String &schemaData, GearItem *item, std::function<void()> onComplete = nullptr);
+    bool parseSchema(const juce::String &schemaData, GearDefinition &definition);
+
+    /**
+     * @brief Gets the shared definition of a gear item's unit, attaching it if needed.
+     *
+     * An item without a definition gets the one of its unit and version; if
+     * that has no controls yet, the item's own controls seed it, which is how
+     * units without a schema get their assets loaded.
+     *
+     * @param item The gear item
+     * @return The definition
+     */
+    GearDefinition::Ptr getDefinition(GearItem &item);
+
+    /**
+     * @brief Gets the number of unit definitions the rack holds.
+     *
+     * @return The number of distinct units whose definitions are loaded or in use
+     */
+    int getNumDefinitions() const { return definitions.size(); }
+
+    /**
+     * @brief Takes ownership of a new gear item so it can be placed in a slot.
+     *
+     * The rack owns every instance placed in its slots; slots only refer to
+     * them. Instances no slot holds any more are released first, so the new
+     * item can reuse one of them.
+     *
+     * @param item The item to place, as created by the gear library
+     * @return The rack's instance, or nullptr if there is no item
+     */
+    GearItem *adoptGearItem(std::unique_ptr<GearItem> item);
+
+    /**
+     * @brief Releases the instances the rack owns that no slot holds any more.
+     *
+     * @return The number of instances released
+     */
+    int releaseUnusedInstances();
+
+    /**
+     * @brief Gets the pool of instances the rack owns.
+     *
+     * @return The instance pool
+     */
+    const GearInstancePool &getInstancePool() const { return instances; }
+
+    /**
+     * @brief Gets the memory the instance in a slot refers to.
+     *
+     * Assets an instance shares with other instances of its unit are reported
+     * for every slot holding one, so the slots can add up to more than
+     * getMemoryUsage().
+     *
+     * @param slotIndex The index of the slot
+     * @return The slot's usage, or nothing if the slot is empty or out of range
+     */
+    MemoryUsage getSlotMemoryUsage(int slotIndex) const;
+
+    /**
+     * @brief Gets the memory the rack holds, counting shared assets once.
+     *
+     * @return The unit definitions' assets, the placed instances' own images and state, and the released instances kept for reuse
+     */
+    MemoryUsage getMemoryUsage() const;
+
+    /**
+     * @brief Gets the memory the rack holds, skipping images other holders reported already.
+     *
+     * @param images Counts each image once across holders
+     * @return The unit definitions' assets, the placed instances' own images and state, and the released instances kept for reuse
+     */
+    MemoryUsage getMemoryUsage(MemoryUsage::ImageCounter &images) const;
 
     /**
      * @brief Fetches the faceplate image for a gear item.
      *
+     * The image is loaded into the unit's definition, once for every instance.
+     *
      * @param item The gear item to fetch the faceplate for
      */
     void fetchFaceplateImage(GearItem *item);
@@ -329,6 +407,9 @@ private:
     int numSlots = 16;    ///< Number of slots in the rack
     int slotSpacing = 10; ///< Spacing between slots in pixels
 
+    // Instances placed in the slots, declared first so they outlive the slots
+    GearInstancePool instances; ///< Owns the gear items the slots refer to
+
     // UI Components
     std::unique_ptr<juce::Viewport> rackViewport; ///< Viewport for scrolling the rack
     std::unique_ptr<RackContainer> rackContainer; ///< Container for rack slots
@@ -352,6 +433,32 @@ private:
     // Listener management
     juce::Array<RackStateListener *> rackStateListeners; ///< Array of rack state listeners
 
+    // Schema data shared by the instances of each unit
+    GearDefinitionCache definitions; ///< One definition per unit and version
+
+    /**
+     * @brief Gives the instances waiting for a definition their controls and completes them.
+     *
+     * @param definition The definition whose schema finished loading
+     * @param success Whether the schema was fetched and parsed
+     */
+    void finishLoadingDefinition(GearDefinition &definition, bool success);
+
+    /**
+     * @brief Gives every instance of a unit in the rack the definition's current assets.
+     *
+     * @param definition The definition whose assets changed
+     * @param faceplateChanged Whether the faceplate changed, which can change slot heights
+     */
+    void shareDefinitionAssets(GearDefinition &definition, bool faceplateChanged = false);
+
+    // Asset loaders behind the fetch methods, which fill the unit's definition
+    void loadFaceplateImage(GearDefinition &definition);                      ///< Loads the faceplate image
+    void loadKnobImage(GearDefinition &definition, int controlIndex);         ///< Loads a knob image
+    void loadFaderImage(GearDefinition &definition, int controlIndex);        ///< Loads a fader image
+    void loadSwitchSpriteSheet(GearDefinition &definition, int controlIndex); ///< Loads a switch sprite sheet
+    void loadButtonSpriteSheet(GearDefinition &definition, int controlIndex); ///< Loads a button sprite sheet
+
     /**
      * @brief Gets the height of a specific rack slot.
      *
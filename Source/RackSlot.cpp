@@ -22,7 +22,7 @@
  * @param slotIndex The index of this slot in the rack
  */
 RackSlot::RackSlot(IFileSystem &fileSystem, CacheManager &cacheManager, PresetManager &presetManager, GearLibrary &gearLibrary, int slotIndex)
-    : fileSystem(fileSystem), cacheManager(cacheManager), presetManager(presetManager), gearLibrary(gearLibrary), index(slotIndex), highlighted(false), isDragging(false), dragStartValue(0.0f), activeControl(nullptr), currentFaceplateScale(1.0f)
+    : fileSystem(fileSystem), cacheManager(cacheManager), presetManager(presetManager), gearLibrary(gearLibrary), index(slotIndex), highlighted(false), isDragging(false), dragStartValue(0.0f), activeControlIndex(-1), currentFaceplateScale(1.0f)
 {
     setComponentID("RackSlot_" + juce::String(index));
     setInterceptsMouseClicks(true, true);
@@ -110,17 +110,14 @@ RackSlot::~RackSlot()
 {
     if (gearItem != nullptr)
     {
-        // Clear the main images
+        // Clear the main images and release the unit's shared definition
         gearItem->image = juce::Image();
-        gearItem->faceplateImage = juce::Image();
+        gearItem->definition = nullptr;
 
         // Clear images in controls
         for (auto &control : gearItem->controls)
         {
             control.loadedImage = juce::Image();
-            control.switchSpriteSheet = juce::Image();
-            control.faderImage = juce::Image();
-            control.buttonSpriteSheet = juce::Image();
         }
     }
 
@@ -162,7 +159,7 @@ void RackSlot::paint(juce::Graphics &g)
     {
 
         // Check if we have a faceplate image
-        bool hasFaceplate = gearItem->faceplateImage.isValid();
+        bool hasFaceplate = gearItem->getFaceplateImage().isValid();
 
         if (hasFaceplate)
         {
@@ -176,8 +173,8 @@ void RackSlot::paint(juce::Graphics &g)
             g.drawText(gearItem->name, nameArea, juce::Justification::centred, true);
 
             // Calculate scaling factor based on faceplate dimensions
-            float originalWidth = (float)gearItem->faceplateImage.getWidth();
-            float originalHeight = (float)gearItem->faceplateImage.getHeight();
+            float originalWidth = (float)gearItem->getFaceplateImage().getWidth();
+            float originalHeight = (float)gearItem->getFaceplateImage().getHeight();
             float targetWidth = (float)faceplateArea.getWidth();
             float targetHeight = (float)faceplateArea.getHeight();
 
@@ -190,7 +187,7 @@ void RackSlot::paint(juce::Graphics &g)
             currentFaceplateScale = scaleFactor;
 
             // Draw the faceplate image
-            g.drawImageWithin(gearItem->faceplateImage,
+            g.drawImageWithin(gearItem->getFaceplateImage(),
                               faceplateArea.getX(), faceplateArea.getY(),
                               faceplateArea.getWidth(), faceplateArea.getHeight(),
                               juce::RectanglePlacement::centred | juce::RectanglePlacement::onlyReduceInSize);
@@ -243,8 +240,11 @@ void RackSlot::drawControls(juce::Graphics &g, const juce::Rectangle<int> &facep
     if (gearItem == nullptr)
         return;
 
-    for (const auto &control : gearItem->controls)
+    for (int i = 0; i < gearItem->controls.size(); ++i)
     {
+        const auto &control = gearItem->controls.getReference(i);
+        const auto state = gearItem->getControlState(i);
+
         // Calculate control position relative to faceplate
         int x = faceplateArea.getX() + (int)(control.position.getX() * faceplateArea.getWidth());
         int y = faceplateArea.getY() + (int)(control.position.getY() * faceplateArea.getHeight());
@@ -253,16 +253,16 @@ void RackSlot::drawControls(juce::Graphics &g, const juce::Rectangle<int> &facep
         switch (control.type)
         {
         case GearControl::Type::Switch:
-            drawSwitch(g, control, x, y);
+            drawSwitch(g, control, state, x, y);
             break;
         case GearControl::Type::Button:
-            drawButton(g, control, x, y);
+            drawButton(g, control, state, x, y);
             break;
         case GearControl::Type::Fader:
-            drawFader(g, control, x, y);
+            drawFader(g, control, state, x, y);
             break;
         case GearControl::Type::Knob:
-            drawKnob(g, control, x, y);
+            drawKnob(g, control, state, x, y);
             break;
         }
     }
@@ -273,32 +273,35 @@ void RackSlot::drawControls(juce::Graphics &g, const juce::Rectangle<int> &facep
  *
  * @param g The graphics context to paint with
  * @param control The control to draw
+ * @param state The state the gear item's control is in
  * @param x The x-coordinate for the control
  * @param y The y-coordinate for the control
  */
-void RackSlot::drawSwitch(juce::Graphics &g, const GearControl &control, int x, int y)
+void RackSlot::drawSwitch(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y)
 {
-    const bool isVertical = control.orientation == "vertical";
-    const int currentIndex = control.currentIndex;
+    const bool isVertical = control.isVertical();
+    const int currentIndex = state.currentIndex;
+    const auto &frames = control.selector().frames;
+    const int numOptions = control.selector().options.size();
 
     // If we have a valid sprite sheet and frame data
-    if (control.switchSpriteSheet.isValid() && control.switchFrames.size() > 0)
+    if (control.loadedImage.isValid() && frames.size() > 0)
     {
         // Get the current frame
-        if (currentIndex >= 0 && currentIndex < control.switchFrames.size())
+        if (currentIndex >= 0 && currentIndex < frames.size())
         {
-            const auto &frame = control.switchFrames[currentIndex];
+            const auto &frame = frames[currentIndex];
 
             // Get the original sprite sheet dimensions
-            float originalSpriteWidth = (float)control.switchSpriteSheet.getWidth();
-            float originalSpriteHeight = (float)control.switchSpriteSheet.getHeight();
+            float originalSpriteWidth = (float)control.loadedImage.getWidth();
+            float originalSpriteHeight = (float)control.loadedImage.getHeight();
 
             // Scale the sprite sheet dimensions by the faceplate scale
             float scaledSpriteWidth = originalSpriteWidth * currentFaceplateScale;
             float scaledSpriteHeight = originalSpriteHeight * currentFaceplateScale;
 
             // Create a scaled version of the sprite sheet
-            juce::Image scaledSpriteSheet = control.switchSpriteSheet.rescaled(
+            juce::Image scaledSpriteSheet = control.loadedImage.rescaled(
                 (int)scaledSpriteWidth,
                 (int)scaledSpriteHeight,
                 juce::Graphics::ResamplingQuality::highResamplingQuality);
@@ -345,13 +348,13 @@ void RackSlot::drawSwitch(juce::Graphics &g, const GearControl &control, int x,
         g.setColour(juce::Colours::white);
         if (isVertical)
         {
-            float indicatorY = y + (currentIndex * (switchHeight / control.options.size()));
-            g.fillRoundedRectangle(x + 4, indicatorY + 4, switchWidth - 8, (switchHeight / control.options.size()) - 8, 2.0f);
+            float indicatorY = y + (currentIndex * (switchHeight / numOptions));
+            g.fillRoundedRectangle(x + 4, indicatorY + 4, switchWidth - 8, (switchHeight / numOptions) - 8, 2.0f);
         }
         else
         {
-            float indicatorX = x + (currentIndex * (switchWidth / control.options.size()));
-            g.fillRoundedRectangle(indicatorX + 4, y + 4, (switchWidth / control.options.size()) - 8, switchHeight - 8, 2.0f);
+            float indicatorX = x + (currentIndex * (switchWidth / numOptions));
+            g.fillRoundedRectangle(indicatorX + 4, y + 4, (switchWidth / numOptions) - 8, switchHeight - 8, 2.0f);
         }
     }
 }
@@ -361,34 +364,36 @@ void RackSlot::drawSwitch(juce::Graphics &g, const GearControl &control, int x,
  *
  * @param g The graphics context to paint with
  * @param control The control to draw
+ * @param state The state the gear item's control is in
  * @param x The x-coordinate for the control
  * @param y The y-coordinate for the control
  */
-void RackSlot::drawButton(juce::Graphics &g, const GearControl &control, int x, int y)
+void RackSlot::drawButton(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y)
 {
     // Calculate base dimensions from the sprite sheet if available
     float baseWidth, baseHeight;
     juce::Image scaledSpriteSheet; // Move declaration to outer scope
+    const auto &frames = control.selector().frames;
 
-    if (control.buttonSpriteSheet.isValid() && control.buttonFrames.size() > 0)
+    if (control.loadedImage.isValid() && frames.size() > 0)
     {
         // Get the original sprite sheet dimensions
-        float originalSpriteWidth = (float)control.buttonSpriteSheet.getWidth();
-        float originalSpriteHeight = (float)control.buttonSpriteSheet.getHeight();
+        float originalSpriteWidth = (float)control.loadedImage.getWidth();
+        float originalSpriteHeight = (float)control.loadedImage.getHeight();
 
         // Scale the sprite sheet dimensions by the faceplate scale
         float scaledSpriteWidth = originalSpriteWidth * currentFaceplateScale;
         float scaledSpriteHeight = originalSpriteHeight * currentFaceplateScale;
 
         // Create a scaled version of the sprite sheet
-        scaledSpriteSheet = control.buttonSpriteSheet.rescaled(
+        scaledSpriteSheet = control.loadedImage.rescaled(
             (int)scaledSpriteWidth,
             (int)scaledSpriteHeight,
             juce::Graphics::ResamplingQuality::highResamplingQuality);
 
         // Use the first frame's dimensions as the base size
-        baseWidth = (float)control.buttonFrames[0].width;
-        baseHeight = (float)control.buttonFrames[0].height;
+        baseWidth = (float)frames[0].width;
+        baseHeight = (float)frames[0].height;
     }
     else
     {
@@ -402,19 +407,19 @@ void RackSlot::drawButton(juce::Graphics &g, const GearControl &control, int x,
     const float buttonHeight = baseHeight * currentFaceplateScale;
 
     // Draw the button using sprite sheet if available
-    if (control.buttonSpriteSheet.isValid() && control.buttonFrames.size() > 0)
+    if (control.loadedImage.isValid() && frames.size() > 0)
     {
         // Use the currentIndex to determine which frame to use
-        int frameIndex = control.currentIndex;
+        int frameIndex = state.currentIndex;
 
         // Ensure frame index is valid
-        if (frameIndex >= control.buttonFrames.size())
+        if (frameIndex >= frames.size())
         {
             frameIndex = 0;
         }
 
         // Get the frame data
-        const auto &frame = control.buttonFrames[frameIndex];
+        const auto &frame = frames[frameIndex];
 
         // Scale the frame coordinates and dimensions by the faceplate scale
         float scaledFrameX = frame.x * currentFaceplateScale;
@@ -442,7 +447,7 @@ void RackSlot::drawButton(juce::Graphics &g, const GearControl &control, int x,
     else
     {
         // Fallback to basic button drawing if no sprite sheet is available
-        g.setColour(control.value > 0.5f ? juce::Colours::red : juce::Colours::darkgrey);
+        g.setColour(state.value > 0.5f ? juce::Colours::red : juce::Colours::darkgrey);
         g.fillRoundedRectangle(x, y, buttonWidth, buttonHeight, 4.0f);
 
         g.setColour(juce::Colours::grey);
@@ -455,20 +460,21 @@ void RackSlot::drawButton(juce::Graphics &g, const GearControl &control, int x,
  *
  * @param g The graphics context to paint with
  * @param control The control to draw
+ * @param state The state the gear item's control is in
  * @param x The x-coordinate for the control
  * @param y The y-coordinate for the control
  */
-void RackSlot::drawFader(juce::Graphics &g, const GearControl &control, int x, int y)
+void RackSlot::drawFader(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y)
 {
-    const bool isVertical = control.orientation == "vertical";
-    const float faderLength = control.length * currentFaceplateScale;
+    const bool isVertical = control.isVertical();
+    const float faderLength = control.fader().length * currentFaceplateScale;
 
     // Calculate base dimensions from the image if available, otherwise use defaults
     float baseWidth, baseHeight;
-    if (control.faderImage.isValid())
+    if (control.loadedImage.isValid())
     {
-        baseWidth = (float)control.faderImage.getWidth();
-        baseHeight = (float)control.faderImage.getHeight();
+        baseWidth = (float)control.loadedImage.getWidth();
+        baseHeight = (float)control.loadedImage.getHeight();
     }
     else
     {
@@ -495,20 +501,20 @@ void RackSlot::drawFader(juce::Graphics &g, const GearControl &control, int x, i
     if (isVertical)
     {
         handleX = x;
-        handleY = y + (1.0f - control.value) * faderLength;
+        handleY = y + (1.0f - state.value) * faderLength;
     }
     else
     {
-        handleX = x + control.value * faderLength;
+        handleX = x + state.value * faderLength;
         handleY = y;
     }
 
     // Draw the fader image at the handle position
-    if (control.faderImage.isValid())
+    if (control.loadedImage.isValid())
     {
         // Scale the handle size based on the image's aspect ratio
-        float imageWidth = (float)control.faderImage.getWidth();
-        float imageHeight = (float)control.faderImage.getHeight();
+        float imageWidth = (float)control.loadedImage.getWidth();
+        float imageHeight = (float)control.loadedImage.getHeight();
         float aspectRatio = imageWidth / imageHeight;
 
         float scaledWidth, scaledHeight;
@@ -524,7 +530,7 @@ void RackSlot::drawFader(juce::Graphics &g, const GearControl &control, int x, i
         }
 
         // Draw the fader image centered at the handle position
-        g.drawImageWithin(control.faderImage,
+        g.drawImageWithin(control.loadedImage,
                           handleX - scaledWidth / 2,
                           handleY - scaledHeight / 2,
                           scaledWidth,
@@ -553,10 +559,11 @@ void RackSlot::drawFader(juce::Graphics &g, const GearControl &control, int x, i
  *
  * @param g The graphics context to paint with
  * @param control The control to draw
+ * @param state The state the gear item's control is in
  * @param x The x-coordinate for the control
  * @param y The y-coordinate for the control
  */
-void RackSlot::drawKnob(juce::Graphics &g, const GearControl &control, int x, int y)
+void RackSlot::drawKnob(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y)
 {
     // Calculate knob size based on faceplate scale factor
     float knobSize;
@@ -586,7 +593,7 @@ void RackSlot::drawKnob(juce::Graphics &g, const GearControl &control, int x, in
 
         // Use the control value directly as degrees, but subtract 180 to align with JUCE's coordinate system
         // where 0 is at 12 o'clock and we want 0 to be at 6 o'clock
-        float angle = control.value - 180.0f;
+        float angle = state.value - 180.0f;
 
         // Translate to the center of the knob
         g.addTransform(juce::AffineTransform::translation(knobBounds.getCentreX(), knobBounds.getCentreY()));
@@ -616,7 +623,7 @@ void RackSlot::drawKnob(juce::Graphics &g, const GearControl &control, int x, in
 
         // Draw position indicator
         g.setColour(juce::Colours::white);
-        float angle = control.value - 180.0f; // Subtract 90 to align with JUCE's coordinate system
+        float angle = state.value - 180.0f; // Subtract 90 to align with JUCE's coordinate system
         float radius = knobBounds.getWidth() * 0.4f;
         float centreX = knobBounds.getCentreX();
         float centreY = knobBounds.getCentreY();
@@ -811,7 +818,7 @@ void RackSlot::moveDown()
  */
 void RackSlot::mouseDown(const juce::MouseEvent &e)
 {
-    if (gearItem == nullptr || !gearItem->faceplateImage.isValid())
+    if (gearItem == nullptr || !gearItem->getFaceplateImage().isValid())
         return;
 
     // Calculate faceplate area
@@ -819,26 +826,28 @@ void RackSlot::mouseDown(const juce::MouseEvent &e)
     faceplateArea.removeFromTop(20); // Remove space for name
 
     // Find control at mouse position
-    activeControl = findControlAtPosition(e.position, faceplateArea);
-    if (activeControl != nullptr)
+    activeControlIndex = findControlAtPosition(e.position, faceplateArea);
+    if (activeControlIndex >= 0)
     {
+        const auto &control = gearItem->controls.getReference(activeControlIndex);
+
         // Calculate control bounds
-        int x = faceplateArea.getX() + (int)(activeControl->position.getX() * faceplateArea.getWidth());
-        int y = faceplateArea.getY() + (int)(activeControl->position.getY() * faceplateArea.getHeight());
+        int x = faceplateArea.getX() + (int)(control.position.getX() * faceplateArea.getWidth());
+        int y = faceplateArea.getY() + (int)(control.position.getY() * faceplateArea.getHeight());
         juce::Rectangle<int> controlBounds(x, y, 40, 40); // Default size, adjust based on control type
 
         // Store drag start state for faders, knobs, and switches
-        if (activeControl->type == GearControl::Type::Fader ||
-            activeControl->type == GearControl::Type::Knob ||
-            activeControl->type == GearControl::Type::Switch)
+        if (control.type == GearControl::Type::Fader ||
+            control.type == GearControl::Type::Knob ||
+            control.type == GearControl::Type::Switch)
         {
             dragStartPos = e.position;
-            dragStartValue = activeControl->value;
+            dragStartValue = gearItem->getControlValue(activeControlIndex);
             isDragging = true;
         }
 
         // Handle interaction based on control type (for click/tap)
-        switch (activeControl->type)
+        switch (control.type)
         {
         case GearControl::Type::Fader:
             // Don't update value on click, wait for drag
@@ -847,21 +856,14 @@ void RackSlot::mouseDown(const juce::MouseEvent &e)
             // Don't update value on click, wait for drag
             break;
         case GearControl::Type::Button:
-            handleButtonInteraction(*activeControl);
+        {
+            auto state = gearItem->getControlState(activeControlIndex);
+            handleButtonInteraction(control, state);
+            gearItem->setControlState(activeControlIndex, state);
             repaint();
-            // Find the control index and notify
-            if (gearItem != nullptr)
-            {
-                for (int i = 0; i < gearItem->controls.size(); ++i)
-                {
-                    if (&gearItem->controls.getReference(i) == activeControl)
-                    {
-                        notifyRackOfControlChanged(i);
-                        break;
-                    }
-                }
-            }
+            notifyRackOfControlChanged(activeControlIndex);
             break;
+        }
         case GearControl::Type::Knob:
             // Don't update value on click, wait for drag
             break;
@@ -879,26 +881,28 @@ void RackSlot::mouseDown(const juce::MouseEvent &e)
  */
 void RackSlot::mouseDrag(const juce::MouseEvent &e)
 {
-    if (!isDragging || activeControl == nullptr)
+    if (!isDragging || gearItem == nullptr || !juce::isPositiveAndBelow(activeControlIndex, gearItem->controls.size()))
     {
         return;
     }
 
+    const auto &control = gearItem->controls.getReference(activeControlIndex);
+
     // Calculate faceplate area
     juce::Rectangle<int> faceplateArea = getLocalBounds().reduced(10);
     faceplateArea.removeFromTop(20); // Remove space for name
 
     // Calculate control bounds
-    int x = faceplateArea.getX() + (int)(activeControl->position.getX() * faceplateArea.getWidth());
-    int y = faceplateArea.getY() + (int)(activeControl->position.getY() * faceplateArea.getHeight());
+    int x = faceplateArea.getX() + (int)(control.position.getX() * faceplateArea.getWidth());
+    int y = faceplateArea.getY() + (int)(control.position.getY() * faceplateArea.getHeight());
 
-    switch (activeControl->type)
+    switch (control.type)
     {
     case GearControl::Type::Switch:
     {
-        const bool isVertical = activeControl->orientation == "vertical";
-        const int numOptions = activeControl->options.size();
-        const float faderLength = activeControl->length * currentFaceplateScale;
+        const bool isVertical = control.isVertical();
+        const int numOptions = control.selector().options.size();
+        const float faderLength = control.fader().length * currentFaceplateScale;
 
         // Calculate the drag distance along the orientation axis
         float dragDistance;
@@ -925,30 +929,18 @@ void RackSlot::mouseDrag(const juce::MouseEvent &e)
         int newIndexInt = juce::roundToInt(newIndex);
 
         // Update the control
-        if (newIndexInt != activeControl->currentIndex)
+        if (newIndexInt != gearItem->getControlCurrentIndex(activeControlIndex))
         {
-            activeControl->currentIndex = newIndexInt;
-            activeControl->value = (float)newIndexInt;
+            gearItem->setControlState(activeControlIndex, {(float)newIndexInt, newIndexInt});
             repaint();
-            // Find the control index and notify
-            if (gearItem != nullptr)
-            {
-                for (int i = 0; i < gearItem->controls.size(); ++i)
-                {
-                    if (&gearItem->controls.getReference(i) == activeControl)
-                    {
-                        notifyRackOfControlChanged(i);
-                        break;
-                    }
-                }
-            }
+            notifyRackOfControlChanged(activeControlIndex);
         }
         break;
     }
     case GearControl::Type::Fader:
     {
-        const bool isVertical = activeControl->orientation == "vertical";
-        const float faderLength = activeControl->length * currentFaceplateScale;
+        const bool isVertical = control.isVertical();
+        const float faderLength = control.fader().length * currentFaceplateScale;
         float newValue;
 
         if (isVertical)
@@ -968,20 +960,9 @@ void RackSlot::mouseDrag(const juce::MouseEvent &e)
             newValue = juce::jlimit(0.0f, 1.0f, normalizedX);
         }
 
-        activeControl->value = newValue;
+        gearItem->setControlValue(activeControlIndex, newValue);
         repaint();
-        // Find the control index and notify
-        if (gearItem != nullptr)
-        {
-            for (int i = 0; i < gearItem->controls.size(); ++i)
-            {
-                if (&gearItem->controls.getReference(i) == activeControl)
-                {
-                    notifyRackOfControlChanged(i);
-                    break;
-                }
-            }
-        }
+        notifyRackOfControlChanged(activeControlIndex);
         break;
     }
     case GearControl::Type::Knob:
@@ -997,16 +978,17 @@ void RackSlot::mouseDrag(const juce::MouseEvent &e)
         float newValue = dragStartValue + deltaAngle;
 
         // Clamp the value between startAngle and endAngle
-        newValue = juce::jlimit(activeControl->startAngle, activeControl->endAngle, newValue);
+        const auto &knob = control.knob();
+        newValue = juce::jlimit(knob.startAngle, knob.endAngle, newValue);
 
         // If this is a stepped knob, snap to the nearest step
-        if (!activeControl->steps.isEmpty())
+        if (!knob.steps.isEmpty())
         {
-            float closestStep = activeControl->steps[0];
+            float closestStep = knob.steps[0];
             float minDistance = std::abs(newValue - closestStep);
 
             // Find the closest step angle
-            for (float step : activeControl->steps)
+            for (float step : knob.steps)
             {
                 float distance = std::abs(newValue - step);
                 if (distance < minDistance)
@@ -1019,39 +1001,21 @@ void RackSlot::mouseDrag(const juce::MouseEvent &e)
             newValue = closestStep;
         }
 
-        activeControl->value = newValue;
+        gearItem->setControlValue(activeControlIndex, newValue);
 
         repaint();
-        // Find the control index and notify
-        if (gearItem != nullptr)
-        {
-            for (int i = 0; i < gearItem->controls.size(); ++i)
-            {
-                if (&gearItem->controls.getReference(i) == activeControl)
-                {
-                    notifyRackOfControlChanged(i);
-                    break;
-                }
-            }
-        }
+        notifyRackOfControlChanged(activeControlIndex);
         break;
     }
     case GearControl::Type::Button:
-        handleButtonInteraction(*activeControl);
+    {
+        auto state = gearItem->getControlState(activeControlIndex);
+        handleButtonInteraction(control, state);
+        gearItem->setControlState(activeControlIndex, state);
         repaint();
-        // Find the control index and notify
-        if (gearItem != nullptr)
-        {
-            for (int i = 0; i < gearItem->controls.size(); ++i)
-            {
-                if (&gearItem->controls.getReference(i) == activeControl)
-                {
-                    notifyRackOfControlChanged(i);
-                    break;
-                }
-            }
-        }
+        notifyRackOfControlChanged(activeControlIndex);
         break;
+    }
     default:
         break; // Other controls don't need drag handling
     }
@@ -1077,12 +1041,12 @@ void RackSlot::mouseUp(const juce::MouseEvent &e)
     {
         isDragging = false;
     }
-    activeControl = nullptr;
+    activeControlIndex = -1;
 }
 
 void RackSlot::resetControlToDefault(const juce::MouseEvent &e)
 {
-    if (gearItem == nullptr || !gearItem->faceplateImage.isValid())
+    if (gearItem == nullptr || !gearItem->getFaceplateImage().isValid())
         return;
 
     // Calculate faceplate area
@@ -1090,26 +1054,11 @@ void RackSlot::resetControlToDefault(const juce::MouseEvent &e)
     faceplateArea.removeFromTop(20); // Remove space for name
 
     // Find control at mouse position
-    if (auto *control = findControlAtPosition(e.position, faceplateArea))
+    const int controlIndex = findControlAtPosition(e.position, faceplateArea);
+    if (controlIndex >= 0)
     {
-        // Reset control to default value
-        switch (control->type)
-        {
-        case GearControl::Type::Switch:
-            control->currentIndex = (int)control->initialValue; // Reset to schema default
-            control->value = control->initialValue;             // Keep value in sync
-            break;
-        case GearControl::Type::Button:
-            control->value = control->initialValue;      // Reset to schema default
-            control->currentIndex = (int)control->value; // Keep currentIndex in sync
-            break;
-        case GearControl::Type::Fader:
-            control->value = control->initialValue; // Reset to schema default
-            break;
-        case GearControl::Type::Knob:
-            control->value = control->initialValue; // Reset to schema default
-            break;
-        }
+        // Reset control to its schema default, with the option that selects
+        gearItem->setControlState(controlIndex, gearItem->controls.getReference(controlIndex).getInitialState());
         repaint();
     }
 }
@@ -1122,15 +1071,18 @@ void RackSlot::resetControlToDefault(const juce::MouseEvent &e)
  *
  * @param position The position to check
  * @param faceplateArea The area where the faceplate is drawn
- * @return Pointer to the control at the position, or nullptr if none found
+ * @return Index of the control at the position, or -1 if none found
  */
-GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position, const juce::Rectangle<int> &faceplateArea)
+int RackSlot::findControlAtPosition(const juce::Point<float> &position, const juce::Rectangle<int> &faceplateArea)
 {
     if (gearItem == nullptr)
-        return nullptr;
+        return -1;
 
-    for (auto &control : gearItem->controls)
+    for (int i = 0; i < gearItem->controls.size(); ++i)
     {
+        const auto &control = gearItem->controls.getReference(i);
+        const auto state = gearItem->getControlState(i);
+
         // Calculate control bounds
         int x = faceplateArea.getX() + (int)(control.position.getX() * faceplateArea.getWidth());
         int y = faceplateArea.getY() + (int)(control.position.getY() * faceplateArea.getHeight());
@@ -1142,14 +1094,15 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
         {
         case GearControl::Type::Switch:
         {
-            if (control.switchSpriteSheet.isValid() && control.switchFrames.size() > 0)
+            const auto &frames = control.selector().frames;
+            if (control.loadedImage.isValid() && frames.size() > 0)
             {
                 // Use sprite frame dimensions (same as drawing)
-                int currentIndex = control.currentIndex;
-                if (currentIndex >= control.switchFrames.size())
+                int currentIndex = state.currentIndex;
+                if (currentIndex >= frames.size())
                     currentIndex = 0;
 
-                const auto &frame = control.switchFrames[currentIndex];
+                const auto &frame = frames[currentIndex];
                 float scaledFrameWidth = frame.width * currentFaceplateScale;
                 float scaledFrameHeight = frame.height * currentFaceplateScale;
                 controlBounds = juce::Rectangle<float>(x, y, scaledFrameWidth, scaledFrameHeight);
@@ -1166,14 +1119,15 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
 
         case GearControl::Type::Button:
         {
-            if (control.buttonSpriteSheet.isValid() && control.buttonFrames.size() > 0)
+            const auto &frames = control.selector().frames;
+            if (control.loadedImage.isValid() && frames.size() > 0)
             {
                 // Use sprite frame dimensions (same as drawing)
-                int frameIndex = control.currentIndex;
-                if (frameIndex >= control.buttonFrames.size())
+                int frameIndex = state.currentIndex;
+                if (frameIndex >= frames.size())
                     frameIndex = 0;
 
-                const auto &frame = control.buttonFrames[frameIndex];
+                const auto &frame = frames[frameIndex];
                 float scaledFrameWidth = frame.width * currentFaceplateScale;
                 float scaledFrameHeight = frame.height * currentFaceplateScale;
                 controlBounds = juce::Rectangle<float>(x, y, scaledFrameWidth, scaledFrameHeight);
@@ -1191,8 +1145,8 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
         case GearControl::Type::Fader:
         {
             // Use the same handle calculation logic as drawing
-            const bool isVertical = control.orientation == "vertical";
-            const float faderLength = control.length * currentFaceplateScale;
+            const bool isVertical = control.isVertical();
+            const float faderLength = control.fader().length * currentFaceplateScale;
             const float faderWidth = 20.0f * currentFaceplateScale;
             const float handleSize = 10.0f * currentFaceplateScale;
 
@@ -1201,11 +1155,11 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
             if (isVertical)
             {
                 handleX = x;
-                handleY = y + (1.0f - control.value) * faderLength;
+                handleY = y + (1.0f - state.value) * faderLength;
             }
             else
             {
-                handleX = x + control.value * faderLength;
+                handleX = x + state.value * faderLength;
                 handleY = y;
             }
 
@@ -1246,10 +1200,10 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
 
         // Check if position is within the actual rendered bounds
         if (controlBounds.contains(position))
-            return &control;
+            return i;
     }
 
-    return nullptr;
+    return -1;
 }
 
 /**
@@ -1258,12 +1212,13 @@ GearControl *RackSlot::findControlAtPosition(const juce::Point<float> &position,
  * Updates the switch's state when interacted with.
  *
  * @param control The switch control to handle
+ * @param state The gear item's state of the control, updated in place
  */
-void RackSlot::handleSwitchInteraction(GearControl &control)
+void RackSlot::handleSwitchInteraction(const GearControl &control, GearControl::State &state)
 {
     // Toggle between options
-    control.currentIndex = (control.currentIndex + 1) % control.options.size();
-    control.value = (float)control.currentIndex; // Simply use the index as the value
+    state.currentIndex = (state.currentIndex + 1) % control.selector().options.size();
+    state.value = (float)state.currentIndex; // Simply use the index as the value
 }
 
 /**
@@ -1273,20 +1228,21 @@ void RackSlot::handleSwitchInteraction(GearControl &control)
  * and latching button types.
  *
  * @param control The button control to handle
+ * @param state The gear item's state of the control, updated in place
  */
-void RackSlot::handleButtonInteraction(GearControl &control)
+void RackSlot::handleButtonInteraction(const GearControl &control, GearControl::State &state)
 {
     if (control.momentary)
     {
         // For momentary buttons, use value 1.0 for "on" state (index 1) and 0.0 for "off" state (index 0)
-        control.value = control.value > 0.5f ? 0.0f : 1.0f;
-        control.currentIndex = (int)control.value;
+        state.value = state.value > 0.5f ? 0.0f : 1.0f;
+        state.currentIndex = (int)state.value;
     }
     else
     {
         // For latching buttons, cycle through options like switches
-        control.currentIndex = (control.currentIndex + 1) % control.options.size();
-        control.value = (float)control.currentIndex;
+        state.currentIndex = (state.currentIndex + 1) % control.selector().options.size();
+        state.value = (float)state.currentIndex;
     }
 }
 
@@ -1295,15 +1251,15 @@ void RackSlot::handleButtonInteraction(GearControl &control)
  *
  * Updates the fader's value based on mouse position.
  *
- * @param control The fader control to handle
+ * @param state The gear item's state of the fader, updated in place
  * @param mousePos The current mouse position
  * @param controlBounds The bounds of the control
  */
-void RackSlot::handleFaderInteraction(GearControl &control, const juce::Point<float> &mousePos, const juce::Rectangle<int> &controlBounds)
+void RackSlot::handleFaderInteraction(GearControl::State &state, const juce::Point<float> &mousePos, const juce::Rectangle<int> &controlBounds)
 {
     // Map vertical position to value
     float normalizedY = 1.0f - (float)(mousePos.y - controlBounds.getY()) / controlBounds.getHeight();
-    control.value = juce::jlimit(0.0f, 1.0f, normalizedY);
+    state.value = juce::jlimit(0.0f, 1.0f, normalizedY);
 }
 
 /**
@@ -155,6 +155,9 @@ public:
     /**
      * @brief Sets a new gear item in the slot.
      *
+     * The slot only refers to the item. Items placed in a rack are owned by
+     * the rack, which reclaims them once no slot holds them.
+     *
      * @param newGearItem Pointer to the new gear item to set
      */
     void setGearItem(GearItem *newGearItem);
@@ -241,40 +244,44 @@ private:
      *
      * @param g The graphics context to paint with
      * @param control The control to draw
+     * @param state The state the gear item's control is in
      * @param x The x-coordinate for the control
      * @param y The y-coordinate for the control
      */
-    void drawSwitch(juce::Graphics &g, const GearControl &control, int x, int y);
+    void drawSwitch(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y);
 
     /**
      * @brief Draws a button control.
      *
      * @param g The graphics context to paint with
      * @param control The control to draw
+     * @param state The state the gear item's control is in
      * @param x The x-coordinate for the control
      * @param y The y-coordinate for the control
      */
-    void drawButton(juce::Graphics &g, const GearControl &control, int x, int y);
+    void drawButton(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y);
 
     /**
      * @brief Draws a fader control.
      *
      * @param g The graphics context to paint with
      * @param control The control to draw
+     * @param state The state the gear item's control is in
      * @param x The x-coordinate for the control
      * @param y The y-coordinate for the control
      */
-    void drawFader(juce::Graphics &g, const GearControl &control, int x, int y);
+    void drawFader(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y);
 
     /**
      * @brief Draws a knob control.
      *
      * @param g The graphics context to paint with
      * @param control The control to draw
+     * @param state The state the gear item's control is in
      * @param x The x-coordinate for the control
      * @param y The y-coordinate for the control
      */
-    void drawKnob(juce::Graphics &g, const GearControl &control, int x, int y);
+    void drawKnob(juce::Graphics &g, const GearControl &control, const GearControl::State &state, int x, int y);
 
     // Helper methods for control interaction
     /**
@@ -282,9 +289,9 @@ private:
      *
      * @param position The position to check
      * @param faceplateArea The area where the faceplate is drawn
-     * @return Pointer to the control at the position, or nullptr if none found
+     * @return Index of the control at the position, or -1 if none found
      */
-    GearControl *findControlAtPosition(const juce::Point<float> &position, const juce::Rectangle<int> &faceplateArea);
+    int findControlAtPosition(const juce::Point<float> &position, const juce::Rectangle<int> &faceplateArea);
 
     /**
      * @brief Resets a control to its default value.
@@ -297,24 +304,26 @@ private:
      * @brief Handles interaction with a switch control.
      *
      * @param control The switch control to handle
+     * @param state The gear item's state of the control, updated in place
      */
-    void handleSwitchInteraction(GearControl &control);
+    void handleSwitchInteraction(const GearControl &control, GearControl::State &state);
 
     /**
      * @brief Handles interaction with a button control.
      *
      * @param control The button control to handle
+     * @param state The gear item's state of the control, updated in place
      */
-    void handleButtonInteraction(GearControl &control);
+    void handleButtonInteraction(const GearControl &control, GearControl::State &state);
 
     /**
      * @brief Handles interaction with a fader control.
      *
-     * @param control The fader control to handle
+     * @param state The gear item's state of the fader, updated in place
      * @param mousePos The current mouse position
      * @param controlBounds The bounds of the control
      */
-    void handleFaderInteraction(GearControl &control, const juce::Point<float> &mousePos, const juce::Rectangle<int> &controlBounds);
+    void handleFaderInteraction(GearControl::State &state, const juce::Point<float> &mousePos, const juce::Rectangle<int> &controlBounds);
 
     // Helper method to find parent Rack
     /**
@@ -325,12 +334,12 @@ private:
     juce::Component *findParentRackComponent() const;
 
     int index;                            ///< The slot's position in the rack
-    GearItem *gearItem = nullptr;         ///< The gear item in this slot, if any
+    GearItem *gearItem = nullptr;         ///< The gear item in this slot, if any; not owned
     bool highlighted;                     ///< Whether this slot is highlighted
     bool isDragging;                      ///< Whether a drag operation is in progress
     float dragStartValue = 0.0f;          ///< Control value at drag start
     juce::Point<float> dragStartPos;      ///< Mouse position at drag start
-    GearControl *activeControl = nullptr; ///< Currently active control being manipulated
+    int activeControlIndex = -1;          ///< Index of the control being manipulated, or -1 if none
     float currentFaceplateScale = 1.0f;   ///< Current scale factor for faceplate rendering
 
     // Up/down movement buttons
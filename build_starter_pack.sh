@@ -0,0 +1,72 @@
+#!/bin/bash
+
+# Refreshes Resources/starter_pack from the schemas repository. The build
+# zips that directory into the plugin, so commit the result.
+#
+# Usage: ./build_starter_pack.sh [unitId ...]
+# Without unit IDs, every unit in the current starter index is refreshed.
+
+# Exit on error
+set -e
+
+BASE_URL="${ANALOGIQ_SCHEMAS_URL:-https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/}"
+PACK_DIR="Resources/starter_pack"
+
+if [ $# -gt 0 ]; then
+    UNITS="$*"
+else
+    UNITS=$(python3 -c 'import json, sys; print(" ".join(u["unitId"] for u in json.load(open(sys.argv[1]))["units"]))' \
+        "$PACK_DIR/units/index.json")
+fi
+
+# Download a path relative to the base URL into the pack, keeping its layout
+fetch() {
+    mkdir -p "$PACK_DIR/$(dirname "$1")"
+    curl -fsSL "${BASE_URL}$1" -o "$PACK_DIR/$1"
+}
+
+REMOTE_INDEX=$(mktemp)
+trap 'rm -f "$REMOTE_INDEX"' EXIT
+curl -fsSL "${BASE_URL}units/index.json" -o "$REMOTE_INDEX"
+
+# Keep only the starter units in the bundled index
+python3 - "$REMOTE_INDEX" "$PACK_DIR/units/index.json" $UNITS <<'PYTHON'
+import json, sys
+remote, target, units = sys.argv[1], sys.argv[2], sys.argv[3:]
+index = json.load(open(remote))
+index["units"] = [u for u in index["units"] if u["unitId"] in units]
+missing = set(units) - {u["unitId"] for u in index["units"]}
+if missing:
+    sys.exit("Not in the remote index: " + ", ".join(sorted(missing)))
+json.dump(index, open(target, "w"), indent=4)
+PYTHON
+
+# Each unit's schema and thumbnail, then every asset its schema refers to
+for path in $(python3 -c 'import json, sys; [print(u[k]) for u in json.load(open(sys.argv[1]))["units"] for k in ("schemaPath", "thumbnailImage") if u.get(k)]' \
+        "$PACK_DIR/units/index.json"); do
+    echo "Fetching $path"
+    fetch "$path"
+
+    if [[ "$path" == *.json ]]; then
+        for asset in $(python3 - "$PACK_DIR/$path" <<'PYTHON'
+import json, sys
+def walk(value):
+    if isinstance(value, dict):
+        for item in value.values():
+            yield from walk(item)
+    elif isinstance(value, list):
+        for item in value:
+            yield from walk(item)
+    elif isinstance(value, str) and value.startswith("assets/"):
+        yield value
+for asset in sorted(set(walk(json.load(open(sys.argv[1]))))):
+    print(asset)
+PYTHON
+        ); do
+            echo "Fetching $asset"
+            fetch "$asset"
+        done
+    fi
+done
+
+echo "Starter pack refreshed in $PACK_DIR"
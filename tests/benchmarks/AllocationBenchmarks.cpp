@@ -0,0 +1,162 @@
+/**
+ * @file AllocationBenchmarks.cpp
+ * @brief Benchmark counting the allocations made while loading a rack.
+ *
+ * This file replaces the allocator for the whole benchmark executable, which
+ * is why it is kept out of the unit test runner. On glibc every malloc,
+ * calloc and realloc is counted, which covers operator new as well as the
+ * malloc-backed buffers of juce::Array; elsewhere only operator new is.
+ */
+
+#include <JuceHeader.h>
+#include "Rack.h"
+#include "GearItem.h"
+#include "TestFixture.h"
+#include "TestHelpers.h"
+#include "MockNetworkFetcher.h"
+#include "MockFileSystem.h"
+#include "PresetManager.h"
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+    // Per thread, so work on other threads does not disturb the counts
+    thread_local juce::int64 allocationCalls = 0;
+}
+
+#if defined(__GLIBC__)
+extern "C"
+{
+    void *__libc_malloc(std::size_t size);
+    void *__libc_calloc(std::size_t count, std::size_t size);
+    void *__libc_realloc(void *memory, std::size_t size);
+    void __libc_free(void *memory);
+
+    // glibc expects malloc, calloc, realloc and free to be replaced together
+
+    void *malloc(std::size_t size)
+    {
+        ++allocationCalls;
+        return __libc_malloc(size);
+    }
+
+    void *calloc(std::size_t count, std::size_t size)
+    {
+        ++allocationCalls;
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *memory, std::size_t size)
+    {
+        ++allocationCalls;
+        return __libc_realloc(memory, size);
+    }
+
+    void free(void *memory)
+    {
+        __libc_free(memory);
+    }
+}
+
+static const char *const allocationsCounted = "malloc, calloc and realloc calls";
+#else
+void *operator new(std::size_t size)
+{
+    ++allocationCalls;
+
+    if (auto *memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+static const char *const allocationsCounted = "operator new calls";
+#endif
+
+/**
+ * @brief Benchmark counting the allocations made while loading a rack.
+ */
+class AllocationBenchmarks : public juce::UnitTest
+{
+public:
+    AllocationBenchmarks() : UnitTest("AllocationBenchmarks") {}
+
+    void runTest() override
+    {
+        TestFixture fixture;
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFetcher.reset();
+        mockFileSystem.reset();
+
+        CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+        PresetManager presetManager(mockFileSystem, cacheManager);
+
+        beginTest("Benchmark: Allocations Per Rack Load");
+        {
+            constexpr int numControls = 16;
+            cacheManager.saveUnitToCache("bench-unit", createSchema("bench-unit", numControls));
+
+            std::vector<std::unique_ptr<GearItem>> items;
+            Rack rack(mockFetcher, mockFileSystem, cacheManager, presetManager, nullptr);
+            const int numSlots = rack.getNumSlots();
+
+            juce::Array<juce::int64> allocations;
+            auto start = juce::Time::getMillisecondCounterHiRes();
+
+            for (int i = 0; i < numSlots; ++i)
+            {
+                const auto before = allocationCalls;
+
+                // As a preset load does: place the unit, load its schema, then restore the saved values
+                items.push_back(std::make_unique<GearItem>(createItem("bench-unit", 0, mockFetcher, mockFileSystem, cacheManager)));
+                auto *item = items.back().get();
+                rack.getSlot(i)->setGearItem(item);
+
+                juce::Array<int> savedIndices;
+                for (int c = 0; c < numControls; ++c)
+                    savedIndices.add(c % 2);
+
+                rack.fetchSchemaForGearItem(item, [item, savedIndices = std::move(savedIndices)]()
+                                            {
+                    for (int c = 0; c < savedIndices.size() && c < item->controls.size(); ++c)
+                        item->setControlCurrentIndex(c, savedIndices[c]); });
+
+                allocations.add(allocationCalls - before);
+            }
+
+            auto loadMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            juce::int64 laterTotal = 0;
+            for (int i = 1; i < allocations.size(); ++i)
+                laterTotal += allocations[i];
+            const auto laterAverage = (double)laterTotal / (double)(numSlots - 1);
+
+            expectEquals(rack.getNumDefinitions(), 1);
+            expectEquals(items.back()->controls.size(), numControls, "Every instance should get the schema's controls");
+            expectEquals(items.back()->getControlCurrentIndex(1), 1, "Saved values should be restored");
+            expect(laterAverage < (double)allocations[0], "Later instances should reuse the loaded definition");
+
+            logMessage(juce::String(numSlots) + " slots of " + juce::String(numControls) + " controls, counting "
+                       + allocationsCounted + ": first instance " + juce::String(allocations[0]) + ", later instances "
+                       + juce::String(laterAverage, 1) + " on average, " + juce::String(loadMs, 2) + " ms in total");
+
+            for (int i = 0; i < numSlots; ++i)
+                rack.getSlot(i)->clearGearItem();
+        }
+    }
+};
+
+static AllocationBenchmarks allocationBenchmarks;
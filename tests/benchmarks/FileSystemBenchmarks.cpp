@@ -0,0 +1,66 @@
+/**
+ * @file FileSystemBenchmarks.cpp
+ * @brief Benchmark reporting the syscalls the FileSystem metadata cache saves.
+ *
+ * This file runs a save-like loop of existence checks against a scratch
+ * directory under the system temp folder, with and without the cache. The
+ * numbers are logged rather than checked.
+ */
+
+#include <JuceHeader.h>
+#include "FileSystem.h"
+
+/**
+ * @brief Benchmark reporting the syscalls the FileSystem metadata cache saves.
+ */
+class FileSystemBenchmarks : public juce::UnitTest
+{
+public:
+    FileSystemBenchmarks() : UnitTest("FileSystemBenchmarks") {}
+
+    void runTest() override
+    {
+        juce::File scratchDir = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                    .getNonexistentChildFile("AnalogIQFileSystemBenchmarks", "");
+        scratchDir.createDirectory();
+
+        const juce::String dirPath = scratchDir.getChildFile("assets").getFullPathName();
+        const juce::String jpgPath = scratchDir.getChildFile("assets").getChildFile("thumb.jpg").getFullPathName();
+        const juce::String missingPath = scratchDir.getChildFile("missing.jpg").getFullPathName();
+
+        beginTest("Benchmark: Syscalls Saved");
+        {
+            // Mirrors a save loop: directory check before each write plus a thumbnail check
+            constexpr int iterations = 2000;
+
+            auto runLoop = [&](FileSystem &fileSystem)
+            {
+                fileSystem.writeFile(jpgPath, juce::String("not really a jpeg"));
+                auto start = juce::Time::getMillisecondCounterHiRes();
+                for (int i = 0; i < iterations; ++i)
+                {
+                    fileSystem.directoryExists(dirPath);
+                    fileSystem.fileExists(jpgPath);
+                    fileSystem.fileExists(missingPath);
+                }
+                return juce::Time::getMillisecondCounterHiRes() - start;
+            };
+
+            FileSystem uncached;
+            FileSystem cached(FileSystem::DEFAULT_METADATA_CACHE_TTL_MS);
+
+            auto uncachedMs = runLoop(uncached);
+            auto cachedMs = runLoop(cached);
+            auto stats = cached.getMetadataCacheStats();
+
+            logMessage("FileSystem metadata cache: " + juce::String(iterations * 3) + " checks, " +
+                       juce::String(stats.hits) + " hits, " + juce::String(stats.misses) + " misses, " +
+                       juce::String(stats.syscallsSaved) + " syscalls saved; " +
+                       juce::String(uncachedMs, 2) + " ms uncached vs " + juce::String(cachedMs, 2) + " ms cached");
+        }
+
+        scratchDir.deleteRecursively();
+    }
+};
+
+static FileSystemBenchmarks fileSystemBenchmarks;
@@ -0,0 +1,110 @@
+/**
+ * @file GearCatalogueParserBenchmarks.cpp
+ * @brief Benchmarks comparing the streaming index parser with a DOM parse.
+ *
+ * This file measures the time and peak heap of parsing a large synthetic
+ * index both ways. The numbers are logged rather than checked, since they
+ * depend on the machine and the allocator.
+ */
+
+#include <JuceHeader.h>
+#include "GearCatalogueParser.h"
+#include "TestHelpers.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define ANALOGIQ_HAS_MALLINFO2 1
+#endif
+
+/**
+ * @brief Benchmarks comparing the streaming index parser with a DOM parse.
+ */
+class GearCatalogueParserBenchmarks : public juce::UnitTest
+{
+public:
+    GearCatalogueParserBenchmarks() : UnitTest("GearCatalogueParserBenchmarks") {}
+
+    void runTest() override
+    {
+        constexpr int unitCount = 10000;
+        const auto jsonData = createSyntheticIndex(unitCount);
+
+        beginTest("Benchmark: Parsing 10k Units");
+        {
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            auto parsedJson = juce::JSON::parse(jsonData);
+            int domUnits = 0;
+            if (auto *units = parsedJson["units"].getArray())
+            {
+                for (const auto &unit : *units)
+                {
+                    GearCatalogueRecord record;
+                    record.unitId = unit["unitId"].toString();
+                    record.name = unit["name"].toString();
+                    record.manufacturer = unit["manufacturer"].toString();
+                    record.category = unit["category"].toString();
+                    if (auto *tags = unit["tags"].getArray())
+                        for (const auto &tag : *tags)
+                            record.tags.add(tag.toString());
+                    ++domUnits;
+                }
+            }
+            auto domMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            start = juce::Time::getMillisecondCounterHiRes();
+            int streamedUnits = 0;
+            GearCatalogueParser::parse(jsonData, [&streamedUnits](GearCatalogueRecord &&)
+                                       { ++streamedUnits; });
+            auto streamMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            logMessage("Index with " + juce::String(unitCount) + " units (" + juce::String(jsonData.getNumBytesAsUTF8() / 1024) +
+                       " KB): DOM parse of " + juce::String(domUnits) + " units " + juce::String(domMs, 1) +
+                       " ms, streaming parse of " + juce::String(streamedUnits) + " units " + juce::String(streamMs, 1) + " ms");
+        }
+
+        beginTest("Benchmark: Peak Memory Parsing 10k Units");
+        {
+            if (getHeapBytesInUse() < 0)
+            {
+                logMessage("Peak parse memory not measured: heap statistics are unavailable on this platform");
+            }
+            else
+            {
+                // The DOM holds the whole tree at once, so its peak is right after parsing
+                auto baseline = getHeapBytesInUse();
+                juce::int64 domPeak = 0;
+                {
+                    auto parsedJson = juce::JSON::parse(jsonData);
+                    domPeak = getHeapBytesInUse() - baseline;
+                }
+
+                // The streaming parse holds one record at a time, so sample as each one arrives
+                baseline = getHeapBytesInUse();
+                juce::int64 streamPeak = 0;
+                GearCatalogueParser::parse(jsonData, [&](GearCatalogueRecord &&)
+                                           { streamPeak = juce::jmax(streamPeak, getHeapBytesInUse() - baseline); });
+
+                logMessage("Peak heap parsing " + juce::String(unitCount) + " units: DOM " +
+                           juce::File::descriptionOfSizeInBytes(domPeak) + ", streaming " +
+                           juce::File::descriptionOfSizeInBytes(streamPeak));
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Gets the bytes the allocator has handed out and not had back.
+     *
+     * @return The bytes in use, or -1 if the platform does not report them
+     */
+    static juce::int64 getHeapBytesInUse()
+    {
+#if ANALOGIQ_HAS_MALLINFO2
+        return (juce::int64)mallinfo2().uordblks;
+#else
+        return -1;
+#endif
+    }
+};
+
+static GearCatalogueParserBenchmarks gearCatalogueParserBenchmarks;
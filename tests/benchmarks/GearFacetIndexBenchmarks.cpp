@@ -0,0 +1,60 @@
+/**
+ * @file GearFacetIndexBenchmarks.cpp
+ * @brief Benchmark timing a facet filter with counts over a large catalogue.
+ *
+ * The time per filter is logged rather than checked; GearFacetIndexTests
+ * checks the filter against a scan.
+ */
+
+#include <JuceHeader.h>
+#include "GearFacetIndex.h"
+
+/**
+ * @brief Benchmark timing a facet filter with counts over a large catalogue.
+ */
+class GearFacetIndexBenchmarks : public juce::UnitTest
+{
+public:
+    GearFacetIndexBenchmarks() : UnitTest("GearFacetIndexBenchmarks") {}
+
+    void runTest() override
+    {
+        using Facet = GearFacetIndex::Facet;
+
+        beginTest("Benchmark: Filtering 10k Units");
+        {
+            const juce::StringArray manufacturers{"Universal Audio", "Neve", "API", "SSL", "Teletronix", "Pultec", "Empirical Labs", "Tube-Tech"};
+            const juce::StringArray categories{"compressor", "equalizer", "preamp", "other"};
+            const juce::StringArray types{"500Series", "Rack19Inch"};
+
+            GearFacetIndex large;
+            constexpr int unitCount = 10000;
+            for (int i = 0; i < unitCount; ++i)
+            {
+                auto entry = large.addEntry();
+                large.addValue(entry, Facet::Manufacturer, manufacturers[i % manufacturers.size()]);
+                large.addValue(entry, Facet::Category, categories[i % categories.size()]);
+                large.addValue(entry, Facet::Type, types[i % types.size()]);
+                large.addValue(entry, Facet::SlotSize, juce::String(1 + i % 3));
+                large.addValue(entry, Facet::Tag, "series-" + juce::String(i % 50));
+            }
+
+            GearFacetIndex::Filter filter;
+            filter.setValues(Facet::Type, {"500Series"});
+            filter.setValues(Facet::Category, {"compressor"});
+            filter.setValues(Facet::Manufacturer, {"Universal Audio", "API"});
+
+            constexpr int iterations = 100;
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            int numMatches = 0;
+            for (int i = 0; i < iterations; ++i)
+                numMatches = large.filter(filter).numMatches;
+            auto filterMs = (juce::Time::getMillisecondCounterHiRes() - start) / iterations;
+
+            logMessage("Facet filter with counts over " + juce::String(unitCount) + " units: " + juce::String(filterMs, 3) +
+                       " ms, " + juce::String(numMatches) + " matches");
+        }
+    }
+};
+
+static GearFacetIndexBenchmarks gearFacetIndexBenchmarks;
@@ -0,0 +1,152 @@
+/**
+ * @file GearLibraryBenchmarks.cpp
+ * @brief Benchmarks for loading, searching and browsing a large catalogue in the gear library.
+ *
+ * This file times the library against a synthetic 10k-unit index served by
+ * the mock network fetcher. The numbers are logged rather than checked.
+ */
+
+#include <JuceHeader.h>
+#include "GearLibrary.h"
+#include "TestFixture.h"
+#include "TestHelpers.h"
+#include "MockNetworkFetcher.h"
+#include "MockFileSystem.h"
+#include "PresetManager.h"
+
+/**
+ * @brief Benchmarks for loading, searching and browsing a large catalogue in the gear library.
+ */
+class GearLibraryBenchmarks : public juce::UnitTest
+{
+public:
+    GearLibraryBenchmarks() : UnitTest("GearLibraryBenchmarks") {}
+
+    void runTest() override
+    {
+        TestFixture fixture;
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFetcher.reset();
+        mockFileSystem.reset();
+
+        CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+        PresetManager presetManager(mockFileSystem, cacheManager);
+
+        constexpr int unitCount = 10000;
+        mockFetcher.setResponse("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+                                createSyntheticCatalogue(unitCount));
+
+        beginTest("Benchmark: Loading 10k Units");
+        {
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            library.loadLibraryAsync();
+            auto startLoadMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            start = juce::Time::getMillisecondCounterHiRes();
+            library.waitForLibraryLoad(30000);
+            auto waitMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            GearLibrary syncLibrary(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            start = juce::Time::getMillisecondCounterHiRes();
+            syncLibrary.loadLibrary();
+            auto syncMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            logMessage("Loading " + juce::String(syncLibrary.getCatalogue().size()) + " units: blocking load " + juce::String(syncMs, 1) +
+                       " ms on the message thread, background load returns in " + juce::String(startLoadMs, 3) +
+                       " ms and completes after " + juce::String(waitMs, 1) + " ms");
+        }
+
+        beginTest("Benchmark: Unit ID Lookups Over 10k Units");
+        {
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            // Restoring a full rack looks every slot up by unit ID
+            juce::StringArray unitIds;
+            for (int i = 0; i < 1000; ++i)
+                unitIds.add("synthetic-" + juce::String((i * 7919) % unitCount));
+
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            int found = 0;
+            for (const auto &unitId : unitIds)
+                found += library.getItemIndexByUnitId(unitId) >= 0 ? 1 : 0;
+            auto lookupMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            logMessage(juce::String(unitIds.size()) + " unit ID lookups over " + juce::String(library.getCatalogue().size()) +
+                       " units: " + juce::String(lookupMs, 3) + " ms, " + juce::String(found) + " found");
+        }
+
+        beginTest("Benchmark: Search Over 10k Units");
+        {
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            // Every prefix of a typed query, as searchBox.onTextChange sees it
+            const juce::String typedQuery = "1176 rev 8";
+            juce::StringArray keystrokes;
+            for (int length = 1; length <= typedQuery.length(); ++length)
+                keystrokes.add(typedQuery.substring(0, length));
+
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            int baselineMatches = 0;
+            for (const auto &keystroke : keystrokes)
+                baselineMatches += scanWithoutSearchKeys(library.getCatalogue(), keystroke).size();
+            auto baselineMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            start = juce::Time::getMillisecondCounterHiRes();
+            int keyedMatches = 0;
+            for (const auto &keystroke : keystrokes)
+                keyedMatches += library.findMatchingItems(keystroke).size();
+            auto keyedMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+            logMessage("Search over " + juce::String(library.getCatalogue().size()) + " units, " + juce::String(keystrokes.size()) +
+                       " keystrokes: " + juce::String(baselineMs, 2) + " ms normalising per item (" + juce::String(baselineMatches) +
+                       " matches) vs " + juce::String(keyedMs, 2) + " ms with precomputed keys (" + juce::String(keyedMatches) + " matches)");
+        }
+
+        beginTest("Benchmark: Opening Tree Groups Over 10k Units");
+        {
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            GearTreeItem *categoriesNode = nullptr;
+            if (auto *root = library.getRootTreeItem())
+                for (int i = 0; i < root->getNumSubItems(); ++i)
+                    if (auto *item = dynamic_cast<GearTreeItem *>(root->getSubItem(i)))
+                        if (item->getItemText() == "Categories")
+                            categoriesNode = item;
+
+            if (categoriesNode == nullptr)
+            {
+                logMessage("Tree not timed: the library has no Categories section");
+            }
+            else
+            {
+                auto start = juce::Time::getMillisecondCounterHiRes();
+                categoriesNode->setOpen(true);
+                auto openCategoriesMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+                double openCategoryMs = 0.0;
+                int numRows = 0;
+                if (auto *category = categoriesNode->getSubItem(0))
+                {
+                    start = juce::Time::getMillisecondCounterHiRes();
+                    category->setOpen(true);
+                    openCategoryMs = juce::Time::getMillisecondCounterHiRes() - start;
+                    numRows = category->getNumSubItems();
+                    category->setOpen(false);
+                }
+
+                logMessage("Tree over " + juce::String(library.getCatalogue().size()) + " units: opening Categories " +
+                           juce::String(openCategoriesMs, 2) + " ms, opening one category of " + juce::String(numRows) +
+                           " rows " + juce::String(openCategoryMs, 2) + " ms");
+            }
+        }
+
+        mockFetcher.reset();
+    }
+};
+
+static GearLibraryBenchmarks gearLibraryBenchmarks;
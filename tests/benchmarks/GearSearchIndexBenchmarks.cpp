@@ -0,0 +1,65 @@
+/**
+ * @file GearSearchIndexBenchmarks.cpp
+ * @brief Benchmark comparing trigram index lookups with a substring scan.
+ *
+ * The numbers are logged rather than checked; GearSearchIndexTests checks
+ * that the index and the scan agree.
+ */
+
+#include <JuceHeader.h>
+#include "GearSearchIndex.h"
+
+/**
+ * @brief Benchmark comparing trigram index lookups with a substring scan.
+ */
+class GearSearchIndexBenchmarks : public juce::UnitTest
+{
+public:
+    GearSearchIndexBenchmarks() : UnitTest("GearSearchIndexBenchmarks") {}
+
+    void runTest() override
+    {
+        beginTest("Benchmark: Selective Queries");
+        {
+            const int numEntries = 50000;
+
+            GearSearchIndex index;
+            index.reserve(numEntries);
+            juce::StringArray keys;
+            for (int i = 0; i < numEntries; ++i)
+            {
+                juce::String key;
+                key << "model" << i << "\nmaker" << (i % 97) << "\ncategory" << (i % 7);
+                keys.add(key);
+                index.addEntry(key);
+            }
+
+            const juce::StringArray queries{"model4242", "maker13", "model1234", "49999"};
+            const int rounds = 20;
+
+            int scanMatches = 0;
+            auto scanStart = juce::Time::getHighResolutionTicks();
+            for (int round = 0; round < rounds; ++round)
+                for (const auto &query : queries)
+                    for (int i = 0; i < keys.size(); ++i)
+                        if (keys[i].contains(query))
+                            ++scanMatches;
+            auto scanTicks = juce::Time::getHighResolutionTicks() - scanStart;
+
+            int indexMatches = 0;
+            auto indexStart = juce::Time::getHighResolutionTicks();
+            for (int round = 0; round < rounds; ++round)
+                for (const auto &query : queries)
+                    indexMatches += index.find(query).size();
+            auto indexTicks = juce::Time::getHighResolutionTicks() - indexStart;
+
+            logMessage("Trigram index over " + juce::String(numEntries) + " entries: scan " +
+                       juce::String(juce::Time::highResolutionTicksToSeconds(scanTicks) * 1000.0, 2) + " ms (" +
+                       juce::String(scanMatches) + " matches), index " +
+                       juce::String(juce::Time::highResolutionTicksToSeconds(indexTicks) * 1000.0, 2) + " ms (" +
+                       juce::String(indexMatches) + " matches)");
+        }
+    }
+};
+
+static GearSearchIndexBenchmarks gearSearchIndexBenchmarks;
@@ -0,0 +1,54 @@
+/**
+ * @file GearSearchRankerBenchmarks.cpp
+ * @brief Benchmark timing ranked fuzzy search as a query is typed.
+ *
+ * The time per keystroke is logged rather than checked.
+ */
+
+#include <JuceHeader.h>
+#include "GearSearchRanker.h"
+
+/**
+ * @brief Benchmark timing ranked fuzzy search as a query is typed.
+ */
+class GearSearchRankerBenchmarks : public juce::UnitTest
+{
+public:
+    GearSearchRankerBenchmarks() : UnitTest("GearSearchRankerBenchmarks") {}
+
+    void runTest() override
+    {
+        beginTest("Benchmark: Fuzzy Ranking Over 5k Units");
+        {
+            const juce::StringArray models{"1176", "la2a", "distressor", "pultec", "neve", "ssl", "fairchild", "vari mu"};
+            const juce::StringArray makers{"universal audio", "teletronix", "empirical labs", "pulse techniques", "ams neve", "solid state logic"};
+            const juce::StringArray categories{"compressor", "equalizer", "preamp", "other"};
+
+            GearSearchIndex index;
+            for (int i = 0; i < 5000; ++i)
+            {
+                juce::String key;
+                key << models[i % models.size()].removeCharacters(" ") << i << '\n'
+                    << makers[i % makers.size()].removeCharacters(" ") << '\n'
+                    << categories[i % categories.size()] << '\n'
+                    << "rev" << (i % 9);
+                index.addEntry(key);
+            }
+
+            GearSearchRanker ranker;
+            const juce::StringArray typed{"d", "di", "dis", "dist", "distr", "distre", "distres", "distresor"};
+
+            auto start = juce::Time::getHighResolutionTicks();
+            int totalResults = 0;
+            for (const auto &query : typed)
+                totalResults += ranker.rank(index, index.find(query), {query}).size();
+            auto ticks = juce::Time::getHighResolutionTicks() - start;
+
+            const double perKeystrokeMs = juce::Time::highResolutionTicksToSeconds(ticks) * 1000.0 / typed.size();
+            logMessage("Ranked search over 5000 units: " + juce::String(perKeystrokeMs, 3) + " ms per keystroke, " +
+                       juce::String(totalResults) + " results over " + juce::String(typed.size()) + " keystrokes");
+        }
+    }
+};
+
+static GearSearchRankerBenchmarks gearSearchRankerBenchmarks;
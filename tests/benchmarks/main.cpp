@@ -0,0 +1,43 @@
+#include <JuceHeader.h>
+#include "unit/MockNetworkFetcher.h"
+#include "unit/MockFileSystem.h"
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    juce::ScopedJuceInitialiser_GUI guiInit;
+
+    juce::UnitTestRunner testRunner;
+
+    // Only run our benchmarks, not JUCE's own tests
+    juce::StringArray benchmarksToRun;
+    benchmarksToRun.add("AllocationBenchmarks");
+    benchmarksToRun.add("GearCatalogueParserBenchmarks");
+    benchmarksToRun.add("GearLibraryBenchmarks");
+    benchmarksToRun.add("GearSearchIndexBenchmarks");
+    benchmarksToRun.add("GearSearchRankerBenchmarks");
+    benchmarksToRun.add("GearFacetIndexBenchmarks");
+    benchmarksToRun.add("FileSystemBenchmarks");
+
+    juce::Array<juce::UnitTest *> selectedBenchmarks;
+    for (auto *test : juce::UnitTest::getAllTests())
+        if (benchmarksToRun.contains(test->getName()))
+            selectedBenchmarks.add(test);
+
+    std::cout << "Running the following benchmarks:\n";
+    for (auto *test : selectedBenchmarks)
+        std::cout << " - " << test->getName() << std::endl;
+
+    testRunner.runTests(selectedBenchmarks);
+
+    ConcreteMockNetworkFetcher::getInstance().reset();
+    ConcreteMockFileSystem::getInstance().reset();
+    juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+    juce::DeletedAtShutdown::deleteAll();
+
+    int failures = 0;
+    for (int i = 0; i < testRunner.getNumResults(); ++i)
+        failures += testRunner.getResult(i)->failures;
+
+    return failures > 0 ? 1 : 0;
+}
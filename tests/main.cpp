@@ -15,10 +15,24 @@ int main(int argc, char *argv[])
     // JUCE will run all tests (including theirs) automatically
     // We want to explicitly only run our tests
     juce::StringArray testsToRun;
+    testsToRun.add("BundledNetworkFetcherTests");
     testsToRun.add("CacheManagerTests");
+    testsToRun.add("DirectoryWatcherTests");
     testsToRun.add("DraggableListBoxTests");
+    testsToRun.add("FileSystemTests");
+    testsToRun.add("GearCatalogueParserTests");
+    testsToRun.add("GearCatalogueTests");
+    testsToRun.add("GearCategoryIndexTests");
+    testsToRun.add("GearFacetIndexTests");
+    testsToRun.add("GearInstancePoolTests");
+    testsToRun.add("GearItemAllocationTests");
     testsToRun.add("GearItemTests");
     testsToRun.add("GearLibraryTests");
+    testsToRun.add("GearSearchIndexTests");
+    testsToRun.add("GearSearchRankerTests");
+    testsToRun.add("GearSearchWorkerTests");
+    testsToRun.add("GearThumbnailLoaderTests");
+    testsToRun.add("MemoryUsageTests");
     testsToRun.add("NotesPanelTests");
     testsToRun.add("AnalogIQEditorTests");
     testsToRun.add("AnalogIQProcessorTests");
@@ -0,0 +1,200 @@
+/**
+ * @file BundledNetworkFetcherTests.cpp
+ * @brief Unit tests for the BundledNetworkFetcher class.
+ *
+ * This file contains unit tests for the BundledNetworkFetcher class, using a
+ * zip archive built in memory as the bundle and the mock network fetcher as
+ * the fallback.
+ */
+
+#include <JuceHeader.h>
+#include "BundledNetworkFetcher.h"
+#include "MockNetworkFetcher.h"
+#include "StarterPackData.h"
+
+/**
+ * @brief Unit tests for the BundledNetworkFetcher class.
+ */
+class BundledNetworkFetcherTests : public juce::UnitTest
+{
+public:
+    BundledNetworkFetcherTests() : UnitTest("BundledNetworkFetcherTests") {}
+
+    void runTest() override
+    {
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        mockFetcher.reset();
+
+        const juce::String baseUrl = "https://example.com/schemas/";
+        const juce::String bundledIndex = "{\"units\": [\"bundled\"]}";
+        const juce::String bundledSchema = "{\"unitId\": \"la2a-compressor\"}";
+
+        juce::MemoryBlock pack = createPack({{"units/index.json", bundledIndex},
+                                             {"units/la2a-compressor-1.0.0.json", bundledSchema}});
+
+        BundledNetworkFetcher fetcher(mockFetcher, pack.getData(), pack.getSize(), baseUrl, {"units/index.json"});
+
+        beginTest("Bundle Contents");
+        {
+            expectEquals(fetcher.getNumBundledEntries(), 2, "Bundle should expose both entries");
+            expect(fetcher.hasBundledEntry("units/la2a-compressor-1.0.0.json"), "Schema should be bundled");
+            expect(!fetcher.hasBundledEntry("units/missing-1.0.0.json"), "Unknown schema should not be bundled");
+        }
+
+        beginTest("Bundled Resources Skip The Network");
+        {
+            juce::URL schemaUrl(baseUrl + "units/la2a-compressor-1.0.0.json");
+            bool success = false;
+            expectEquals(fetcher.fetchJsonBlocking(schemaUrl, success), bundledSchema, "Schema should come from the bundle");
+            expect(success, "Bundled fetch should succeed");
+            expect(!mockFetcher.wasUrlRequested(schemaUrl.toString(false)), "Bundled schema should not touch the network");
+
+            juce::MemoryBlock binary = fetcher.fetchBinaryBlocking(schemaUrl, success);
+            expect(success && binary.toString() == bundledSchema, "Binary fetch should also be served from the bundle");
+        }
+
+        beginTest("Missing Resources Fall Back");
+        {
+            juce::URL otherUrl(baseUrl + "units/other-1.0.0.json");
+            mockFetcher.setResponse(otherUrl.toString(false), "{\"unitId\": \"other\"}");
+
+            bool success = false;
+            expectEquals(fetcher.fetchJsonBlocking(otherUrl, success), juce::String("{\"unitId\": \"other\"}"), "Unbundled schema should come from the network");
+            expect(success, "Fallback fetch should succeed");
+            expect(mockFetcher.wasUrlRequested(otherUrl.toString(false)), "Fallback should have been asked");
+        }
+
+        beginTest("Bundled Index Refreshes In The Background");
+        {
+            juce::URL indexUrl(baseUrl + "units/index.json");
+            const juce::String remoteIndex = "{\"units\": [\"remote\"]}";
+
+            // Offline: the bundled index is served and the refresh is retried later
+            mockFetcher.setError(indexUrl.toString(false));
+            BundledNetworkFetcher offline(mockFetcher, pack.getData(), pack.getSize(), baseUrl, {"units/index.json"});
+            bool success = false;
+            expectEquals(offline.fetchJsonBlocking(indexUrl, success), bundledIndex, "Offline index should come from the bundle");
+            expect(success, "Offline index fetch should succeed");
+            expect(offline.waitForRefreshes(5000), "Failed refresh should finish");
+            expectEquals(offline.fetchJsonBlocking(indexUrl, success), bundledIndex, "A failed refresh should keep the bundle");
+            expect(offline.waitForRefreshes(5000));
+
+            mockFetcher.reset();
+            mockFetcher.setResponse(indexUrl.toString(false), remoteIndex);
+
+            RecordingListener listener;
+            fetcher.addListener(&listener);
+
+            expectEquals(fetcher.fetchJsonBlocking(indexUrl, success), bundledIndex, "The bundled index should be served without waiting");
+            expect(success, "Bundled index fetch should succeed");
+            expect(fetcher.waitForRefreshes(5000), "Refresh should finish");
+            expect(mockFetcher.wasUrlRequested(indexUrl.toString(false)), "The index should be refreshed from the network");
+
+            fetcher.deliverPendingNotifications();
+            expectEquals(listener.updatedUrls.size(), 1, "Listeners should hear about the newer index");
+            expectEquals(listener.updatedUrls[0], indexUrl.toString(false));
+            expectEquals(fetcher.fetchJsonBlocking(indexUrl, success), remoteIndex, "Later fetches should get the refreshed index");
+
+            fetcher.removeListener(&listener);
+        }
+
+        beginTest("Empty Bundle");
+        {
+            BundledNetworkFetcher empty(mockFetcher, nullptr, 0, baseUrl);
+            expectEquals(empty.getNumBundledEntries(), 0, "Missing pack should have no entries");
+
+            bool success = true;
+            empty.fetchJsonBlocking(juce::URL(baseUrl + "units/la2a-compressor-1.0.0.json"), success);
+            expect(!success, "Missing pack should defer entirely to the fallback");
+        }
+
+        beginTest("Starter Pack Is Complete");
+        {
+            mockFetcher.reset();
+            BundledNetworkFetcher starter(mockFetcher,
+                                          StarterPackData::starter_pack_zip,
+                                          (size_t)StarterPackData::starter_pack_zipSize,
+                                          baseUrl);
+
+            expect(starter.hasBundledEntry("units/index.json"), "Starter pack should bundle the index");
+
+            bool success = false;
+            auto index = juce::JSON::parse(starter.fetchJsonBlocking(juce::URL(baseUrl + "units/index.json"), success));
+            expect(success, "Bundled index should be readable");
+
+            auto *units = index["units"].getArray();
+            expect(units != nullptr && !units->isEmpty(), "Bundled index should list units");
+
+            if (units != nullptr)
+            {
+                for (const auto &unit : *units)
+                {
+                    const juce::String schemaPath = unit["schemaPath"].toString();
+                    const juce::String thumbnailPath = unit["thumbnailImage"].toString();
+                    expect(starter.hasBundledEntry(schemaPath), "Schema should be bundled: " + schemaPath);
+                    expect(starter.hasBundledEntry(thumbnailPath), "Thumbnail should be bundled: " + thumbnailPath);
+
+                    auto schema = juce::JSON::parse(starter.fetchJsonBlocking(juce::URL(baseUrl + schemaPath), success));
+                    juce::StringArray assets;
+                    collectAssetPaths(schema, assets);
+                    for (const auto &asset : assets)
+                        expect(starter.hasBundledEntry(asset), "Asset should be bundled: " + asset);
+                }
+            }
+            expectEquals((int)mockFetcher.getRequestedUrlCount(), 0, "A complete starter pack should not touch the network");
+        }
+
+        mockFetcher.reset();
+    }
+
+private:
+    /**
+     * @brief Collects every "assets/..." string referenced by a schema.
+     *
+     * @param value The parsed schema, or any value inside it
+     * @param paths Receives the asset paths found
+     */
+    static void collectAssetPaths(const juce::var &value, juce::StringArray &paths)
+    {
+        if (value.isString() && value.toString().startsWith("assets/"))
+            paths.addIfNotAlreadyThere(value.toString());
+        else if (auto *array = value.getArray())
+            for (const auto &element : *array)
+                collectAssetPaths(element, paths);
+        else if (auto *object = value.getDynamicObject())
+            for (const auto &property : object->getProperties())
+                collectAssetPaths(property.value, paths);
+    }
+
+    /**
+     * @brief Records the URLs a fetcher reports as updated.
+     */
+    struct RecordingListener : public INetworkFetcher::Listener
+    {
+        void resourceUpdated(const juce::URL &url) override { updatedUrls.add(url.toString(false)); }
+
+        juce::StringArray updatedUrls; ///< URLs reported so far
+    };
+
+    /**
+     * @brief Builds a zip archive in memory.
+     *
+     * @param entries Pairs of relative path and text content
+     * @return The zip archive data
+     */
+    static juce::MemoryBlock createPack(const std::vector<std::pair<juce::String, juce::String>> &entries)
+    {
+        juce::ZipFile::Builder builder;
+        for (const auto &entry : entries)
+            builder.addEntry(new juce::MemoryInputStream(entry.second.toRawUTF8(), entry.second.getNumBytesAsUTF8(), true),
+                             9, entry.first, juce::Time::getCurrentTime());
+
+        juce::MemoryBlock data;
+        juce::MemoryOutputStream stream(data, false);
+        builder.writeToStream(stream, nullptr);
+        stream.flush();
+        return data;
+    }
+};
+
+static BundledNetworkFetcherTests bundledNetworkFetcherTests;
@@ -135,10 +135,137 @@ public:
             expect(loadedAsset.isValid(), "Loaded control asset should be valid");
         }
 
+        beginTest("Control Asset Deduplication");
+        {
+            auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+            mockFileSystem.reset();
+
+            juce::Image testImage(juce::Image::RGB, 40, 40, true);
+            testImage.clear(juce::Rectangle<int>(0, 0, 40, 40), juce::Colours::green);
+
+            juce::MemoryBlock imageData;
+            {
+                juce::PNGImageFormat pngFormat;
+                juce::MemoryOutputStream stream(imageData, false);
+                pngFormat.writeImageToStream(testImage, stream);
+            }
+
+            juce::String firstPath = "knobs/shared-knob.png";
+            juce::String secondPath = "assets/controls/knobs/other-knob.png";
+
+            expect(cacheManager.saveControlAssetToCache(firstPath, imageData), "Saving first alias should succeed");
+            expect(cacheManager.saveControlAssetToCache(secondPath, imageData), "Saving second alias should succeed");
+
+            juce::String firstHash = cacheManager.getControlAssetHash(firstPath);
+            expect(firstHash.isNotEmpty(), "First alias should resolve to a hash");
+            expect(firstHash == cacheManager.getControlAssetHash(secondPath), "Identical content should share a hash");
+            expect(firstHash == CacheManager::computeContentHash(imageData), "Hash should match the computed content hash");
+            expect(cacheManager.getControlAssetHash("controls/knobs/shared-knob.png") == firstHash, "Prefixed path should alias the bare path");
+
+            juce::String blobsDir = "/mock/cache/root/assets/blobs";
+            expectEquals(mockFileSystem.getFiles(blobsDir).size(), 1, "Identical content should be stored once");
+
+            juce::Image first = cacheManager.loadControlAssetFromCache(firstPath);
+            juce::Image second = cacheManager.loadControlAssetFromCache(secondPath);
+            expect(first.isValid() && second.isValid(), "Both aliases should load");
+            expect(first == second, "Aliases should share a single decoded image");
+
+            // Both aliases go out in one index write
+            juce::String indexPath = "/mock/cache/root/assets/control_index.json";
+            expect(!mockFileSystem.fileExists(indexPath), "Saving aliases should not write the index each time");
+            expect(cacheManager.flushControlAssetIndex(), "Flushing the index should succeed");
+            expect(mockFileSystem.fileExists(indexPath), "Flushing should write the index");
+
+            // A fresh manager should rebuild the path index from disk
+            CacheManager reloaded(mockFileSystem, "/mock/cache/root");
+            expect(reloaded.isControlAssetCached(secondPath), "Index should persist across instances");
+            expect(reloaded.getControlAssetHash(secondPath) == firstHash, "Persisted hash should match");
+        }
+
+        beginTest("Orphaned Control Asset Blobs");
+        {
+            auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+            mockFileSystem.reset();
+            CacheManager manager(mockFileSystem, "/mock/cache/root");
+            juce::String blobsDir = "/mock/cache/root/assets/blobs";
+
+            juce::MemoryBlock oldData("old-knob", 8);
+            juce::MemoryBlock newData("new-knob", 8);
+            expect(manager.saveControlAssetToCache("knobs/a.png", oldData));
+            expect(manager.saveControlAssetToCache("knobs/b.png", oldData));
+
+            expect(manager.saveControlAssetToCache("knobs/a.png", newData));
+            expectEquals(mockFileSystem.getFiles(blobsDir).size(), 2, "A blob still shared by another path should stay");
+
+            expect(manager.saveControlAssetToCache("knobs/b.png", newData));
+            expectEquals(mockFileSystem.getFiles(blobsDir).size(), 1, "A blob no path refers to should be deleted");
+
+            // As left by a process that exited before writing the index
+            mockFileSystem.setBinaryFile(blobsDir + "/stray", oldData);
+            expectEquals(manager.removeOrphanedControlAssets(), 0, "A fresh blob may not be indexed yet");
+            expectEquals(manager.removeOrphanedControlAssets(0), 1, "Unreferenced blobs past the grace period should be removed");
+            expect(manager.isControlAssetCached("knobs/a.png"), "Referenced blobs should stay");
+
+            // Another instance sharing the cache indexes a blob this one has never seen
+            juce::MemoryBlock otherData("other-knob", 10);
+            {
+                CacheManager other(mockFileSystem, "/mock/cache/root");
+                expect(other.saveControlAssetToCache("knobs/other.png", otherData));
+                expect(other.flushControlAssetIndex());
+            }
+            expectEquals(manager.removeOrphanedControlAssets(0), 0, "Blobs indexed by another instance should stay");
+            expect(mockFileSystem.fileExists(blobsDir + "/" + CacheManager::computeContentHash(otherData)));
+
+            expect(manager.flushControlAssetIndex());
+            CacheManager reloaded(mockFileSystem, "/mock/cache/root");
+            expect(reloaded.isControlAssetCached("knobs/other.png"), "Writing the index should keep other instances' entries");
+            expect(reloaded.isControlAssetCached("knobs/a.png"), "Writing the index should keep this instance's entries");
+
+            expect(manager.clearCache(), "Clearing the cache should succeed");
+            expectEquals(mockFileSystem.getFiles(blobsDir).size(), 0, "Clearing the cache should drop every blob");
+            expect(!mockFileSystem.fileExists("/mock/cache/root/assets/control_index.json"),
+                   "Clearing should discard the unwritten index");
+        }
+
+        beginTest("Mapped Reads");
+        {
+            auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+            mockFileSystem.reset();
+
+            juce::String testUnitId = "mapped-unit-1.0.0";
+            juce::String testJsonData = "{\"unitId\": \"mapped-unit-1.0.0\"}";
+            expect(cacheManager.saveUnitToCache(testUnitId, testJsonData), "Saving unit should succeed");
+            expect(cacheManager.loadUnitFromCache(testUnitId) == testJsonData, "Mapped unit JSON should match original data");
+            expect(mockFileSystem.wasPathMapped(cacheManager.getCachedUnitPath(testUnitId)), "Unit JSON should be read through mapFile");
+
+            juce::Image testImage(juce::Image::RGB, 20, 20, true);
+            expect(cacheManager.saveThumbnailToCache(testUnitId, "mapped.jpg", testImage), "Saving thumbnail should succeed");
+            expect(cacheManager.loadThumbnailFromCache(testUnitId, "mapped.jpg").isValid(), "Mapped thumbnail should decode");
+            expect(mockFileSystem.wasPathMapped(cacheManager.getCachedThumbnailPath(testUnitId, "mapped.jpg")), "Thumbnail should be read through mapFile");
+
+            FileView missing = mockFileSystem.mapFile("/mock/cache/root/does-not-exist.bin");
+            expect(!missing.isValid(), "Mapping a missing file should give an invalid view");
+        }
+
         beginTest("Cache Size");
         {
             juce::int64 cacheSize = cacheManager.getCacheSize();
             expect(cacheSize >= 0, "Cache size should be non-negative");
+
+            mockFileSystem.reset();
+            CacheManager sizedCache(mockFileSystem, "/mock/sized/root");
+            mockFileSystem.setDirectory("/mock/sized/root");
+            mockFileSystem.setFile("/mock/sized/root/favorites.json", "0123456789");
+            mockFileSystem.setDirectory("/mock/sized/root/assets");
+            mockFileSystem.setBinaryFile("/mock/sized/root/assets/blob", juce::MemoryBlock(5, true));
+            mockFileSystem.setDirectory("/mock/sized/root/assets/thumbnails");
+            mockFileSystem.setFile("/mock/sized/root/assets/thumbnails/unit.jpg", "1234567");
+
+            // One listing per directory supplies every size
+            mockFileSystem.resetCallCounts();
+            expectEquals(sizedCache.getCacheSize(), (juce::int64)22, "Cache size should add up files in every directory");
+            expectEquals(mockFileSystem.getListDirectoryCallCount(), 3, "Each directory should be listed once");
+            expectEquals(mockFileSystem.getStatCallCount(), 0, "Sizes should come from the listings, not a stat per file");
         }
 
         beginTest("File Path Generation");
@@ -0,0 +1,149 @@
+/**
+ * @file DirectoryWatcherTests.cpp
+ * @brief Unit tests for the DirectoryWatcher class.
+ *
+ * This file contains unit tests for the DirectoryWatcher class and for the
+ * preset list and favorites caches that it keeps up to date. Changes are
+ * picked up with checkForChanges() so the tests do not depend on timing.
+ */
+
+#include <JuceHeader.h>
+#include "DirectoryWatcher.h"
+#include "FileSystem.h"
+#include "CacheManager.h"
+#include "PresetManager.h"
+#include "MockFileSystem.h"
+
+/**
+ * @brief Unit tests for the DirectoryWatcher class.
+ */
+class DirectoryWatcherTests : public juce::UnitTest
+{
+public:
+    DirectoryWatcherTests() : UnitTest("DirectoryWatcherTests") {}
+
+    void runTest() override
+    {
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFileSystem.reset();
+
+        beginTest("Polling Reports Changed Files");
+        {
+            const juce::String directory = "/mock/watched";
+            mockFileSystem.createDirectory(directory);
+
+            RecordingListener listener;
+            DirectoryWatcher watcher(mockFileSystem, 0);
+            watcher.addWatch(directory, &listener);
+            expect(!watcher.isUsingNativeEvents(directory), "Mock directories should be polled");
+
+            watcher.checkForChanges();
+            expectEquals(listener.notifications, 0, "Unchanged directory should not notify");
+
+            mockFileSystem.writeFile(directory + "/a.json", juce::String("{}"));
+            watcher.checkForChanges();
+            expectEquals(listener.notifications, 1, "New file should notify once");
+            expect(listener.lastChangedNames.contains("a.json"), "New file should be reported by name");
+
+            mockFileSystem.deleteFile(directory + "/a.json");
+            watcher.checkForChanges();
+            expect(listener.lastChangedNames.contains("a.json"), "Deleted file should be reported by name");
+
+            watcher.removeListener(&listener);
+            mockFileSystem.writeFile(directory + "/b.json", juce::String("{}"));
+            watcher.checkForChanges();
+            expectEquals(listener.notifications, 2, "Removed listener should not be notified");
+        }
+
+#if JUCE_LINUX
+        beginTest("Native Events");
+        {
+            juce::File scratchDir = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                        .getNonexistentChildFile("AnalogIQDirectoryWatcherTests", "");
+            scratchDir.createDirectory();
+
+            FileSystem fileSystem;
+            RecordingListener listener;
+            DirectoryWatcher watcher(fileSystem, 0);
+            watcher.addWatch(scratchDir.getFullPathName(), &listener);
+            expect(watcher.isUsingNativeEvents(scratchDir.getFullPathName()), "Existing directory should use inotify");
+
+            scratchDir.getChildFile("favorites.json").replaceWithText("{}");
+            watcher.checkForChanges();
+            expect(listener.lastChangedNames.contains("favorites.json"), "Native events should name the changed file");
+
+            watcher.removeListener(&listener);
+            scratchDir.deleteRecursively();
+        }
+#endif
+
+        beginTest("Preset List Follows External Changes");
+        {
+            mockFileSystem.reset();
+            CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+            DirectoryWatcher watcher(mockFileSystem, 0); // Must outlive the preset manager
+            PresetManager presetManager(mockFileSystem, cacheManager);
+            presetManager.attachWatcher(watcher);
+
+            expect(presetManager.getPresetNames().isEmpty(), "Preset list should start empty");
+
+            // Another instance writes a preset
+            juce::String externalPreset = mockFileSystem.joinPath(presetManager.getPresetsDirectory(), "External.json");
+            mockFileSystem.writeFile(externalPreset, juce::String("{\"timestamp\": 1234}"));
+            watcher.checkForChanges();
+            expect(presetManager.getPresetNames().contains("External"), "External preset should appear after the change");
+            expectEquals(presetManager.getPresetTimestamp("External"), (juce::int64)1234, "External preset timestamp should be read");
+
+            mockFileSystem.deleteFile(externalPreset);
+            watcher.checkForChanges();
+            expect(!presetManager.getPresetNames().contains("External"), "External preset should disappear after deletion");
+        }
+
+        beginTest("Favorites Follow External Changes");
+        {
+            mockFileSystem.reset();
+            DirectoryWatcher watcher(mockFileSystem, 0); // Must outlive the cache manager
+            CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+            cacheManager.initializeCache();
+            cacheManager.attachWatcher(watcher);
+
+            expect(cacheManager.addToFavorites("unit-a"), "Adding a favorite should succeed");
+            expect(cacheManager.isFavorite("unit-a"), "Favorite should be cached");
+
+            expect(cacheManager.addToRecentlyUsed("unit-a"), "Adding a recent unit should succeed");
+            expect(cacheManager.isRecentlyUsed("unit-a"), "Recent unit should be cached");
+            watcher.checkForChanges();
+
+            // Another instance rewrites both lists a moment later
+            juce::Thread::sleep(2);
+            mockFileSystem.writeFile("/mock/cache/root/favorites.json", juce::String("{\"favorites\": [\"unit-b\", \"unit-d\"]}"));
+            mockFileSystem.writeFile("/mock/cache/root/recently_used.json", juce::String("{\"recentlyUsed\": [\"unit-b\", \"unit-c\"]}"));
+            watcher.checkForChanges();
+
+            expect(cacheManager.isFavorite("unit-b") && cacheManager.isFavorite("unit-d"), "External favorites should be visible after the change");
+            expect(!cacheManager.isFavorite("unit-a"), "Removed favorite should be gone after the change");
+            expectEquals(cacheManager.getRecentlyUsed().size(), 2, "External recently used list should be visible");
+            expect(!cacheManager.isRecentlyUsed("unit-a"), "Replaced recent unit should be gone");
+        }
+
+        mockFileSystem.reset();
+    }
+
+private:
+    /**
+     * @brief Listener that records the notifications it receives.
+     */
+    struct RecordingListener : public DirectoryWatcher::Listener
+    {
+        void directoryChanged(const juce::String &, const juce::StringArray &changedNames) override
+        {
+            ++notifications;
+            lastChangedNames = changedNames;
+        }
+
+        int notifications = 0;             ///< Number of notifications received
+        juce::StringArray lastChangedNames; ///< Names from the latest notification
+    };
+};
+
+static DirectoryWatcherTests directoryWatcherTests;
@@ -0,0 +1,138 @@
+/**
+ * @file FileSystemTests.cpp
+ * @brief Unit tests for the FileSystem class.
+ *
+ * This file contains unit tests for the production FileSystem implementation,
+ * run against a scratch directory under the system temp folder. It covers the
+ * metadata cache and the write-behind queue.
+ */
+
+#include <JuceHeader.h>
+#include "FileSystem.h"
+
+/**
+ * @brief Unit tests for the FileSystem class.
+ */
+class FileSystemTests : public juce::UnitTest
+{
+public:
+    FileSystemTests() : UnitTest("FileSystemTests") {}
+
+    void runTest() override
+    {
+        juce::File scratchDir = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                    .getNonexistentChildFile("AnalogIQFileSystemTests", "");
+        scratchDir.createDirectory();
+
+        const juce::String dirPath = scratchDir.getChildFile("assets").getFullPathName();
+        const juce::String jpgPath = scratchDir.getChildFile("assets").getChildFile("thumb.jpg").getFullPathName();
+        const juce::String missingPath = scratchDir.getChildFile("missing.jpg").getFullPathName();
+
+        beginTest("Metadata Cache Disabled By Default");
+        {
+            FileSystem fileSystem;
+            expect(!fileSystem.directoryExists(dirPath), "Directory should not exist yet");
+            expect(fileSystem.createDirectory(dirPath), "Directory should be created");
+            expect(fileSystem.directoryExists(dirPath), "Directory should exist after creation");
+            expectEquals((int)fileSystem.getMetadataCacheStats().hits, 0, "Disabled cache should record no hits");
+        }
+
+        beginTest("Positive And Negative Entries");
+        {
+            FileSystem fileSystem(60000);
+
+            expect(!fileSystem.fileExists(missingPath), "Missing file should not exist");
+            expect(!fileSystem.fileExists(missingPath), "Missing file should still not exist");
+            expect(fileSystem.directoryExists(dirPath), "Directory should exist");
+            expect(fileSystem.directoryExists(dirPath), "Directory should still exist");
+
+            auto stats = fileSystem.getMetadataCacheStats();
+            expectEquals((int)stats.hits, 2, "Repeated checks should be answered from the cache");
+            expectEquals((int)stats.syscallsSaved, 2, "Each hit should save one stat");
+        }
+
+        beginTest("Own Writes Invalidate Entries");
+        {
+            FileSystem fileSystem(60000);
+
+            expect(!fileSystem.fileExists(jpgPath), "JPEG should not exist before writing");
+
+            juce::Image image(juce::Image::RGB, 8, 8, true);
+            juce::MemoryBlock jpegData;
+            {
+                juce::JPEGImageFormat jpegFormat;
+                juce::MemoryOutputStream stream(jpegData, false);
+                jpegFormat.writeImageToStream(image, stream);
+            }
+
+            expect(fileSystem.writeFile(jpgPath, jpegData), "JPEG should be written");
+            expect(fileSystem.fileExists(jpgPath), "Write should replace the negative entry");
+
+            expect(fileSystem.deleteFile(jpgPath), "JPEG should be deleted");
+            expect(!fileSystem.fileExists(jpgPath), "Delete should replace the positive entry");
+
+            expect(fileSystem.deleteDirectory(dirPath), "Directory should be deleted");
+            expect(!fileSystem.directoryExists(dirPath), "Deleting a directory should invalidate it");
+            expect(fileSystem.createDirectory(dirPath), "Directory should be recreated");
+            expect(fileSystem.directoryExists(dirPath), "Recreated directory should be visible");
+        }
+
+        beginTest("Entries Expire After TTL");
+        {
+            FileSystem fileSystem(1);
+
+            expect(fileSystem.directoryExists(dirPath), "Directory should exist");
+            juce::Thread::sleep(5);
+            expect(fileSystem.directoryExists(dirPath), "Directory should still exist");
+            expectEquals((int)fileSystem.getMetadataCacheStats().hits, 0, "Expired entries should not be used");
+        }
+
+        beginTest("Write-Behind Queue");
+        {
+            FileSystem fileSystem(60000);
+            const juce::String jsonPath = scratchDir.getChildFile("favorites.json").getFullPathName();
+
+            for (int i = 0; i < 50; ++i)
+                expect(fileSystem.writeFileAsync(jsonPath, "{\"favorites\": [" + juce::String(i) + "]}"), "Write should be queued");
+
+            expect(fileSystem.fileExists(jsonPath), "Queued file should be visible before it reaches disk");
+            expectEquals(fileSystem.readFile(jsonPath), juce::String("{\"favorites\": [49]}"), "Reads should see the last queued write");
+
+            fileSystem.flushPendingWrites();
+            expectEquals(juce::File(jsonPath).loadFileAsString(), juce::String("{\"favorites\": [49]}"), "Flush should land the last write");
+
+            fileSystem.writeFileAsync(jsonPath, juce::String("{\"favorites\": []}"));
+            expect(fileSystem.deleteFile(jsonPath), "Delete should succeed");
+            fileSystem.flushPendingWrites();
+            expect(!juce::File(jsonPath).existsAsFile(), "Delete should cancel the queued write");
+
+            juce::MemoryBlock blob("abc", 3);
+            fileSystem.writeFileAsync(jsonPath, blob);
+            fileSystem.writeFile(jsonPath, juce::String("direct"));
+            fileSystem.flushPendingWrites();
+            expectEquals(juce::File(jsonPath).loadFileAsString(), juce::String("direct"), "Direct writes should supersede queued ones");
+
+            fileSystem.writeFileAsync(jsonPath, blob);
+            expectEquals(fileSystem.getFileSize(jsonPath), (juce::int64)3, "Size should come from the queued write");
+            expect(fileSystem.readBinaryFile(jsonPath) == blob, "Reads should see queued binary content");
+            expect(fileSystem.flushPendingWrites(), "Flush should report that every write landed");
+        }
+
+        beginTest("Queued Write Failures");
+        {
+            FileSystem fileSystem;
+            const juce::String blockerPath = scratchDir.getChildFile("blocker").getFullPathName();
+            const juce::String unwritablePath = scratchDir.getChildFile("blocker").getChildFile("index.json").getFullPathName();
+            expect(fileSystem.writeFile(blockerPath, juce::String("a file, not a directory")), "Blocker should be written");
+
+            expect(fileSystem.writeFileAsync(unwritablePath, juce::String("{}")), "Queueing reports success");
+            expect(!fileSystem.flushPendingWrites(), "Flush should report the write that could not land");
+            expect(!fileSystem.fileExists(unwritablePath), "A failed write should not stay visible");
+            expect(fileSystem.flushPendingWrites(), "A failure should only be reported once");
+        }
+
+        scratchDir.deleteRecursively();
+    }
+};
+
+static FileSystemTests fileSystemTests;
@@ -0,0 +1,205 @@
+/**
+ * @file GearCatalogueParserTests.cpp
+ * @brief Unit tests for the GearCatalogueParser class.
+ *
+ * This file contains unit tests for the streaming index parser: reading
+ * unit fields, decoding escapes, skipping unknown values, rejecting
+ * malformed documents and matching the DOM parse.
+ */
+
+#include <JuceHeader.h>
+#include "GearCatalogueParser.h"
+#include "TestHelpers.h"
+
+/**
+ * @brief Unit tests for the GearCatalogueParser class.
+ */
+class GearCatalogueParserTests : public juce::UnitTest
+{
+public:
+    GearCatalogueParserTests() : UnitTest("GearCatalogueParserTests") {}
+
+    void runTest() override
+    {
+        beginTest("Unit Fields");
+        {
+            auto records = parseAll(R"({
+                "version": "1.0.0",
+                "units": [
+                    {
+                        "unitId": "la2a-compressor",
+                        "name": "LA-2A",
+                        "manufacturer": "Teletronix",
+                        "category": "compressor",
+                        "version": "1.0.0",
+                        "schemaPath": "units/la2a-compressor-1.0.0.json",
+                        "thumbnailImage": "assets/thumbnails/la2a-compressor-1.0.0.jpg",
+                        "tags": ["optical", "tube", "vintage"],
+                        "slotSize": 2
+                    },
+                    {
+                        "unitId": "api-525",
+                        "name": "API 525",
+                        "manufacturer": "API",
+                        "category": "compressor"
+                    }
+                ]
+            })");
+
+            expectEquals(records.size(), 2);
+            const auto &first = records.getReference(0);
+            expectEquals(first.unitId, juce::String("la2a-compressor"));
+            expectEquals(first.name, juce::String("LA-2A"));
+            expectEquals(first.manufacturer, juce::String("Teletronix"));
+            expectEquals(first.category, juce::String("compressor"));
+            expectEquals(first.version, juce::String("1.0.0"));
+            expectEquals(first.schemaPath, juce::String("units/la2a-compressor-1.0.0.json"));
+            expectEquals(first.thumbnailImage, juce::String("assets/thumbnails/la2a-compressor-1.0.0.jpg"));
+            expect(first.tags == juce::StringArray({"optical", "tube", "vintage"}), "Tags should be read in order");
+            expectEquals(first.slotSize, 2);
+
+            const auto &second = records.getReference(1);
+            expectEquals(second.unitId, juce::String("api-525"));
+            expect(second.version.isEmpty(), "Missing fields should be empty");
+            expect(second.tags.isEmpty(), "Missing tags should be empty");
+            expectEquals(second.slotSize, 1, "Missing slot size should default to 1");
+        }
+
+        beginTest("Escapes");
+        {
+            auto records = parseAll(R"({"units": [{
+                "unitId": "quote\"slash\/back\\slash",
+                "name": "Tab\tNew\nline",
+                "manufacturer": "M\u00fcller",
+                "category": "\ud83c\udf9b"
+            }]})");
+
+            expectEquals(records.size(), 1);
+            const auto &record = records.getReference(0);
+            expectEquals(record.unitId, juce::String("quote\"slash/back\\slash"));
+            expectEquals(record.name, juce::String("Tab\tNew\nline"));
+            expectEquals(record.manufacturer, juce::String(juce::CharPointer_UTF8("M\xc3\xbcller")));
+            expectEquals(record.category, juce::String(juce::CharPointer_UTF8("\xf0\x9f\x8e\x9b")),
+                         "Surrogate pairs should decode to one character");
+        }
+
+        beginTest("Values Of Other Types");
+        {
+            auto records = parseAll(R"({"units": [
+                {"unitId": 42, "name": null, "manufacturer": true, "category": {"nested": [1, 2]},
+                 "tags": ["a", 7, null], "slotSize": null},
+                {"unitId": "tags-not-array", "tags": "vintage"}
+            ]})");
+
+            expectEquals(records.size(), 2);
+            const auto &first = records.getReference(0);
+            expectEquals(first.unitId, juce::String("42"), "Numbers should read as their text");
+            expect(first.name.isEmpty(), "Null should read as empty");
+            expectEquals(first.manufacturer, juce::String("true"));
+            expect(first.category.isEmpty(), "Containers should read as empty");
+            expect(first.tags == juce::StringArray({"a", "7", ""}), "Tags should be converted like scalars");
+            expectEquals(first.slotSize, 0, "Null slot size should read as zero, as juce::var does");
+            expect(records.getReference(1).tags.isEmpty(), "Tags that are not an array should be ignored");
+        }
+
+        beginTest("Skipping Unknown Values");
+        {
+            auto records = parseAll(R"({
+                "meta": {"deep": [[{"a": "}"}], {"b": "]"}], "s": "\"{["},
+                "units": [
+                    {"unitId": "first", "controls": [{"type": "knob", "steps": [1, 2, 3]}], "name": "First"},
+                    "not an object",
+                    {"unitId": "second"}
+                ],
+                "trailer": [true, false, null, -1.5e3]
+            })");
+
+            expectEquals(records.size(), 2, "Non-object units should be skipped");
+            expectEquals(records.getReference(0).name, juce::String("First"), "Fields after skipped values should be read");
+            expectEquals(records.getReference(1).unitId, juce::String("second"));
+        }
+
+        beginTest("Malformed Documents");
+        {
+            expect(!GearCatalogueParser::parse("", nullptr), "Empty text should fail");
+            expect(!GearCatalogueParser::parse("[]", nullptr), "Top-level array should fail");
+            expect(!GearCatalogueParser::parse("{}", nullptr), "Missing units should fail");
+            expect(!GearCatalogueParser::parse(R"({"units": {}})", nullptr), "Units that are not an array should fail");
+            expect(!GearCatalogueParser::parse(R"({"units": [{"unitId": "a"})", nullptr), "Truncated text should fail");
+            expect(!GearCatalogueParser::parse(R"({"units": [{"unitId": "a\q"}]})", nullptr), "Bad escape should fail");
+            expect(!GearCatalogueParser::parse(R"({"units": []} trailing)", nullptr), "Trailing text should fail");
+            expect(GearCatalogueParser::parse(R"({"units": []})", nullptr), "Empty units should succeed");
+
+            juce::String deep = R"({"x": )";
+            deep << juce::String::repeatedString("[", 1000) << juce::String::repeatedString("]", 1000) << R"(, "units": []})";
+            expect(!GearCatalogueParser::parse(deep, nullptr), "Excessive nesting should fail instead of recursing");
+        }
+
+        beginTest("Abort");
+        {
+            auto jsonData = createSyntheticIndex(100);
+            int numRecords = 0;
+            auto countRecord = [&numRecords](GearCatalogueRecord &&)
+            { ++numRecords; };
+            auto shouldAbort = [&numRecords]
+            { return numRecords >= 10; };
+            bool parsed = GearCatalogueParser::parse(jsonData, countRecord, shouldAbort);
+
+            expect(!parsed, "Aborted parse should fail");
+            expectEquals(numRecords, 10, "Parsing should stop at the next unit");
+        }
+
+        beginTest("Count Units");
+        {
+            expectEquals(GearCatalogueParser::countUnits(createSyntheticIndex(123)), 123);
+            expectEquals(GearCatalogueParser::countUnits(R"({"units": []})"), 0);
+            expectEquals(GearCatalogueParser::countUnits("not json"), 0);
+        }
+
+        beginTest("Matches DOM Parse");
+        {
+            auto jsonData = createSyntheticIndex(500);
+            auto records = parseAll(jsonData);
+            auto *units = juce::JSON::parse(jsonData)["units"].getArray();
+
+            expect(units != nullptr);
+            if (units != nullptr)
+            {
+                expectEquals(records.size(), units->size());
+                bool allMatch = true;
+                for (int i = 0; i < juce::jmin(records.size(), units->size()); ++i)
+                {
+                    const auto &record = records.getReference(i);
+                    const auto &unit = units->getReference(i);
+
+                    juce::StringArray tags;
+                    if (auto *tagArray = unit["tags"].getArray())
+                        for (const auto &tag : *tagArray)
+                            tags.add(tag.toString());
+
+                    allMatch = allMatch && record.unitId == unit["unitId"].toString() && record.name == unit["name"].toString() &&
+                               record.manufacturer == unit["manufacturer"].toString() && record.category == unit["category"].toString() &&
+                               record.version == unit["version"].toString() && record.schemaPath == unit["schemaPath"].toString() &&
+                               record.thumbnailImage == unit["thumbnailImage"].toString() && record.tags == tags &&
+                               record.slotSize == (int)unit["slotSize"];
+                }
+                expect(allMatch, "Streaming records should match the DOM fields");
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Parses a document and collects every record.
+     */
+    juce::Array<GearCatalogueRecord> parseAll(const juce::String &jsonData)
+    {
+        juce::Array<GearCatalogueRecord> records;
+        bool parsed = GearCatalogueParser::parse(jsonData, [&records](GearCatalogueRecord &&record)
+                                                 { records.add(std::move(record)); });
+        expect(parsed, "Document should parse");
+        return records;
+    }
+};
+
+static GearCatalogueParserTests gearCatalogueParserTests;
@@ -0,0 +1,219 @@
+/**
+ * @file GearCatalogueTests.cpp
+ * @brief Unit tests for the GearCatalogue class.
+ *
+ * This file contains unit tests for the compact catalogue entries: reading
+ * fields back, sharing repeated strings, deriving type and category,
+ * grouping by category, creating full gear items from entries and comparing
+ * catalogues.
+ */
+
+#include <JuceHeader.h>
+#include "GearCatalogue.h"
+
+/**
+ * @brief Unit tests for the GearCatalogue class.
+ */
+class GearCatalogueTests : public juce::UnitTest
+{
+public:
+    GearCatalogueTests() : UnitTest("GearCatalogueTests") {}
+
+    void runTest() override
+    {
+        beginTest("Entry Fields");
+        {
+            GearCatalogue catalogue;
+            expect(catalogue.isEmpty(), "New catalogue should be empty");
+
+            auto record = createRecord(0);
+            record.tags = {"optical", "500 series"};
+            expectEquals(catalogue.add(record), 0, "Entries should be numbered in order");
+            expectEquals(catalogue.add(createRecord(1), GearType::Rack19Inch), 1);
+
+            auto first = catalogue[0];
+            expectEquals(first.index, 0);
+            expectEquals(first.unitId, juce::String("unit-0"));
+            expectEquals(first.name, juce::String("Unit 0"));
+            expectEquals(first.manufacturer, juce::String("Neve"));
+            expectEquals(first.categoryString, juce::String("compressor"));
+            expectEquals(first.version, juce::String("1.0.0"));
+            expectEquals(first.schemaPath, juce::String("units/unit-0-1.0.0.json"));
+            expectEquals(first.thumbnailImage, juce::String("assets/thumbnails/unit-0-1.0.0.jpg"));
+            expect(first.tags.toStringArray() == juce::StringArray({"optical", "500 series"}), "Tags should be kept in order");
+            expect(first.tags.contains("optical"));
+            expect(!first.tags.contains("vintage"));
+            expect(first.type == GearType::Series500, "Type should be derived from the tags");
+            expect(first.category == GearCategory::Compressor, "Category should be derived from the string");
+            expectEquals(first.slotSize, 1);
+
+            auto second = catalogue[1];
+            expect(second.type == GearType::Rack19Inch, "Type should fall back to the given one");
+            expect(second.category == GearCategory::EQ);
+            expectEquals(second.slotSize, 2);
+
+            int visited = 0;
+            for (const auto &entry : catalogue)
+                expectEquals(entry.index, visited++, "Iteration should follow index order");
+            expectEquals(visited, 2);
+        }
+
+        beginTest("Shared Strings");
+        {
+            GearCatalogue catalogue;
+            for (int i = 0; i < 1000; ++i)
+                catalogue.add(createRecord(i));
+
+            // Two manufacturers, two categories, one version and three tags
+            expectEquals(catalogue.getNumSharedStrings(), 8, "Repeated strings should be stored once");
+            expect(catalogue[0].manufacturer.getCharPointer() == catalogue[2].manufacturer.getCharPointer(),
+                   "Entries should refer to the same manufacturer string");
+            expect(catalogue[0].tags[0].getCharPointer() == catalogue[999].tags[0].getCharPointer(),
+                   "Entries should refer to the same tag string");
+        }
+
+        beginTest("Category Groups");
+        {
+            GearCatalogue catalogue;
+            for (int i = 0; i < 4; ++i)
+                catalogue.add(createRecord(i));
+
+            auto uncategorised = createRecord(4);
+            uncategorised.category = {};
+            catalogue.add(uncategorised);
+
+            const auto &categoryIndex = catalogue.getCategoryIndex();
+            expectEquals(categoryIndex.getNumGroups(), 3, "Entries should be grouped as they are added");
+            expect(categoryIndex.getEntries(0) == juce::Array<int>({0, 2}));
+            expect(categoryIndex.getEntries(1) == juce::Array<int>({1, 3}));
+            expectEquals(categoryIndex.getDisplayName(2), juce::String("Other"), "An empty category should be named from the enum");
+            expectEquals(categoryIndex.getGroupOfEntry(4), 2);
+        }
+
+        beginTest("Create Item");
+        {
+            GearCatalogue catalogue;
+            auto record = createRecord(3);
+            record.tags = {"rack"};
+            catalogue.add(record);
+            catalogue.add(createRecord(4));
+
+            juce::Array<GearControl> controls;
+            controls.add(GearControl(GearControl::Type::Knob, "Gain", juce::Rectangle<float>(0, 0, 50, 50)));
+            catalogue.setControls(1, controls);
+            catalogue.setControls(99, controls);
+
+            auto &networkFetcher = INetworkFetcher::getDummy();
+            auto &fileSystem = IFileSystem::getDummy();
+            auto &cacheManager = CacheManager::getDummy();
+
+            auto item = catalogue.createItem(0, networkFetcher, fileSystem, cacheManager);
+            expect(item != nullptr);
+            if (item != nullptr)
+            {
+                auto entry = catalogue[0];
+                expectEquals(item->unitId, entry.unitId);
+                expectEquals(item->name, entry.name);
+                expectEquals(item->manufacturer, entry.manufacturer);
+                expectEquals(item->categoryString, entry.categoryString);
+                expectEquals(item->schemaPath, entry.schemaPath);
+                expectEquals(item->thumbnailImage, entry.thumbnailImage);
+                expect(item->tags == juce::StringArray({"rack"}));
+                expect(item->type == entry.type && item->type == GearType::Rack19Inch, "Item type should match the entry");
+                expect(item->category == entry.category);
+                expectEquals(item->slotSize, entry.slotSize);
+                expect(item->controls.isEmpty(), "Units with a schema get their controls when placed");
+                expect(!item->isInstance, "Created items should not be instances yet");
+            }
+
+            auto schemaless = catalogue.createItem(1, networkFetcher, fileSystem, cacheManager);
+            expect(schemaless != nullptr && schemaless->controls.size() == 1, "Set controls should be given to new items");
+
+            expect(catalogue.createItem(-1, networkFetcher, fileSystem, cacheManager) == nullptr);
+            expect(catalogue.createItem(2, networkFetcher, fileSystem, cacheManager) == nullptr, "Out of range index should give nullptr");
+        }
+
+        beginTest("Changes Since");
+        {
+            GearCatalogue previous;
+            for (int i = 0; i < 5; ++i)
+                previous.add(createRecord(i));
+
+            GearCatalogue same;
+            for (int i = 0; i < 5; ++i)
+                same.add(createRecord(i));
+            expect(same.getChangesSince(previous).isEmpty(), "Identical catalogues should have no changes");
+
+            GearCatalogue updated;
+            updated.add(createRecord(0));
+            auto bumped = createRecord(2);
+            bumped.version = "1.1.0";
+            updated.add(bumped);
+            updated.add(createRecord(3));
+            updated.add(createRecord(4));
+            updated.add(createRecord(7));
+
+            auto changes = updated.getChangesSince(previous);
+            expect(!changes.isEmpty());
+            expect(changes.previousIndices == juce::Array<int>({0, 2, 3, 4, -1}), "Kept units should map to their old index");
+            expect(changes.added == juce::Array<int>({4}));
+            expect(changes.changed == juce::Array<int>({1}), "A new version should count as a change");
+            expect(changes.removed == juce::Array<int>({1}));
+            expect(changes.moved, "Units after a removed one should move");
+
+            GearCatalogue retagged;
+            for (int i = 0; i < 5; ++i)
+            {
+                auto record = createRecord(i);
+                if (i == 3)
+                    record.tags.add("rare");
+                retagged.add(record);
+            }
+            expect(retagged.getChangesSince(previous).changed == juce::Array<int>({3}), "Different tags should count as a change");
+        }
+
+        beginTest("Swap And Clear");
+        {
+            GearCatalogue catalogue;
+            catalogue.add(createRecord(0));
+
+            GearCatalogue other;
+            other.add(createRecord(1));
+            other.add(createRecord(2));
+
+            catalogue.swapWith(other);
+            expectEquals(catalogue.size(), 2);
+            expectEquals(catalogue.getIndexOfUnitId("unit-2"), 1, "Unit ID index should move with the entries");
+            expectEquals(catalogue.getCategoryIndex().getGroupOfEntry(1), 1, "Category groups should move with the entries");
+            expectEquals(other.getIndexOfUnitId("unit-0"), 0);
+
+            catalogue.clear();
+            expect(catalogue.isEmpty(), "Cleared catalogue should be empty");
+            expectEquals(catalogue.getNumSharedStrings(), 0, "Clearing should release the shared strings");
+            expectEquals(catalogue.getIndexOfUnitId("unit-1"), -1);
+            expectEquals(catalogue.add(createRecord(5)), 0, "Cleared catalogue should number entries from zero again");
+            expect(catalogue[0].tags.size() == 3, "Tags should be read from the new entries");
+        }
+    }
+
+private:
+    /**
+     * @brief Creates a record with a numbered unit ID, shaped like an index.json unit.
+     */
+    static GearCatalogueRecord createRecord(int i)
+    {
+        GearCatalogueRecord record;
+        record.unitId = "unit-" + juce::String(i);
+        record.name = "Unit " + juce::String(i);
+        record.manufacturer = i % 2 == 0 ? "Neve" : "API";
+        record.category = i % 2 == 0 ? "compressor" : "equalizer";
+        record.version = "1.0.0";
+        record.schemaPath = "units/" + record.unitId + "-1.0.0.json";
+        record.thumbnailImage = "assets/thumbnails/" + record.unitId + "-1.0.0.jpg";
+        record.tags = {"vintage", "hardware", "tube"};
+        record.slotSize = 1 + i % 2;
+        return record;
+    }
+};
+
+static GearCatalogueTests gearCatalogueTests;
@@ -0,0 +1,105 @@
+/**
+ * @file GearCategoryIndexTests.cpp
+ * @brief Unit tests for the GearCategoryIndex class.
+ *
+ * This file contains unit tests for grouping entries by category: matching
+ * categories ignoring case, display names, the first-seen and name orders
+ * of groups and entries, lookup, and swapping and clearing.
+ */
+
+#include <JuceHeader.h>
+#include "GearCategoryIndex.h"
+
+/**
+ * @brief Unit tests for the GearCategoryIndex class.
+ */
+class GearCategoryIndexTests : public juce::UnitTest
+{
+public:
+    GearCategoryIndexTests() : UnitTest("GearCategoryIndexTests") {}
+
+    void runTest() override
+    {
+        // 0: LA-2A, compressor
+        // 1: Pultec, equalizer
+        // 2: 1176, Compressor
+        // 3: Distressor, compressor
+        // 4: 1073, preamp
+        // 5: API 550A, equalizer
+        juce::StringArray names;
+        GearCategoryIndex index;
+        auto add = [&names, &index](const juce::String &name, const juce::String &category)
+        {
+            names.add(name);
+            return index.addEntry(names.size() - 1, category, names);
+        };
+        add("LA-2A", "compressor");
+        add("Pultec", "equalizer");
+        add("1176", "Compressor");
+        add("Distressor", "compressor");
+        add("1073", "preamp");
+        add("API 550A", "equalizer");
+
+        beginTest("Groups");
+        {
+            expectEquals(index.getNumGroups(), 3, "Categories differing only in case should share a group");
+            expectEquals(index.getCategoryName(0), juce::String("compressor"), "Groups should keep the category as first seen");
+            expectEquals(index.getDisplayName(0), juce::String("Compressor"));
+            expectEquals(index.getDisplayName(1), juce::String("Equalizer"));
+            expectEquals(index.getDisplayName(2), juce::String("Preamp"));
+
+            expect(index.getEntries(0) == juce::Array<int>({0, 2, 3}), "Entries should be kept in catalogue order");
+            expect(index.getEntries(1) == juce::Array<int>({1, 5}));
+            expectEquals(index.getGroupOfEntry(2), 0);
+            expectEquals(index.getGroupOfEntry(4), 2);
+            expectEquals(index.getGroupOfEntry(6), -1, "Entries not added should have no group");
+        }
+
+        beginTest("Name Order");
+        {
+            expect(index.getGroupsByName() == juce::Array<int>({0, 1, 2}));
+            expect(index.getEntriesByName(0) == juce::Array<int>({2, 3, 0}), "Entries should be sorted by name");
+            expect(index.getEntriesByName(1) == juce::Array<int>({5, 1}));
+
+            GearCategoryIndex other;
+            juce::StringArray otherNames;
+            for (auto category : {"tape", "delay", "Reverb", "delay"})
+            {
+                otherNames.add("Unit");
+                other.addEntry(otherNames.size() - 1, category, otherNames);
+            }
+
+            expect(other.getGroupsByName() == juce::Array<int>({1, 2, 0}), "Groups should be sorted by category, ignoring case");
+            expect(other.getEntriesByName(1) == juce::Array<int>({1, 3}), "Equal names should stay in catalogue order");
+        }
+
+        beginTest("Find Group");
+        {
+            expectEquals(index.findGroup("equalizer"), 1);
+            expectEquals(index.findGroup("Equalizer"), 1, "Lookup should ignore case");
+            expectEquals(index.findGroup("limiter"), -1);
+            expectEquals(GearCategoryIndex::formatDisplayName("eq"), juce::String("Eq"));
+            expectEquals(GearCategoryIndex::formatDisplayName({}), juce::String());
+        }
+
+        beginTest("Swap And Clear");
+        {
+            GearCategoryIndex other;
+            juce::StringArray otherNames{"Unit"};
+            other.addEntry(0, "limiter", otherNames);
+
+            other.swapWith(index);
+            expectEquals(other.getNumGroups(), 3);
+            expectEquals(index.getNumGroups(), 1);
+            expectEquals(index.findGroup("limiter"), 0, "Lookup should move with the groups");
+
+            index.clear();
+            expectEquals(index.getNumGroups(), 0);
+            expect(index.getGroupsByName().isEmpty());
+            expectEquals(index.getGroupOfEntry(0), -1);
+            expectEquals(index.addEntry(0, "limiter", otherNames), 0, "Cleared index should number groups from zero again");
+        }
+    }
+};
+
+static GearCategoryIndexTests gearCategoryIndexTests;
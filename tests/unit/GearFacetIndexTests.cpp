@@ -0,0 +1,184 @@
+/**
+ * @file GearFacetIndexTests.cpp
+ * @brief Unit tests for the GearFacetIndex class.
+ *
+ * This file contains unit tests for facet filtering: combining selections
+ * within and across facets, combining them with text matches and the
+ * counts per facet value.
+ */
+
+#include <JuceHeader.h>
+#include "GearFacetIndex.h"
+
+/**
+ * @brief Unit tests for the GearFacetIndex class.
+ */
+class GearFacetIndexTests : public juce::UnitTest
+{
+public:
+    GearFacetIndexTests() : UnitTest("GearFacetIndexTests") {}
+
+    void runTest() override
+    {
+        using Facet = GearFacetIndex::Facet;
+
+        // 0: UA 1176, rack compressor
+        // 1: API 525, 500-series compressor
+        // 2: API 550A, 500-series equalizer
+        // 3: Neve 1073, rack preamp
+        // 4: Neve 2264, 500-series compressor
+        GearFacetIndex index;
+        auto add = [&index](const juce::String &manufacturer, const juce::String &category,
+                            const juce::String &type, const juce::StringArray &tags)
+        {
+            auto entry = index.addEntry();
+            index.addValue(entry, Facet::Manufacturer, manufacturer);
+            index.addValue(entry, Facet::Category, category);
+            index.addValue(entry, Facet::Type, type);
+            index.addValue(entry, Facet::SlotSize, "1");
+            for (const auto &tag : tags)
+                index.addValue(entry, Facet::Tag, tag);
+        };
+        add("Universal Audio", "compressor", "Rack19Inch", {"fet", "vintage"});
+        add("API", "compressor", "500Series", {"vca"});
+        add("API", "equalizer", "500Series", {"vintage"});
+        add("Neve", "preamp", "Rack19Inch", {"vintage"});
+        add("Neve", "compressor", "500Series", {"diode bridge"});
+
+        beginTest("Values");
+        {
+            expectEquals(index.size(), 5);
+            expect(index.getValues(Facet::Manufacturer) == juce::StringArray({"Universal Audio", "API", "Neve"}),
+                   "Values should be listed in first-seen order");
+            expectEquals(index.getEntries(Facet::Tag, "vintage").countNumberOfSetBits(), 3);
+            expect(index.getEntries(Facet::Tag, "unknown").isZero(), "Unknown value should have no entries");
+        }
+
+        beginTest("Filter Across Facets");
+        {
+            GearFacetIndex::Filter filter;
+            expect(!filter.isActive(), "New filter should be inactive");
+            expectEquals(index.filter(filter).numMatches, 5, "Inactive filter should match everything");
+
+            filter.setValues(Facet::Type, {"500Series"});
+            filter.setValues(Facet::Category, {"compressor"});
+            auto result = index.filter(filter);
+            expect(GearFacetIndex::toIndices(result.matches) == juce::Array<int>({1, 4}), "Facets should combine with AND");
+
+            filter.setValues(Facet::Manufacturer, {"API"});
+            result = index.filter(filter);
+            expect(GearFacetIndex::toIndices(result.matches) == juce::Array<int>({1}), "500-series compressors from API");
+
+            filter.setValues(Facet::Manufacturer, {"API", "Neve"});
+            result = index.filter(filter);
+            expect(GearFacetIndex::toIndices(result.matches) == juce::Array<int>({1, 4}), "Values of one facet should combine with OR");
+
+            filter.setValues(Facet::Manufacturer, {"Unknown"});
+            expectEquals(index.filter(filter).numMatches, 0, "Unknown value should match nothing");
+
+            filter.clear();
+            expect(!filter.isActive(), "Cleared filter should be inactive");
+        }
+
+        beginTest("Combine With Text Matches");
+        {
+            GearFacetIndex::Filter filter;
+            filter.setValues(Facet::Tag, {"vintage"});
+
+            auto textMatches = GearFacetIndex::toBits({0, 1, 3});
+            auto result = index.filter(filter, &textMatches);
+            expect(GearFacetIndex::toIndices(result.matches) == juce::Array<int>({0, 3}), "Text matches should combine with AND");
+
+            expect(GearFacetIndex::intersect({3, 1, 0}, result.matches) == juce::Array<int>({3, 0}),
+                   "Intersect should keep the original order");
+        }
+
+        beginTest("Counts");
+        {
+            GearFacetIndex::Filter filter;
+            filter.setValues(Facet::Type, {"500Series"});
+            filter.setValues(Facet::Manufacturer, {"API"});
+
+            auto result = index.filter(filter);
+            expectEquals(result.numMatches, 2);
+
+            auto countOf = [&result](Facet facet, const juce::String &value)
+            {
+                for (const auto &valueCount : result.counts[(int)facet])
+                    if (valueCount.value == value)
+                        return valueCount.count;
+                return -1;
+            };
+
+            // Manufacturer counts ignore the manufacturer selection but apply the type
+            expectEquals(countOf(Facet::Manufacturer, "API"), 2);
+            expectEquals(countOf(Facet::Manufacturer, "Neve"), 1);
+            expectEquals(countOf(Facet::Manufacturer, "Universal Audio"), 0);
+
+            // Type counts apply the manufacturer selection
+            expectEquals(countOf(Facet::Type, "500Series"), 2);
+            expectEquals(countOf(Facet::Type, "Rack19Inch"), 0);
+
+            // Other facets apply every selection
+            expectEquals(countOf(Facet::Category, "compressor"), 1);
+            expectEquals(countOf(Facet::Category, "equalizer"), 1);
+            expectEquals(countOf(Facet::SlotSize, "1"), 2);
+
+            expectEquals(result.counts[(int)Facet::Tag].size(), index.getValues(Facet::Tag).size(),
+                         "Every value should be counted, even with no matches");
+        }
+
+        beginTest("Clear");
+        {
+            GearFacetIndex other;
+            other.addValue(other.addEntry(), Facet::Manufacturer, "API");
+            other.clear();
+            expectEquals(other.size(), 0);
+            expect(other.getValues(Facet::Manufacturer).isEmpty(), "Cleared index should have no values");
+            expectEquals(other.filter({}).numMatches, 0);
+
+            expectEquals(other.addEntry(), 0, "Entries should be numbered from zero again");
+            expectEquals(other.filter({}).numMatches, 1);
+        }
+
+        beginTest("Filter Matches A Scan");
+        {
+            const juce::StringArray manufacturers{"Universal Audio", "Neve", "API", "SSL", "Teletronix", "Pultec", "Empirical Labs", "Tube-Tech"};
+            const juce::StringArray categories{"compressor", "equalizer", "preamp", "other"};
+            const juce::StringArray types{"500Series", "Rack19Inch"};
+
+            GearFacetIndex spread;
+            constexpr int unitCount = 64;
+            for (int i = 0; i < unitCount; ++i)
+            {
+                auto entry = spread.addEntry();
+                spread.addValue(entry, Facet::Manufacturer, manufacturers[i % manufacturers.size()]);
+                spread.addValue(entry, Facet::Category, categories[i % categories.size()]);
+                spread.addValue(entry, Facet::Type, types[i % types.size()]);
+                spread.addValue(entry, Facet::SlotSize, juce::String(1 + i % 3));
+                spread.addValue(entry, Facet::Tag, "series-" + juce::String(i % 50));
+            }
+
+            GearFacetIndex::Filter filter;
+            filter.setValues(Facet::Type, {"500Series"});
+            filter.setValues(Facet::Category, {"compressor"});
+            filter.setValues(Facet::Manufacturer, {"Universal Audio", "API"});
+
+            int numMatches = spread.filter(filter).numMatches;
+
+            int expected = 0;
+            for (int i = 0; i < unitCount; ++i)
+            {
+                const auto &manufacturer = manufacturers[i % manufacturers.size()];
+                if (types[i % types.size()] == "500Series" && categories[i % categories.size()] == "compressor" &&
+                    (manufacturer == "Universal Audio" || manufacturer == "API"))
+                    ++expected;
+            }
+
+            expect(expected > 0, "Filter should select some units");
+            expectEquals(numMatches, expected, "Filter should match a scan");
+        }
+    }
+};
+
+static GearFacetIndexTests gearFacetIndexTests;
@@ -0,0 +1,279 @@
+/**
+ * @file GearInstancePoolTests.cpp
+ * @brief Unit tests for the GearInstancePool class and the rack's ownership of instances.
+ *
+ * This file contains unit tests for acquiring, releasing and recycling
+ * instances, for the rack reclaiming instances no slot holds, and a soak test
+ * loading a thousand presets into one rack.
+ */
+
+#include <JuceHeader.h>
+#include "GearInstancePool.h"
+#include "Rack.h"
+#include "GearLibrary.h"
+#include "TestFixture.h"
+#include "MockNetworkFetcher.h"
+#include "MockFileSystem.h"
+#include "PresetManager.h"
+#include "TestHelpers.h"
+
+/**
+ * @brief Unit tests for the GearInstancePool class.
+ */
+class GearInstancePoolTests : public juce::UnitTest
+{
+public:
+    GearInstancePoolTests() : UnitTest("GearInstancePoolTests") {}
+
+    void runTest() override
+    {
+        TestFixture fixture;
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFetcher.reset();
+        mockFileSystem.reset();
+
+        CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+        PresetManager presetManager(mockFileSystem, cacheManager);
+
+        beginTest("Acquire And Release");
+        {
+            GearInstancePool pool;
+            auto *first = pool.acquire(createItem("unit-a", 2));
+            auto *second = pool.acquire(createItem("unit-b", 2));
+
+            expect(first != second);
+            expect(pool.owns(first) && pool.owns(second));
+            expectEquals(pool.getNumInUse(), 2);
+            expectEquals(first->unitId, juce::String("unit-a"));
+
+            first->createInstance(first->unitId);
+            pool.release(first);
+            expectEquals(pool.getNumInUse(), 1);
+            expect(!first->isInstance, "Released instances should lose their instance state");
+            expect(first->instanceId.isEmpty());
+            expect(first->controls.isEmpty(), "Released instances should drop their controls");
+
+            auto *third = pool.acquire(createItem("unit-c", 1));
+            expect(third == first, "Released instances should be reused");
+            expectEquals(third->unitId, juce::String("unit-c"));
+            expectEquals(third->controls.size(), 1);
+            expectEquals(pool.getNumAllocated(), 2, "Reusing an instance should not allocate another");
+
+            GearItem outsider = createItem("unit-d", 0);
+            expect(!pool.owns(&outsider));
+        }
+
+        beginTest("Recycled Controls Keep Their Storage");
+        {
+            GearInstancePool pool;
+            GearDefinition::Ptr definition = new GearDefinition("unit-a", "1.0.0");
+            for (int i = 0; i < 8; ++i)
+                definition->controls.add(createControl(i));
+            definition->state = GearDefinition::State::Loaded;
+
+            auto *item = pool.acquire(createItem("unit-a", 0));
+            item->definition = definition;
+            item->useDefinitionControls();
+            const auto *controlStorage = item->controls.begin();
+            expectEquals(item->controls.size(), 8);
+
+            pool.release(item);
+            expect(item->definition == nullptr, "Released instances should let go of the definition");
+            expectEquals(definition->getReferenceCount(), 1);
+
+            auto *reused = pool.acquire(createItem("unit-a", 0));
+            reused->definition = definition;
+            reused->useDefinitionControls();
+            expect(reused->controls.begin() == controlStorage, "A reused instance should fill the controls it kept");
+            expectEquals(reused->controls.size(), 8);
+            expectEquals(reused->controls[7].id, juce::String("control-7"));
+        }
+
+        beginTest("Released Instances Stop Waiting");
+        {
+            GearInstancePool pool;
+            GearDefinition::Ptr definition = new GearDefinition("unit-a", "1.0.0");
+            definition->state = GearDefinition::State::Loading;
+
+            auto *waiting = pool.acquire(createItem("unit-a", 0));
+            auto *stillWaiting = pool.acquire(createItem("unit-a", 0));
+            waiting->definition = definition;
+            stillWaiting->definition = definition;
+
+            int completions = 0;
+            definition->waiters.add(GearDefinition::Waiter{waiting, [&completions]()
+                                                           { ++completions; }});
+            definition->waiters.add(GearDefinition::Waiter{stillWaiting, [&completions]()
+                                                           { ++completions; }});
+
+            pool.release(waiting);
+            expectEquals(definition->waiters.size(), 1, "A released instance should no longer wait for the schema");
+            expect(definition->waiters[0].item == stillWaiting);
+            expectEquals(completions, 0);
+        }
+
+        beginTest("Rack Reclaims Removed Instances");
+        {
+            Rack rack(mockFetcher, mockFileSystem, cacheManager, presetManager, nullptr);
+            expect(rack.adoptGearItem(nullptr) == nullptr);
+
+            auto *first = rack.adoptGearItem(std::make_unique<GearItem>(createItem("unit-a", 2)));
+            auto *second = rack.adoptGearItem(std::make_unique<GearItem>(createItem("unit-b", 2)));
+            rack.getSlot(0)->setGearItem(first);
+            rack.getSlot(1)->setGearItem(second);
+            expectEquals(rack.getInstancePool().getNumInUse(), 2);
+
+            // Rearranging clears and refills slots without losing the instances
+            rack.rearrangeGearAsSortableList(0, 1);
+            expectEquals(rack.releaseUnusedInstances(), 0, "Rearranged instances are still placed");
+            expect(rack.getSlot(1)->getGearItem() == first);
+
+            rack.getSlot(0)->clearGearItem();
+            auto *third = rack.adoptGearItem(std::make_unique<GearItem>(createItem("unit-c", 2)));
+            expect(third == second, "The removed instance should be reused");
+            expectEquals(rack.getInstancePool().getNumAllocated(), 2);
+
+            // Items the rack does not own are left alone
+            GearItem outsider = createItem("unit-d", 0);
+            rack.getSlot(2)->setGearItem(&outsider);
+            rack.getSlot(2)->clearGearItem();
+            rack.releaseUnusedInstances();
+            expectEquals(outsider.unitId, juce::String("unit-d"));
+
+            for (int i = 0; i < rack.getNumSlots(); ++i)
+                rack.getSlot(i)->clearGearItem();
+        }
+
+        beginTest("Soak: 1,000 Preset Loads");
+        {
+            setUpLibraryMocks(mockFetcher);
+            cacheManager.saveUnitToCache("soak-eq", createSchema("soak-eq", 8));
+            cacheManager.saveUnitToCache("soak-comp", createSchema("soak-comp", 4));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+            expectEquals(library.getCatalogue().size(), 2);
+
+            Rack rack(mockFetcher, mockFileSystem, cacheManager, presetManager, &library);
+
+            // Every combination of units and slot counts the loads cycle through
+            constexpr int numLoads = 1000;
+            constexpr int maxPlaced = 4;
+            constexpr int numPresets = 6;
+            for (int p = 0; p < numPresets; ++p)
+                mockFileSystem.writeFile(mockFileSystem.joinPath(presetManager.getPresetsDirectory(), "Soak " + juce::String(p) + ".json"),
+                                         createPreset(p, maxPlaced));
+
+            int allocatedAfterWarmUp = 0;
+            bool loadedAll = true;
+            auto start = juce::Time::getMillisecondCounterHiRes();
+
+            for (int i = 0; i < numLoads; ++i)
+            {
+                loadedAll = presetManager.loadPreset("Soak " + juce::String(i % numPresets), &rack, &library) && loadedAll;
+
+                if (i == 10)
+                    allocatedAfterWarmUp = rack.getInstancePool().getNumAllocated();
+            }
+
+            auto loadMs = juce::Time::getMillisecondCounterHiRes() - start;
+            const auto &pool = rack.getInstancePool();
+
+            expect(loadedAll, "Every preset should load");
+            expectEquals(pool.getNumAllocated(), allocatedAfterWarmUp, "Loading presets should not keep allocating instances");
+            expect(pool.getNumAllocated() <= maxPlaced, "No more instances should be held than a preset places");
+            expectEquals(pool.getNumInUse(), placedByPreset((numLoads - 1) % numPresets, maxPlaced));
+            expect(rack.getNumDefinitions() <= 2, "Only the units placed should keep definitions");
+
+            auto *lastItem = rack.getSlot(0)->getGearItem();
+            expect(lastItem != nullptr);
+            if (lastItem != nullptr)
+            {
+                expectEquals(lastItem->unitId, unitForSlot((numLoads - 1) % numPresets, 0));
+                expect(lastItem->controls.size() > 1);
+                if (lastItem->controls.size() > 1)
+                    expectEquals(lastItem->getControlCurrentIndex(1), 1, "The last preset's values should be restored");
+            }
+
+            logMessage(juce::String(numLoads) + " preset loads: " + juce::String(pool.getNumAllocated()) + " instances allocated, "
+                       + juce::String(loadMs, 2) + " ms in total");
+
+            for (int i = 0; i < rack.getNumSlots(); ++i)
+                rack.getSlot(i)->clearGearItem();
+        }
+    }
+
+private:
+    /**
+     * @brief Serves a library index of the two soak test units.
+     */
+    static void setUpLibraryMocks(ConcreteMockNetworkFetcher &mockFetcher)
+    {
+        mockFetcher.setResponse(
+            "https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+            R"({
+                "units": [
+                    {
+                        "unitId": "soak-eq",
+                        "name": "Soak EQ",
+                        "manufacturer": "Test Co",
+                        "category": "equalizer",
+                        "version": "1.0.0",
+                        "schemaPath": "units/soak-eq-1.0.0.json",
+                        "thumbnailImage": "assets/thumbnails/soak-eq-1.0.0.jpg",
+                        "tags": ["eq"]
+                    },
+                    {
+                        "unitId": "soak-comp",
+                        "name": "Soak Compressor",
+                        "manufacturer": "Test Co",
+                        "category": "compressor",
+                        "version": "1.0.0",
+                        "schemaPath": "units/soak-comp-1.0.0.json",
+                        "thumbnailImage": "assets/thumbnails/soak-comp-1.0.0.jpg",
+                        "tags": ["compressor"]
+                    }
+                ]
+            })");
+    }
+
+    /**
+     * @brief Gets how many slots a soak test preset fills, between two and the maximum.
+     */
+    static int placedByPreset(int presetIndex, int maxPlaced)
+    {
+        return 2 + presetIndex % (maxPlaced - 1);
+    }
+
+    /**
+     * @brief Gets the unit a soak test preset places in a slot, alternating between presets.
+     */
+    static juce::String unitForSlot(int presetIndex, int slotIndex)
+    {
+        return (presetIndex + slotIndex) % 2 == 0 ? "soak-eq" : "soak-comp";
+    }
+
+    /**
+     * @brief Creates a preset as the preset manager saves it, with every second switch raised.
+     */
+    static juce::String createPreset(int presetIndex, int maxPlaced)
+    {
+        juce::String slots;
+        for (int s = 0; s < placedByPreset(presetIndex, maxPlaced); ++s)
+        {
+            if (s > 0)
+                slots << ",";
+
+            const auto unitId = unitForSlot(presetIndex, s);
+            slots << "{\"slotIndex\": " << s << ", \"unitId\": \"" << unitId << "\", \"sourceUnitId\": \"" << unitId
+                  << "\", \"instanceId\": \"" << unitId << "-" << presetIndex << "-" << s << "\", \"controls\": ["
+                  << "{\"index\": 0, \"value\": 0.0, \"initialValue\": 0.0, \"currentIndex\": 0},"
+                  << "{\"index\": 1, \"value\": 1.0, \"initialValue\": 0.0, \"currentIndex\": 1}]}";
+        }
+
+        return "{\"name\": \"Soak " + juce::String(presetIndex) + "\", \"timestamp\": 0, \"slots\": [" + slots + "]}";
+    }
+};
+
+static GearInstancePoolTests gearInstancePoolTests;
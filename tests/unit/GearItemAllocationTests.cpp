@@ -0,0 +1,103 @@
+/**
+ * @file GearItemAllocationTests.cpp
+ * @brief Unit tests for copying and moving gear items.
+ *
+ * This file contains unit tests checking that gear items and controls move
+ * without reallocating, that copies keep their initial values, and that
+ * creating an instance leaves the controls in place. The allocations made
+ * while loading a rack are counted by the separate allocation benchmark.
+ */
+
+#include <JuceHeader.h>
+#include "GearItem.h"
+#include "TestFixture.h"
+#include "TestHelpers.h"
+#include "MockNetworkFetcher.h"
+#include "MockFileSystem.h"
+#include <type_traits>
+
+static_assert(std::is_nothrow_move_constructible<GearControl>::value, "Controls should move without throwing");
+static_assert(std::is_nothrow_move_assignable<GearControl>::value, "Controls should move without throwing");
+static_assert(std::is_nothrow_move_constructible<GearItem>::value, "Items should move without throwing");
+static_assert(std::is_nothrow_move_assignable<GearItem>::value, "Items should move without throwing");
+
+/**
+ * @brief Unit tests for copying, moving and instancing gear items.
+ */
+class GearItemAllocationTests : public juce::UnitTest
+{
+public:
+    GearItemAllocationTests() : UnitTest("GearItemAllocationTests") {}
+
+    void runTest() override
+    {
+        TestFixture fixture;
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFetcher.reset();
+        mockFileSystem.reset();
+
+        CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+
+        beginTest("Moves Without Copying");
+        {
+            GearItem item = createItem("move-unit", 4, mockFetcher, mockFileSystem, cacheManager);
+            const auto *controlStorage = item.controls.begin();
+
+            GearItem moved(std::move(item));
+            expect(moved.controls.begin() == controlStorage, "Moving an item should take over its controls");
+            expectEquals(moved.controls.size(), 4);
+
+            GearItem assigned;
+            assigned = std::move(moved);
+            expect(assigned.controls.begin() == controlStorage, "Move assignment should take over the controls");
+            expectEquals(assigned.unitId, juce::String("move-unit"));
+
+            // Growing an array relocates the controls it holds
+            juce::Array<GearControl> controls;
+            controls.add(createControl(0));
+            const auto *optionStorage = controls.getReference(0).selector().options.begin();
+            for (int i = 1; i < 64; ++i)
+                controls.add(createControl(i));
+
+            expect(controls.getReference(0).selector().options.begin() == optionStorage, "Growing an array should move controls rather than copy them");
+        }
+
+        beginTest("Copies Keep Initial Values");
+        {
+            GearControl control = createControl(0);
+            control.initialValue = 0.25f;
+
+            GearControl copy(control);
+            expectEquals(copy.initialValue, 0.25f, "Copying should keep the schema default");
+
+            GearItem item = createItem("copy-unit", 2, mockFetcher, mockFileSystem, cacheManager);
+            item.setControlValue(0, 0.8f);
+            GearItem itemCopy(item);
+            expectEquals(itemCopy.getControlValue(0), 0.8f, "Copying should keep the control values");
+            itemCopy.setControlValue(0, 0.5f);
+            expect(item.getControlValue(0) != 0.5f, "Copies should not share control values");
+        }
+
+        beginTest("Instances Keep Their Controls In Place");
+        {
+            GearItem item = createItem("instance-unit", 3, mockFetcher, mockFileSystem, cacheManager);
+            item.controls.getReference(0).initialValue = 0.25f;
+            item.setControlValue(0, 0.7f);
+            const auto *controlStorage = item.controls.begin();
+
+            item.createInstance(item.unitId);
+            expect(item.isInstance);
+            expect(item.controls.begin() == controlStorage, "Creating an instance should not copy the controls");
+            auto firstInstanceId = item.instanceId;
+
+            item.createInstance(item.unitId);
+            expect(item.instanceId != firstInstanceId, "Re-instancing should give a new instance ID");
+            expect(item.controls.begin() == controlStorage, "Re-instancing should not copy the controls");
+            expectEquals(item.getControlValue(0), 0.7f, "Re-instancing should keep the current value");
+            expectEquals(item.controls[0].initialValue, 0.25f, "Re-instancing should keep the schema default");
+        }
+    }
+};
+
+static GearItemAllocationTests gearItemAllocationTests;
@@ -106,9 +106,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -118,9 +118,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -253,6 +253,30 @@ public:
             expect(item.isInstanceOf("la2a-compressor"), "Instance should be instance of its source unit");
             expect(!item.isInstanceOf("other-compressor"), "Instance should not be instance of different unit");
         }
+
+        beginTest("Control Layout");
+        {
+            expect(GearControl::parseOrientation("horizontal") == GearControl::Orientation::Horizontal);
+            expect(GearControl::parseOrientation("vertical") == GearControl::Orientation::Vertical);
+            expect(GearControl::parseOrientation("") == GearControl::Orientation::Horizontal, "Anything but vertical should be horizontal");
+
+            GearControl control(GearControl::Type::Switch, "Input", {0.1f, 0.1f, 0.05f, 0.05f});
+            expect(control.isVertical(), "Controls should be vertical by default");
+
+            GearControl::SwitchOptionFrame frame;
+            frame.width = 20;
+            frame.height = 40;
+            frame.value = "on";
+            control.selector().frames.add(frame);
+            control.loadedImage = juce::Image(juce::Image::ARGB, 20, 80, true);
+            control.orientation = GearControl::Orientation::Horizontal;
+
+            GearControl copy(control);
+            expect(!copy.isVertical(), "Copies should keep the orientation");
+            expectEquals(copy.selector().frames.size(), 1);
+            expectEquals(copy.selector().frames[0].value, juce::String("on"));
+            expect(copy.loadedImage == control.loadedImage, "Copies should share the decoded image");
+        }
     }
 };
 
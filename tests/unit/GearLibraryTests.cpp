@@ -6,6 +6,7 @@
 #include "MockStateVerifier.h"
 #include "PresetManager.h"
 #include "TestImageHelper.h"
+#include "TestHelpers.h"
 
 class GearLibraryTests : public juce::UnitTest
 {
@@ -116,6 +117,73 @@ public:
             })");
     }
 
+    /**
+     * @brief Serves the index, except that its first abortable fetch stalls until released.
+     *
+     * Stands in for a network fetch stuck waiting on a slow server.
+     */
+    struct StalledFetcher : public INetworkFetcher
+    {
+        StalledFetcher(const juce::String &indexToServe, bool shouldHonourAbort)
+            : index(indexToServe), honourAbort(shouldHonourAbort) {}
+
+        juce::String fetchJsonBlocking(const juce::URL &, bool &success) override
+        {
+            success = true;
+            return index;
+        }
+
+        juce::MemoryBlock fetchBinaryBlocking(const juce::URL &, bool &success) override
+        {
+            success = false;
+            return {};
+        }
+
+        juce::String fetchJsonAbortable(const juce::URL &url, bool &success, const std::function<bool()> &shouldAbort) override
+        {
+            if (stalled.exchange(true))
+                return fetchJsonBlocking(url, success);
+
+            while (!released)
+            {
+                if (honourAbort && shouldAbort())
+                {
+                    sawAbort = true;
+                    success = false;
+                    return {};
+                }
+
+                juce::Thread::sleep(1);
+            }
+
+            // The stale index a superseded load would install if it were not dropped
+            success = true;
+            return R"({"units": []})";
+        }
+
+        juce::String index;                  ///< The index served to every fetch but the first
+        bool honourAbort;                    ///< Whether the stalled fetch gives up when asked
+        std::atomic<bool> stalled{false};    ///< Set once the first fetch has started
+        std::atomic<bool> released{false};   ///< Lets the stalled fetch return
+        std::atomic<bool> sawAbort{false};   ///< Set when the stalled fetch gave up
+    };
+
+    /**
+     * @brief Polls a flag until it is set.
+     */
+    static bool waitFor(const std::atomic<bool> &flag, int timeoutMs)
+    {
+        for (auto start = juce::Time::getMillisecondCounter(); !flag;)
+        {
+            if ((int)(juce::Time::getMillisecondCounter() - start) >= timeoutMs)
+                return false;
+
+            juce::Thread::sleep(1);
+        }
+
+        return true;
+    }
+
     void runTest() override
     {
         TestFixture fixture;
@@ -133,19 +201,18 @@ public:
 
             GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
             library.loadLibrary();
-            expectEquals(library.getItems().size(), 1, "Library should have one item after loading");
+            expectEquals(library.getCatalogue().size(), 1, "Library should have one item after loading");
 
-            // Verify image can be loaded on demand
-            if (library.getItems().size() > 0)
+            // Verify image can be loaded on demand, off the message thread
+            if (library.getCatalogue().size() > 0)
             {
-                auto &item = const_cast<GearItem &>(library.getItems().getReference(0));
-
-                // Explicitly load image for this test
-                item.loadImage();
+                expect(!library.getThumbnail(0).isValid(), "Thumbnail should not be loaded while painting");
+                expect(library.waitForThumbnails(5000), "Thumbnail should load in the background");
+                auto image = library.getThumbnail(0);
 
-                expect(item.image.isValid(), "Gear item should have a valid image");
-                expectEquals(item.image.getWidth(), 24, "Image width should be 24");
-                expectEquals(item.image.getHeight(), 24, "Image height should be 24");
+                expect(image.isValid(), "Gear item should have a valid image");
+                expectEquals(image.getWidth(), 24, "Image width should be 24");
+                expectEquals(image.getHeight(), 24, "Image height should be 24");
             }
         }
 
@@ -158,13 +225,13 @@ public:
             GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
             library.loadLibrary();
             library.addItem("test-gear-2", "Test Gear 2", "equalizer", "A test gear item", "Test Co 2", true);
-            expectEquals(library.getItems().size(), 2, "Library should have exactly one item after adding");
-            expectEquals(library.getItems()[0].name, juce::String("LA-2A Tube Compressor"), "Default Item name should match");
-            expectEquals(library.getItems()[0].manufacturer, juce::String("Universal Audio"), "Default Manufacturer should match");
-            expectEquals(library.getItems()[0].categoryString, juce::String("compressor"), "Default Category should match");
-            expectEquals(library.getItems()[1].name, juce::String("Test Gear 2"), "Added Item name should match");
-            expectEquals(library.getItems()[1].manufacturer, juce::String("Test Co 2"), "Added Manufacturer should match");
-            expectEquals(library.getItems()[1].categoryString, juce::String("equalizer"), "Added Category should match");
+            expectEquals(library.getCatalogue().size(), 2, "Library should have exactly one item after adding");
+            expectEquals(library.getCatalogue()[0].name, juce::String("LA-2A Tube Compressor"), "Default Item name should match");
+            expectEquals(library.getCatalogue()[0].manufacturer, juce::String("Universal Audio"), "Default Manufacturer should match");
+            expectEquals(library.getCatalogue()[0].categoryString, juce::String("compressor"), "Default Category should match");
+            expectEquals(library.getCatalogue()[1].name, juce::String("Test Gear 2"), "Added Item name should match");
+            expectEquals(library.getCatalogue()[1].manufacturer, juce::String("Test Co 2"), "Added Manufacturer should match");
+            expectEquals(library.getCatalogue()[1].categoryString, juce::String("equalizer"), "Added Category should match");
         }
 
         beginTest("Item Retrieval");
@@ -176,10 +243,15 @@ public:
             GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
             library.loadLibrary();
             library.addItem("test-gear", "Test Gear", "preamp", "A test gear item", "Test Co", true);
-            auto *item = library.getGearItem(1);
+            auto item = library.createGearItem(1, mockFetcher, mockFileSystem, cacheManager);
             expect(item != nullptr);
-            expectEquals(item->categoryString, juce::String("preamp"), "Retrieved item name should match");
-            expect(library.getGearItem(999) == nullptr);
+            if (item != nullptr)
+            {
+                expectEquals(item->categoryString, juce::String("preamp"), "Retrieved item name should match");
+                expect(item->category == GearCategory::Preamp, "Category enum should be derived from the string");
+                expect(!item->isInstance, "Created item should not be an instance yet");
+            }
+            expect(library.createGearItem(999, mockFetcher, mockFileSystem, cacheManager) == nullptr);
         }
 
         beginTest("URL Construction");
@@ -202,7 +274,7 @@ public:
             GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
             library.loadLibrary();
 
-            expectEquals(library.getItems().size(), 1, "Library should have one item after loading");
+            expectEquals(library.getCatalogue().size(), 1, "Library should have one item after loading");
             expect(mockFetcher.wasUrlRequested("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json"), "Library should request units/index.json");
         }
 
@@ -218,7 +290,7 @@ public:
             // Wait for async operation to complete
             juce::Thread::sleep(100);
 
-            expect(library.getItems().isEmpty(), "Library should be empty after failed load");
+            expect(library.getCatalogue().isEmpty(), "Library should be empty after failed load");
             expect(mockFetcher.wasUrlRequested("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json"), "Library should attempt to request units/index.json");
         }
 
@@ -237,7 +309,7 @@ public:
             library.addItem("test-compressor", "Test Compressor", "compressor", "Test description", "Test Manufacturer", true);
 
             // Get the items to access their unit IDs
-            const auto &items = library.getItems();
+            const auto &items = library.getCatalogue();
             expectEquals(items.size(), 2, "Should have 2 items");
 
             // Add items to recently used
@@ -264,7 +336,7 @@ public:
             library.addItem("test-compressor-2", "Test Compressor", "compressor", "Test description", "Test Manufacturer", true);
 
             // Get the items to access their unit IDs
-            const auto &items = library.getItems();
+            const auto &items = library.getCatalogue();
             expectEquals(items.size(), 2, "Should have 2 items");
 
             // Add items to favorites
@@ -278,6 +350,360 @@ public:
             library.clearFavorites();
             expectEquals(cacheManager.getFavorites().size(), 0, "Favorites should be cleared");
         }
+
+        beginTest("Search Keys");
+        {
+            MockStateVerifier::resetAndVerify("Search Keys");
+            setUpLA2AMocks();
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+            library.addItem("test-1176", "1176 Rev-A", "compressor", "Test description", "Universal Audio", true);
+
+            expectEquals(library.findMatchingItems("la2a").size(), 1, "Separators should be ignored in names");
+            expectEquals(library.findMatchingItems("LA-2A").size(), 1, "Case and separators should be ignored in queries");
+            expectEquals(library.findMatchingItems("universal audio").size(), 2, "Manufacturer should be searchable");
+            expectEquals(library.findMatchingItems("optical").size(), 1, "Tags should be searchable");
+            expectEquals(library.findMatchingItems("1176 rev a")[0], 1, "Added items should be searchable");
+            expect(library.findMatchingItems("tubeuniversal").isEmpty(), "Matches should not span fields");
+            expectEquals(library.findMatchingItems("").size(), 2, "Empty search should match everything");
+        }
+
+        beginTest("Unit ID Lookup");
+        {
+            MockStateVerifier::resetAndVerify("Unit ID Lookup");
+
+            constexpr int unitCount = 50;
+            mockFetcher.setResponse("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+                                    createSyntheticCatalogue(unitCount));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            expectEquals(library.getItemIndexByUnitId("synthetic-0"), 0, "First unit should be indexed after parsing");
+            expectEquals(library.getItemIndexByUnitId("synthetic-49"), 49, "Last unit should be indexed after parsing");
+            expectEquals(library.getItemIndexByUnitId("missing-unit"), -1, "Unknown unit should not be found");
+            expect(library.createGearItemByUnitId("missing-unit", mockFetcher, mockFileSystem, cacheManager) == nullptr,
+                   "Unknown unit should return nullptr");
+
+            library.addItem("added-unit", "Added Unit", "compressor", "Test description", "Test Manufacturer", true);
+            expectEquals(library.getItemIndexByUnitId("added-unit"), unitCount, "Added unit should be indexed");
+            auto addedItem = library.createGearItemByUnitId("added-unit", mockFetcher, mockFileSystem, cacheManager);
+            expect(addedItem != nullptr && addedItem->name == "Added Unit", "Lookup should return the added item");
+
+            library.addItem("synthetic-5", "Duplicate", "compressor", "Test description", "Test Manufacturer", true);
+            expectEquals(library.getItemIndexByUnitId("synthetic-5"), 5, "The first item with a unit ID should win");
+
+            expect(library.getItemIndicesByUnitIds({"synthetic-42", "missing-unit", "synthetic-7", "synthetic-42"}) == juce::Array<int>({7, 42}),
+                   "Indices should be in catalogue order without unknown or duplicate IDs");
+
+            bool allFound = true;
+            for (int i = 0; i < unitCount; ++i)
+                allFound = allFound && library.getItemIndexByUnitId("synthetic-" + juce::String(i)) == i;
+            expect(allFound, "Every unit should be found at its catalogue index");
+        }
+
+        beginTest("Facet Filters");
+        {
+            MockStateVerifier::resetAndVerify("Facet Filters");
+
+            constexpr int unitCount = 100;
+            mockFetcher.setResponse("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+                                    createSyntheticCatalogue(unitCount));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+            library.addItem("api-525", "API 525 500 Series", "compressor", "Test description", "API", true);
+
+            using Facet = GearFacetIndex::Facet;
+            GearFacetIndex::Filter filter;
+            filter.setValues(Facet::Type, {"500Series"});
+            filter.setValues(Facet::Category, {"compressor"});
+            expect(library.findMatchingItems("", filter) == juce::Array<int>({unitCount}), "Only the added unit is a 500-series compressor");
+
+            filter.clear();
+            filter.setValues(Facet::Manufacturer, {"Neve", "API"});
+            filter.setValues(Facet::Category, {"compressor"});
+
+            auto scan = [&library](const juce::String &name)
+            {
+                juce::Array<int> matches;
+                const auto &items = library.getCatalogue();
+                for (int i = 0; i < items.size(); ++i)
+                {
+                    const auto &item = items[i];
+                    if ((item.manufacturer == "Neve" || item.manufacturer == "API") && item.categoryString == "compressor" &&
+                        item.name.contains(name))
+                        matches.add(i);
+                }
+                return matches;
+            };
+
+            expect(library.findMatchingItems("", filter) == scan(""), "Facet filter should match a scan");
+            expect(library.findMatchingItems("1176", filter) == scan("1176"), "Text and facets should combine");
+
+            library.setFacetFilter(filter);
+            const auto &result = library.getFacetResult();
+            expectEquals(result.numMatches, scan("").size(), "Tree filter should publish its matches");
+
+            int totalManufacturerCount = 0;
+            for (const auto &valueCount : result.counts[(int)Facet::Manufacturer])
+                totalManufacturerCount += valueCount.count;
+
+            int compressorCount = 0;
+            for (const auto &item : library.getCatalogue())
+                compressorCount += item.categoryString == "compressor" ? 1 : 0;
+
+            expectEquals(totalManufacturerCount, compressorCount, "Manufacturer counts should ignore the manufacturer selection");
+
+            library.setFacetFilter({});
+            expectEquals(library.getFacetResult().numMatches, unitCount + 1, "Clearing the filter should match every unit");
+        }
+
+        beginTest("Search Matches Per-Item Normalisation");
+        {
+            MockStateVerifier::resetAndVerify("Search Matches Per-Item Normalisation");
+
+            constexpr int unitCount = 100;
+            mockFetcher.setResponse("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+                                    createSyntheticCatalogue(unitCount));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+            expectEquals(library.getCatalogue().size(), unitCount, "Synthetic catalogue should load");
+
+            // Every prefix of a typed query, as searchBox.onTextChange sees it
+            const juce::String typedQuery = "1176 rev 8";
+            for (int length = 1; length <= typedQuery.length(); ++length)
+            {
+                auto keystroke = typedQuery.substring(0, length);
+                expect(library.findMatchingItems(keystroke) == scanWithoutSearchKeys(library.getCatalogue(), keystroke),
+                       "Precomputed keys should give the same matches as per-item normalisation for \"" + keystroke + "\"");
+            }
+            expect(library.findMatchingItems(typedQuery).size() > 0, "Full query should match some units");
+        }
+
+        beginTest("Lazy Tree Population");
+        {
+            MockStateVerifier::resetAndVerify("Lazy Tree Population");
+
+            constexpr int unitCount = 40;
+            mockFetcher.setResponse("https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json",
+                                    createSyntheticCatalogue(unitCount));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            auto *root = library.getRootTreeItem();
+            expect(root != nullptr, "Library should have a tree");
+
+            GearTreeItem *categoriesNode = nullptr;
+            for (int i = 0; i < root->getNumSubItems(); ++i)
+                if (auto *item = dynamic_cast<GearTreeItem *>(root->getSubItem(i)))
+                    if (item->getItemText() == "Categories")
+                        categoriesNode = item;
+
+            expect(categoriesNode != nullptr, "Tree should have a Categories section");
+            expectEquals(categoriesNode->getNumSubItems(), 0, "Closed Categories section should have no rows");
+
+            categoriesNode->setOpen(true);
+            expectEquals(categoriesNode->getNumSubItems(), 4, "Opening Categories should add one row per category");
+
+            auto *compressors = dynamic_cast<GearTreeItem *>(categoriesNode->getSubItem(0));
+            expect(compressors != nullptr, "Category row should be a GearTreeItem");
+            expectEquals(compressors->getNumSubItems(), 0, "Closed category should have no gear rows");
+            expectEquals(compressors->getItemIndices().size(), unitCount / 4, "Category should know its items without creating rows");
+
+            compressors->setOpen(true);
+            expectEquals(compressors->getNumSubItems(), unitCount / 4, "Opening a category should create its gear rows");
+
+            auto *firstGear = dynamic_cast<GearTreeItem *>(compressors->getSubItem(0));
+            expect(firstGear != nullptr && firstGear->getItemIndex() == compressors->getItemIndices()[0],
+                   "Gear rows should point at the indexed items");
+
+            compressors->setOpen(false);
+            expectEquals(compressors->getNumSubItems(), 0, "Closing a category should release its gear rows");
+        }
+
+        beginTest("Incremental Refresh");
+        {
+            MockStateVerifier::resetAndVerify("Incremental Refresh");
+
+            constexpr int unitCount = 100;
+            const juce::String indexUrl = "https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json";
+            const auto originalIndex = createSyntheticCatalogue(unitCount);
+            mockFetcher.setResponse(indexUrl, originalIndex);
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            library.loadLibrary();
+
+            auto *root = library.getRootTreeItem();
+            GearTreeItem *categoriesNode = nullptr;
+            for (int i = 0; i < root->getNumSubItems(); ++i)
+                if (auto *item = dynamic_cast<GearTreeItem *>(root->getSubItem(i)))
+                    if (item->getItemText() == "Categories")
+                        categoriesNode = item;
+
+            expect(categoriesNode != nullptr, "Tree should have a Categories section");
+            if (categoriesNode != nullptr)
+                categoriesNode->setOpen(true);
+
+            auto *compressors = categoriesNode != nullptr ? dynamic_cast<GearTreeItem *>(categoriesNode->getSubItem(0)) : nullptr;
+            expect(compressors != nullptr && compressors->getItemText() == "Compressor", "First group should be the compressors");
+
+            if (compressors != nullptr)
+            {
+                compressors->setOpen(true);
+                auto *firstRow = compressors->getSubItem(0);
+
+                // Refreshing an unchanged index leaves the tree alone
+                library.loadLibrary();
+                expect(library.getRootTreeItem() == root, "Root should be kept");
+                expect(categoriesNode->isOpen() && compressors->isOpen(), "Open groups should stay open");
+                expect(compressors->getSubItem(0) == firstRow, "Rows of an unchanged index should not be rebuilt");
+
+                // Remove a compressor, rename another and add a unit in a new category
+                auto parsed = juce::JSON::parse(originalIndex);
+                auto *units = parsed["units"].getArray();
+                units->remove(4);
+                if (auto *renamed = units->getReference(7).getDynamicObject())
+                    renamed->setProperty("name", "Renamed Unit");
+                juce::DynamicObject::Ptr added = new juce::DynamicObject();
+                added->setProperty("unitId", "new-limiter");
+                added->setProperty("name", "New Limiter");
+                added->setProperty("category", "limiter");
+                added->setProperty("version", "1.0.0");
+                units->add(juce::var(added.get()));
+                mockFetcher.setResponse(indexUrl, juce::JSON::toString(parsed));
+
+                // A unit that is neither removed nor renamed
+                GearTreeItem *untouchedRow = nullptr;
+                for (int i = 0; i < compressors->getNumSubItems() && untouchedRow == nullptr; ++i)
+                    if (auto *row = dynamic_cast<GearTreeItem *>(compressors->getSubItem(i)))
+                        if (library.getCatalogue()[row->getItemIndex()].unitId == "synthetic-0")
+                            untouchedRow = row;
+                expect(untouchedRow != nullptr, "The compressors should include synthetic-0");
+
+                library.loadLibrary();
+                expectEquals(library.getCatalogue().size(), unitCount, "One unit should be removed and one added");
+
+                bool untouchedRowKept = false;
+                for (int i = 0; i < compressors->getNumSubItems(); ++i)
+                    untouchedRowKept = untouchedRowKept || compressors->getSubItem(i) == untouchedRow;
+                expect(untouchedRowKept, "Rows of unchanged units should survive a removal elsewhere in their group");
+                if (untouchedRowKept)
+                    expectEquals(library.getCatalogue()[untouchedRow->getItemIndex()].unitId, juce::String("synthetic-0"),
+                                 "Kept rows should be re-pointed at their unit's new index");
+                expect(categoriesNode->getSubItem(0) == compressors, "Existing groups should be kept");
+                expect(categoriesNode->isOpen() && compressors->isOpen(), "Open groups should stay open after a change");
+                expectEquals(compressors->getNumSubItems(), unitCount / 4 - 1, "Removed unit should leave its group");
+                expectEquals(categoriesNode->getNumSubItems(), 5, "New category should get a group");
+                auto *limiters = dynamic_cast<GearTreeItem *>(categoriesNode->getSubItem(4));
+                expect(limiters != nullptr && limiters->getItemText() == "Limiter", "New group should follow the existing ones");
+
+                bool renamedShown = false;
+                for (int i = 0; i < compressors->getNumSubItems(); ++i)
+                    if (auto *row = dynamic_cast<GearTreeItem *>(compressors->getSubItem(i)))
+                        renamedShown = renamedShown || row->getItemText() == "Renamed Unit";
+                expect(renamedShown, "Changed unit should show its new name");
+
+                auto *leftoverRow = dynamic_cast<GearTreeItem *>(compressors->getSubItem(0));
+                expect(leftoverRow != nullptr && library.getCatalogue()[leftoverRow->getItemIndex()].categoryString == "compressor",
+                       "Rows should point at the new entries");
+            }
+
+            mockFetcher.setResponse(indexUrl, originalIndex);
+        }
+
+        beginTest("Async Load");
+        {
+            MockStateVerifier::resetAndVerify("Async Load");
+
+            constexpr int unitCount = 40;
+            const juce::String indexUrl = "https://raw.githubusercontent.com/mazureth/analogiq-schemas/main/units/index.json";
+            mockFetcher.setResponse(indexUrl, createSyntheticCatalogue(unitCount));
+
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+
+            int callbacksRun = 0;
+            library.loadLibraryAsync();
+
+            library.callWhenLoaded([&callbacksRun]
+                                   { ++callbacksRun; });
+            expectEquals(callbacksRun, 0, "Callback should wait for the load to be installed");
+
+            expect(library.waitForLibraryLoad(30000), "Load should finish");
+
+            expectEquals(callbacksRun, 1, "Callback should run once the load is installed");
+            expectEquals(library.getCatalogue().size(), unitCount, "Every unit should be loaded");
+            expectEquals(library.getItemIndexByUnitId("synthetic-39"), 39, "Loaded units should be indexed");
+            expectEquals(library.findMatchingItems("vintage").size(), unitCount, "Loaded units should be searchable");
+
+            library.callWhenLoaded([&callbacksRun]
+                                   { ++callbacksRun; });
+            expectEquals(callbacksRun, 2, "Callback should run at once when nothing is loading");
+
+            // A newer load replaces one still in progress
+            library.loadLibraryAsync();
+            library.loadLibraryAsync();
+            expect(library.waitForLibraryLoad(30000), "Restarted load should finish");
+            expectEquals(library.getCatalogue().size(), unitCount, "Restarted load should install one catalogue");
+
+            // A failed load keeps the items already shown
+            mockFetcher.setResponse(indexUrl, R"({"units": [)");
+            library.loadLibraryAsync();
+            library.callWhenLoaded([&callbacksRun]
+                                   { ++callbacksRun; });
+            expect(library.waitForLibraryLoad(30000), "Failed load should finish");
+            expectEquals(callbacksRun, 3, "Callback should run after a failed load too");
+            expectEquals(library.getCatalogue().size(), unitCount, "Failed load should keep the current items");
+
+            mockFetcher.setResponse(indexUrl, createSyntheticCatalogue(unitCount));
+        }
+
+        beginTest("Abandoned Loads Do Not Block");
+        {
+            MockStateVerifier::resetAndVerify("Abandoned Loads Do Not Block");
+            const juce::String index = createSyntheticCatalogue(10);
+
+            // A fetch that ignores the abort keeps its thread, but not the message thread
+            {
+                StalledFetcher stalledFetcher(index, false);
+                GearLibrary library(stalledFetcher, mockFileSystem, cacheManager, presetManager);
+
+                library.loadLibraryAsync();
+                expect(waitFor(stalledFetcher.stalled, 5000), "The first fetch should stall");
+
+                auto start = juce::Time::getMillisecondCounterHiRes();
+                library.loadLibraryAsync();
+                auto restartMs = juce::Time::getMillisecondCounterHiRes() - start;
+
+                expect(library.waitForLibraryLoad(5000), "The newer load should finish while the old fetch is stuck");
+                expectEquals(library.getCatalogue().size(), 10, "The newer load should be installed");
+                expect(!stalledFetcher.released, "The old fetch should still be stuck");
+
+                stalledFetcher.released = true;
+                juce::Thread::sleep(50);
+                library.waitForLibraryLoad(0);
+                expectEquals(library.getCatalogue().size(), 10, "The abandoned load should never be installed");
+
+                logMessage("Restarting a load behind a stalled fetch returned in " + juce::String(restartMs, 3) + " ms");
+            }
+
+            // A fetch that polls the abort check stops as soon as its load is superseded
+            {
+                StalledFetcher stalledFetcher(index, true);
+                GearLibrary library(stalledFetcher, mockFileSystem, cacheManager, presetManager);
+
+                library.loadLibraryAsync();
+                expect(waitFor(stalledFetcher.stalled, 5000), "The first fetch should stall");
+
+                library.loadLibraryAsync();
+                expect(waitFor(stalledFetcher.sawAbort, 5000), "The superseded fetch should give up");
+                expect(library.waitForLibraryLoad(5000), "The newer load should finish");
+                expectEquals(library.getCatalogue().size(), 10);
+            }
+        }
     }
 };
 
@@ -0,0 +1,103 @@
+/**
+ * @file GearSearchIndexTests.cpp
+ * @brief Unit tests for the GearSearchIndex class.
+ *
+ * This file contains unit tests for the trigram index used by the gear
+ * library search, checking its results against a plain substring scan.
+ */
+
+#include <JuceHeader.h>
+#include "GearSearchIndex.h"
+
+/**
+ * @brief Unit tests for the GearSearchIndex class.
+ */
+class GearSearchIndexTests : public juce::UnitTest
+{
+public:
+    GearSearchIndexTests() : UnitTest("GearSearchIndexTests") {}
+
+    void runTest() override
+    {
+        beginTest("Finds Substrings");
+        {
+            GearSearchIndex index;
+            expectEquals(index.addEntry("la2a\nteletronix\ncompressor"), 0);
+            expectEquals(index.addEntry("1176\nuniversalaudio\ncompressor\nfet"), 1);
+            expectEquals(index.addEntry("pultec\npultec\nequalizer\ntube"), 2);
+            expectEquals(index.size(), 3);
+
+            expect(index.find("compressor") == juce::Array<int>({0, 1}), "Shared field should match both compressors");
+            expect(index.find("1176") == juce::Array<int>({1}), "Model number should match one item");
+            expect(index.find("ultec") == juce::Array<int>({2}), "Infix should match");
+            expect(index.find("fet") == juce::Array<int>({1}), "Tag should match");
+            expect(index.find("missing").isEmpty(), "Unknown trigram should match nothing");
+            expect(index.find("").size() == 3, "Empty query should match everything");
+            expect(index.find("2a") == juce::Array<int>({0}), "Short query should fall back to a scan");
+        }
+
+        beginTest("Verifies Candidates");
+        {
+            GearSearchIndex index;
+            index.addEntry("abcxbcd");
+
+            // Both trigrams of "abcd" are present, but not next to each other
+            expect(index.find("abcd").isEmpty(), "Scattered trigrams should not match");
+            expect(index.find("bcd") == juce::Array<int>({0}), "Contiguous trigram should match");
+        }
+
+        beginTest("Ignores Field Boundaries");
+        {
+            GearSearchIndex index;
+            index.addEntry("neve\namek");
+
+            expect(index.find("vea").isEmpty(), "Query should not span two fields");
+            expect(index.find("eve") == juce::Array<int>({0}), "Field end should match");
+            expect(index.find("ame") == juce::Array<int>({0}), "Field start should match");
+        }
+
+        beginTest("Clear");
+        {
+            GearSearchIndex index;
+            index.addEntry("distressor");
+            index.clear();
+            expectEquals(index.size(), 0);
+            expect(index.find("distressor").isEmpty(), "Cleared index should match nothing");
+            expect(index.getKey(0).isEmpty(), "Out of range key should be empty");
+        }
+
+        beginTest("Matches Linear Scan");
+        {
+            juce::Random random(1234);
+            const juce::StringArray words{"comp", "eq", "pre", "amp", "tube", "fet", "opto", "vari", "mu", "1176", "la2a", "api", "neve", "ssl"};
+
+            GearSearchIndex index;
+            juce::StringArray keys;
+            for (int i = 0; i < 2000; ++i)
+            {
+                juce::String key;
+                for (int field = 0; field < 3; ++field)
+                {
+                    if (field > 0)
+                        key << '\n';
+                    key << words[random.nextInt(words.size())] << words[random.nextInt(words.size())];
+                }
+                keys.add(key);
+                index.addEntry(key);
+            }
+
+            const juce::StringArray queries{"c", "tu", "fet", "opto", "eqpre", "1176la", "ssla", "mumu", "zzz", "pa"};
+            for (const auto &query : queries)
+            {
+                juce::Array<int> expected;
+                for (int i = 0; i < keys.size(); ++i)
+                    if (keys[i].contains(query))
+                        expected.add(i);
+
+                expect(index.find(query) == expected, "Index should match the scan for \"" + query + "\"");
+            }
+        }
+    }
+};
+
+static GearSearchIndexTests gearSearchIndexTests;
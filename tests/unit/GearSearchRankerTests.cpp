@@ -0,0 +1,98 @@
+/**
+ * @file GearSearchRankerTests.cpp
+ * @brief Unit tests for the GearSearchRanker class.
+ *
+ * This file contains unit tests for ranked fuzzy search: field scoring,
+ * typo tolerance, multi-word queries and top-K selection.
+ */
+
+#include <JuceHeader.h>
+#include "GearSearchRanker.h"
+
+/**
+ * @brief Unit tests for the GearSearchRanker class.
+ */
+class GearSearchRankerTests : public juce::UnitTest
+{
+public:
+    GearSearchRankerTests() : UnitTest("GearSearchRankerTests") {}
+
+    void runTest() override
+    {
+        beginTest("Field Scores");
+        {
+            expectEquals(GearSearchRanker::scoreField("1176", "1176"), GearSearchRanker::SCORE_WHOLE_FIELD);
+            expectEquals(GearSearchRanker::scoreField("1176", "1176ln"), GearSearchRanker::SCORE_PREFIX);
+            expectEquals(GearSearchRanker::scoreField("ln", "1176ln"), GearSearchRanker::SCORE_SUBSTRING);
+
+            auto subsequence = GearSearchRanker::scoreField("dstrsr", "distressor");
+            expect(subsequence > 0 && subsequence <= GearSearchRanker::SCORE_SUBSEQUENCE, "Subsequence should score below a substring");
+
+            expectEquals(GearSearchRanker::scoreField("pultek", "pultec"), GearSearchRanker::SCORE_TYPO, "One substitution should match");
+            expectEquals(GearSearchRanker::scoreField("xyz", "pultec"), 0, "Unrelated word should not match");
+            expectEquals(GearSearchRanker::scoreField("pul", "pltc"), 0, "Short words should not match approximately");
+        }
+
+        beginTest("Edit Distance");
+        {
+            expectEquals(GearSearchRanker::substringEditDistance("neve", "rupertneve1073", 2), 0);
+            expectEquals(GearSearchRanker::substringEditDistance("nave", "rupertneve1073", 2), 1);
+            expectEquals(GearSearchRanker::substringEditDistance("distresor", "distressor", 2), 1);
+            expectEquals(GearSearchRanker::substringEditDistance("qqqqqq", "distressor", 2), 3, "Distances above the limit should be capped");
+            expectEquals(GearSearchRanker::getMaxTypos(3), 0);
+            expectEquals(GearSearchRanker::getMaxTypos(5), 1);
+            expectEquals(GearSearchRanker::getMaxTypos(9), 2);
+        }
+
+        beginTest("Split Into Words");
+        {
+            auto words = GearSearchRanker::splitIntoWords("  1176  Blue-Stripe ", [](const juce::String &word)
+                                                          { return word.toLowerCase().removeCharacters("-"); });
+            expect(words == juce::StringArray({"1176", "bluestripe"}), "Words should be split on spaces and normalised");
+            expect(GearSearchRanker::splitIntoWords("- -", [](const juce::String &word)
+                                                    { return word.removeCharacters("-"); })
+                       .isEmpty(),
+                   "Words that normalise to nothing should be dropped");
+        }
+
+        beginTest("Ranks Across Fields");
+        {
+            GearSearchIndex index;
+            index.addEntry("1176ln\nuniversalaudio\ncompressor\nfet\nblue");       // 0
+            index.addEntry("1176rev\nuniversalaudio\ncompressor\nfet\nbluestripe"); // 1
+            index.addEntry("la2a\nteletronix\ncompressor\nopto");                  // 2
+            index.addEntry("blue\nbluecompany\nmicrophone");                        // 3
+
+            GearSearchRanker ranker;
+            juce::StringArray words{"1176", "blue"};
+
+            auto ranked = ranker.rank(index, index.find("1176blue"), words);
+            expect(ranked == juce::Array<int>({0, 1}), "Words spread over name and tags should match, best tag match first");
+
+            ranked = ranker.rank(index, {}, {"teletronx"});
+            expect(ranked == juce::Array<int>({2}), "Manufacturer typo should still match");
+
+            ranked = ranker.rank(index, {}, {"blue"});
+            expectEquals(ranked.getFirst(), 3, "Name match should outrank tag matches");
+
+            expectEquals(ranker.scoreKey(index.getKey(2), {"1176"}), 0, "Missing word should not match");
+        }
+
+        beginTest("Top K");
+        {
+            GearSearchIndex index;
+            for (int i = 0; i < 1000; ++i)
+                index.addEntry("unit" + juce::String(i) + "\nmaker\ncompressor");
+
+            GearSearchRanker ranker;
+            auto ranked = ranker.rank(index, index.find("unit"), {"unit"}, 5);
+            expectEquals(ranked.size(), 5, "Results should be capped");
+            expect(ranked == juce::Array<int>({0, 1, 2, 3, 4}), "Ties should keep catalogue order");
+
+            ranked = ranker.rank(index, index.find("unit99"), {"unit99"}, 3);
+            expectEquals(ranked.getFirst(), 99, "Whole-field match should outrank prefixes");
+        }
+    }
+};
+
+static GearSearchRankerTests gearSearchRankerTests;
@@ -0,0 +1,136 @@
+/**
+ * @file GearSearchWorkerTests.cpp
+ * @brief Unit tests for the GearSearchWorker class.
+ *
+ * This file contains unit tests for the debounced background search,
+ * covering coalescing of rapid queries, refinement of previous results,
+ * the fuzzy fallback and cancellation.
+ */
+
+#include <JuceHeader.h>
+#include "GearSearchWorker.h"
+
+/**
+ * @brief Unit tests for the GearSearchWorker class.
+ */
+class GearSearchWorkerTests : public juce::UnitTest
+{
+public:
+    GearSearchWorkerTests() : UnitTest("GearSearchWorkerTests") {}
+
+    void runTest() override
+    {
+        auto index = std::make_shared<GearSearchIndex>();
+        for (int i = 0; i < 5000; ++i)
+        {
+            juce::String key;
+            key << "model" << i << "\nmaker" << (i % 13) << "\ncompressor";
+            index->addEntry(key);
+        }
+
+        beginTest("Delivers Only The Final Query");
+        {
+            GearSearchWorker worker(50, 1000);
+            juce::Array<GearSearchWorker::Result> results;
+            worker.onResult = [&results](const GearSearchWorker::Result &result)
+            { results.add(result); };
+
+            // Typed faster than the debounce interval
+            for (auto query : {"m", "mo", "mod", "mode", "model", "model1", "model12"})
+                worker.search(index, query);
+
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            expectEquals(results.size(), 1, "Only one result should be delivered");
+            expectEquals(results.getFirst().query, juce::String("model12"), "The final query should win");
+            expect(sorted(results.getFirst().matches) == index->find("model12"), "Matches should equal a direct search");
+            expectEquals(results.getFirst().matches.getFirst(), 12, "Whole-field match should rank first");
+        }
+
+        beginTest("Refines Extended Queries");
+        {
+            GearSearchWorker worker(0, 1000);
+            juce::Array<GearSearchWorker::Result> results;
+            worker.onResult = [&results](const GearSearchWorker::Result &result)
+            { results.add(result); };
+
+            worker.search(index, "maker1");
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            worker.search(index, "maker12");
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            worker.search(index, "model7");
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            expectEquals(results.size(), 3, "Every settled query should be delivered");
+            expect(!results[0].refined, "First query should search the index");
+            expect(results[1].refined, "Extended query should refine the previous matches");
+            expect(sorted(results[1].matches) == index->find("maker12"), "Refined matches should equal a direct search");
+            expect(!results[2].refined, "Unrelated query should search the index");
+
+            // A new index invalidates the previous matches
+            auto otherIndex = std::make_shared<GearSearchIndex>(*index);
+            worker.search(otherIndex, "model77");
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+            expect(!results.getLast().refined, "Query on a new index should not refine");
+        }
+
+        beginTest("Falls Back To Fuzzy Matching");
+        {
+            GearSearchWorker worker(0, 10);
+            juce::Array<GearSearchWorker::Result> results;
+            worker.onResult = [&results](const GearSearchWorker::Result &result)
+            { results.add(result); };
+
+            // A typo and words from two fields
+            worker.search(index, "compresor", {"compresor"});
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            worker.search(index, "model42maker3", {"model42", "maker3"});
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.deliverPendingResult();
+
+            expectEquals(results.size(), 2);
+            expect(results[0].fuzzy && results[0].matches.size() == 10, "Typo should still match, capped at the result limit");
+            expect(results[1].fuzzy, "Words from separate fields are not a substring of any key");
+            expectEquals(results[1].matches.getFirst(), 42, "Item matching both words best should rank first");
+        }
+
+        beginTest("Cancel");
+        {
+            GearSearchWorker worker(20);
+            int deliveries = 0;
+            worker.onResult = [&deliveries](const GearSearchWorker::Result &)
+            { ++deliveries; };
+
+            worker.search(index, "compressor");
+            worker.cancel();
+            expect(worker.waitUntilIdle(5000), "Worker should become idle");
+            worker.deliverPendingResult();
+            expectEquals(deliveries, 0, "Cancelled query should not be delivered");
+
+            // Superseded after completing but before delivery
+            worker.search(index, "model1");
+            expect(worker.waitUntilIdle(5000), "Worker should finish");
+            worker.cancel();
+            worker.deliverPendingResult();
+            expectEquals(deliveries, 0, "Result cancelled before delivery should be dropped");
+        }
+    }
+
+private:
+    static juce::Array<int> sorted(juce::Array<int> values)
+    {
+        values.sort();
+        return values;
+    }
+};
+
+static GearSearchWorkerTests gearSearchWorkerTests;
@@ -0,0 +1,188 @@
+/**
+ * @file GearThumbnailLoaderTests.cpp
+ * @brief Unit tests for the GearThumbnailLoader class.
+ *
+ * This file contains unit tests for background thumbnail loading, covering
+ * delivery on the message thread, newest-first ordering, deduplication,
+ * dropping of stale requests, cancellation and requests made while a
+ * cancelled load finishes.
+ */
+
+#include <JuceHeader.h>
+#include "GearThumbnailLoader.h"
+#include <atomic>
+
+/**
+ * @brief Unit tests for the GearThumbnailLoader class.
+ */
+class GearThumbnailLoaderTests : public juce::UnitTest
+{
+public:
+    GearThumbnailLoaderTests() : UnitTest("GearThumbnailLoaderTests") {}
+
+    void runTest() override
+    {
+        beginTest("Delivers Loaded Thumbnails");
+        {
+            GearThumbnailLoader loader;
+            juce::Array<int> delivered;
+            bool allValid = true;
+            loader.onLoaded = [&](int key, const juce::Image &image)
+            {
+                delivered.add(key);
+                allValid = allValid && image.isValid() && image.getWidth() == key + 1;
+            };
+
+            for (int key = 0; key < 5; ++key)
+                loader.request(key, [key]
+                               { return juce::Image(juce::Image::RGB, key + 1, 1, true); });
+
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            expect(delivered.isEmpty(), "Thumbnails should only be delivered on the message thread");
+            loader.deliverPendingResults();
+
+            expectEquals(delivered.size(), 5, "Every thumbnail should be delivered");
+            expect(allValid, "Each thumbnail should arrive under its own key");
+        }
+
+        beginTest("Newest Requests First");
+        {
+            GearThumbnailLoader loader;
+            juce::WaitableEvent started{true};
+            juce::WaitableEvent release{true};
+            std::atomic<int> loads{0};
+            juce::Array<int> order;
+            loader.onLoaded = [&order](int key, const juce::Image &)
+            { order.add(key); };
+
+            // Holds the thread so the rest of the requests queue up behind it
+            loader.request(100, [&]
+                           {
+                               started.signal();
+                               release.wait(5000);
+                               ++loads;
+                               return juce::Image(); });
+            expect(started.wait(5000), "First thumbnail should start loading");
+
+            auto load = [&loads]
+            {
+                ++loads;
+                return juce::Image(juce::Image::RGB, 1, 1, true);
+            };
+
+            for (int key = 0; key < 4; ++key)
+                loader.request(key, load);
+
+            expect(loader.isPending(100), "A loading thumbnail should be pending");
+            expect(!loader.isPending(1), "A queued thumbnail is not pending, so a repaint can move it to the front");
+
+            // Painted again, so it moves to the front; requested again while loading, so ignored
+            loader.request(1, load);
+            loader.request(100, load);
+
+            release.signal();
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            loader.deliverPendingResults();
+
+            expect(order == juce::Array<int>({100, 1, 3, 2, 0}), "Queued thumbnails should load newest first, once each");
+            expect(!loader.isPending(100), "A delivered thumbnail should no longer be pending");
+            expectEquals(loads.load(), 5, "Repeated requests should not load twice");
+        }
+
+        beginTest("Drops Stale Requests");
+        {
+            GearThumbnailLoader loader;
+            juce::WaitableEvent started{true};
+            juce::WaitableEvent release{true};
+            juce::Array<int> delivered;
+            loader.onLoaded = [&delivered](int key, const juce::Image &)
+            { delivered.add(key); };
+
+            loader.request(-1, [&]
+                           {
+                               started.signal();
+                               release.wait(5000);
+                               return juce::Image(); });
+            expect(started.wait(5000), "First thumbnail should start loading");
+
+            const int numRequests = GearThumbnailLoader::MAX_QUEUED_REQUESTS + 20;
+            for (int key = 0; key < numRequests; ++key)
+                loader.request(key, []
+                               { return juce::Image(); });
+
+            release.signal();
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            loader.deliverPendingResults();
+
+            expectEquals(delivered.size(), GearThumbnailLoader::MAX_QUEUED_REQUESTS + 1, "Only the newest requests should stay queued");
+            expect(!delivered.contains(0) && delivered.contains(numRequests - 1), "The oldest requests should be dropped");
+        }
+
+        beginTest("Cancel");
+        {
+            GearThumbnailLoader loader;
+            juce::WaitableEvent started{true};
+            juce::WaitableEvent release{true};
+            juce::Array<int> delivered;
+            loader.onLoaded = [&delivered](int key, const juce::Image &)
+            { delivered.add(key); };
+
+            loader.request(0, [&]
+                           {
+                               started.signal();
+                               release.wait(5000);
+                               return juce::Image(); });
+            loader.request(1, []
+                           { return juce::Image(); });
+
+            expect(started.wait(5000), "First thumbnail should start loading");
+            loader.cancelAll();
+            release.signal();
+
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            loader.deliverPendingResults();
+            expect(delivered.isEmpty(), "Cancelled thumbnails should never be delivered");
+
+            loader.request(0, []
+                           { return juce::Image(); });
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            loader.deliverPendingResults();
+            expect(delivered == juce::Array<int>({0}), "A cancelled key can be requested again");
+        }
+
+        beginTest("Requests During A Cancelled Load");
+        {
+            GearThumbnailLoader loader;
+            juce::WaitableEvent started{true};
+            juce::WaitableEvent release{true};
+            juce::Array<int> deliveredWidths;
+            int droppedReports = 0;
+            loader.onLoaded = [&deliveredWidths](int, const juce::Image &image)
+            { deliveredWidths.add(image.getWidth()); };
+            loader.onStaleResultDropped = [&droppedReports]
+            { ++droppedReports; };
+
+            loader.request(0, [&]
+                           {
+                               started.signal();
+                               release.wait(5000);
+                               return juce::Image(juce::Image::RGB, 1, 1, true); });
+            expect(started.wait(5000), "First thumbnail should start loading");
+
+            // The key now means something else, and its row is painted before the old load finishes
+            loader.cancelAll();
+            expect(!loader.isPending(0), "A cancelled load should not hold its key");
+            loader.request(0, []
+                           { return juce::Image(juce::Image::RGB, 2, 1, true); });
+
+            release.signal();
+            expect(loader.waitUntilIdle(5000), "Loader should finish");
+            loader.deliverPendingResults();
+
+            expect(deliveredWidths == juce::Array<int>({2}), "Only the thumbnail requested after the cancel should be delivered");
+            expectEquals(droppedReports, 1, "Dropping the cancelled result should be reported");
+        }
+    }
+};
+
+static GearThumbnailLoaderTests gearThumbnailLoaderTests;
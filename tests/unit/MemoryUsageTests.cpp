@@ -0,0 +1,166 @@
+/**
+ * @file MemoryUsageTests.cpp
+ * @brief Unit tests for memory accounting.
+ *
+ * This file contains unit tests for the sizes MemoryUsage reports for images
+ * and strings, for counting shared images once, and for the reports of the
+ * rack, its slots and instance pool, the library, the preset manager and the
+ * processor.
+ */
+
+#include <JuceHeader.h>
+#include "MemoryUsage.h"
+#include "AnalogIQProcessor.h"
+#include "Rack.h"
+#include "GearLibrary.h"
+#include "TestFixture.h"
+#include "MockNetworkFetcher.h"
+#include "MockFileSystem.h"
+#include "PresetManager.h"
+#include "TestHelpers.h"
+
+/**
+ * @brief Unit tests for memory accounting.
+ */
+class MemoryUsageTests : public juce::UnitTest
+{
+public:
+    MemoryUsageTests() : UnitTest("MemoryUsageTests") {}
+
+    void runTest() override
+    {
+        TestFixture fixture;
+        auto &mockFetcher = ConcreteMockNetworkFetcher::getInstance();
+        auto &mockFileSystem = ConcreteMockFileSystem::getInstance();
+        mockFetcher.reset();
+        mockFileSystem.reset();
+
+        CacheManager cacheManager(mockFileSystem, "/mock/cache/root");
+        PresetManager presetManager(mockFileSystem, cacheManager);
+
+        beginTest("Image And String Sizes");
+        {
+            expectEquals(MemoryUsage::getImageBytes(juce::Image(juce::Image::ARGB, 10, 20, true)), (juce::int64)800);
+            expectEquals(MemoryUsage::getImageBytes(juce::Image(juce::Image::RGB, 10, 10, true)), (juce::int64)300);
+            expectEquals(MemoryUsage::getImageBytes(juce::Image(juce::Image::SingleChannel, 8, 8, true)), (juce::int64)64);
+            expectEquals(MemoryUsage::getImageBytes(juce::Image()), (juce::int64)0, "Invalid images hold nothing");
+
+            const auto handle = (juce::int64)sizeof(juce::String);
+            expectEquals(MemoryUsage::getStringBytes({}), handle);
+            expectEquals(MemoryUsage::getStringBytes("abc"), handle + 4);
+
+            MemoryUsage usage;
+            usage.faceplates = 1;
+            usage.controlImages = 2;
+            usage.thumbnails = 3;
+            usage.catalogue = 4;
+            usage.presetData = 5;
+            usage.pooledInstances = 6;
+            usage += usage;
+            expectEquals(usage.getTotal(), (juce::int64)42);
+            expect(usage.toString().isNotEmpty());
+        }
+
+        beginTest("Shared Images Count Once");
+        {
+            juce::Image image(juce::Image::ARGB, 10, 10, true);
+            juce::Image sharedCopy = image;
+            juce::Image other(juce::Image::ARGB, 10, 10, true);
+
+            MemoryUsage::ImageCounter images;
+            expectEquals(images.count(image), (juce::int64)400);
+            expectEquals(images.count(sharedCopy), (juce::int64)0, "A copy sharing the pixels should not count again");
+            expectEquals(images.count(other), (juce::int64)400, "Different pixels should count");
+            expectEquals(images.count(juce::Image()), (juce::int64)0);
+        }
+
+        beginTest("Rack And Slots");
+        {
+            Rack rack(mockFetcher, mockFileSystem, cacheManager, presetManager, nullptr);
+
+            auto *first = rack.adoptGearItem(std::make_unique<GearItem>(createItem("unit-a", 1)));
+            auto *second = rack.adoptGearItem(std::make_unique<GearItem>(createItem("unit-a", 1)));
+            rack.getSlot(0)->setGearItem(first);
+            rack.getSlot(1)->setGearItem(second);
+
+            // Both instances share the unit's definition and its decoded assets
+            auto definition = rack.getDefinition(*first);
+            expect(rack.getDefinition(*second) == definition);
+            definition->faceplateImage = juce::Image(juce::Image::ARGB, 200, 100, true);
+            definition->controls.getReference(0).loadedImage = juce::Image(juce::Image::ARGB, 10, 40, true);
+            first->useDefinitionAssets();
+            second->useDefinitionAssets();
+
+            // Only the second instance has a thumbnail of its own
+            second->image = juce::Image(juce::Image::RGB, 16, 16, true);
+
+            auto firstSlot = rack.getSlotMemoryUsage(0);
+            auto secondSlot = rack.getSlotMemoryUsage(1);
+            expectEquals(firstSlot.faceplates, (juce::int64)80000);
+            expectEquals(firstSlot.controlImages, (juce::int64)1600);
+            expectEquals(firstSlot.thumbnails, (juce::int64)0);
+            const auto controlBytes = first->controls[0].getRecordBytes();
+            expect(controlBytes > (juce::int64)sizeof(GearControl), "A control's strings and options should be counted");
+            expect(firstSlot.presetData >= controlBytes + (juce::int64)sizeof(GearControl::State), "The instance's controls and their state should be reported");
+            expectEquals(secondSlot.faceplates, (juce::int64)80000, "Each slot reports the assets it refers to");
+            expectEquals(secondSlot.thumbnails, (juce::int64)768);
+
+            auto total = rack.getMemoryUsage();
+            expectEquals(total.faceplates, (juce::int64)80000, "Shared faceplates should be counted once");
+            expectEquals(total.controlImages, (juce::int64)1600, "Shared sprites should be counted once");
+            expectEquals(total.thumbnails, (juce::int64)768);
+            expectEquals(total.presetData, firstSlot.presetData + secondSlot.presetData);
+            expect(total.getTotal() < firstSlot.getTotal() + secondSlot.getTotal());
+
+            // As a budget would be checked
+            expect(total.getTotal() < 128 * 1024, "The rack should stay within its memory budget");
+
+            expectEquals(rack.getSlotMemoryUsage(5).getTotal(), (juce::int64)0, "Empty slots hold nothing");
+            expectEquals(rack.getSlotMemoryUsage(-1).getTotal(), (juce::int64)0);
+            expectEquals(rack.getSlotMemoryUsage(rack.getNumSlots()).getTotal(), (juce::int64)0);
+
+            for (int i = 0; i < rack.getNumSlots(); ++i)
+                rack.getSlot(i)->clearGearItem();
+
+            // Released instances stay in the pool with their control storage
+            expectEquals(total.pooledInstances, (juce::int64)0, "Instances in use are reported by their slots");
+            expectEquals(rack.releaseUnusedInstances(), 2);
+            MemoryUsage::ImageCounter pooledImages;
+            auto pooled = rack.getInstancePool().getMemoryUsage(pooledImages);
+            expect(pooled.pooledInstances >= 2 * (juce::int64)(sizeof(GearItem) + sizeof(GearControl)), "Released instances should report what they keep");
+            expectEquals(rack.getMemoryUsage().pooledInstances, pooled.pooledInstances, "The rack should report its pool");
+        }
+
+        beginTest("Catalogue And Presets");
+        {
+            GearLibrary library(mockFetcher, mockFileSystem, cacheManager, presetManager);
+            MemoryUsage::ImageCounter images;
+            auto before = library.getMemoryUsage(images).catalogue;
+
+            library.addItem("memory-eq", "Memory EQ", "equalizer", "An equalizer", "Test Co", true);
+            library.addItem("memory-comp", "Memory Compressor", "compressor", "A compressor", "Test Co", true);
+            auto after = library.getMemoryUsage(images).catalogue;
+            expect(after > before, "Catalogue records should be counted");
+            expectEquals(after, library.getCatalogue().getRecordBytes());
+
+            expectEquals(presetManager.getMemoryUsage().presetData, (juce::int64)0, "No presets are listed yet");
+            mockFileSystem.writeFile(mockFileSystem.joinPath(presetManager.getPresetsDirectory(), "Memory.json"),
+                                     "{\"name\": \"Memory\", \"timestamp\": 0, \"slots\": []}");
+            expectEquals(presetManager.getPresetNames().size(), 1);
+            expect(presetManager.getMemoryUsage().presetData > 0, "Preset listings should be counted");
+        }
+
+        beginTest("Processor");
+        {
+            AnalogIQProcessor processor(mockFetcher, mockFileSystem);
+            processor.getGearLibrary().addItem("memory-eq", "Memory EQ", "equalizer", "An equalizer", "Test Co", true);
+
+            auto usage = processor.getMemoryUsage();
+            expectEquals(usage.catalogue, processor.getGearLibrary().getCatalogue().getRecordBytes());
+            expect(usage.getTotal() >= usage.catalogue);
+            expectEquals(processor.getSlotMemoryUsage(0).getTotal(), (juce::int64)0, "Without an editor there is no rack");
+        }
+    }
+};
+
+static MemoryUsageTests memoryUsageTests;
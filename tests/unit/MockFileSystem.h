@@ -95,6 +95,49 @@ public:
         return accessedPaths.find(normalizePathHelper(path)) != accessedPaths.end();
     }
 
+    /**
+     * @brief Check if a file was read through mapFile().
+     *
+     * @param path The path to check
+     * @return true if the path was mapped, false otherwise
+     */
+    bool wasPathMapped(const juce::String &path) const
+    {
+        return mappedPaths.find(normalizePathHelper(path)) != mappedPaths.end();
+    }
+
+    /**
+     * @brief Get the number of listDirectory() calls since the counts were last reset.
+     *
+     * @return The number of directory listings
+     */
+    int getListDirectoryCallCount() const
+    {
+        return listDirectoryCalls;
+    }
+
+    /**
+     * @brief Get the number of per-file metadata queries since the counts were last reset.
+     *
+     * Counts fileExists(), getFileSize() and getFileTime(), each of which is a
+     * stat on a real file system.
+     *
+     * @return The number of per-file metadata queries
+     */
+    int getStatCallCount() const
+    {
+        return statCalls;
+    }
+
+    /**
+     * @brief Reset the call counts without touching the mocked files.
+     */
+    void resetCallCounts()
+    {
+        listDirectoryCalls = 0;
+        statCalls = 0;
+    }
+
     /**
      * @brief Get all accessed paths.
      *
@@ -117,8 +160,10 @@ public:
         directories.clear();
         errors.clear();
         accessedPaths.clear();
+        mappedPaths.clear();
         fileSizes.clear();
         fileTimes.clear();
+        resetCallCounts();
     }
 
     /**
@@ -221,10 +266,37 @@ public:
         return {};
     }
 
+    FileView mapFile(const juce::String &path) override
+    {
+        auto normalizedPath = normalizePathHelper(path);
+        accessedPaths.insert(normalizedPath);
+        mappedPaths.insert(normalizedPath);
+
+        if (errors.find(normalizedPath) != errors.end())
+        {
+            return {};
+        }
+
+        auto binaryIt = binaryFiles.find(normalizedPath);
+        if (binaryIt != binaryFiles.end())
+        {
+            return FileView(binaryIt->second);
+        }
+
+        auto textIt = files.find(normalizedPath);
+        if (textIt != files.end())
+        {
+            return FileView(juce::MemoryBlock(textIt->second.toRawUTF8(), textIt->second.getNumBytesAsUTF8()));
+        }
+
+        return {};
+    }
+
     bool fileExists(const juce::String &path) override
     {
         auto normalizedPath = normalizePathHelper(path);
         accessedPaths.insert(normalizedPath);
+        ++statCalls;
 
         if (errors.find(normalizedPath) != errors.end())
         {
@@ -297,10 +369,57 @@ public:
         return result;
     }
 
+    juce::Array<DirectoryEntry> listDirectory(const juce::String &directory) override
+    {
+        auto normalizedDir = normalizePathHelper(directory);
+        accessedPaths.insert(normalizedDir);
+        ++listDirectoryCalls;
+
+        if (errors.find(normalizedDir) != errors.end())
+        {
+            return {};
+        }
+
+        juce::Array<DirectoryEntry> result;
+        auto addFileEntry = [&](const juce::String &path)
+        {
+            DirectoryEntry entry;
+            entry.name = getFileNameHelper(path);
+            auto sizeIt = fileSizes.find(path);
+            entry.size = sizeIt != fileSizes.end() ? sizeIt->second : 0;
+            auto timeIt = fileTimes.find(path);
+            entry.modificationTime = timeIt != fileTimes.end() ? timeIt->second : juce::Time(0);
+            result.add(entry);
+        };
+
+        for (const auto &file : files)
+        {
+            if (isInDirectory(file.first, normalizedDir))
+                addFileEntry(file.first);
+        }
+        for (const auto &file : binaryFiles)
+        {
+            if (isInDirectory(file.first, normalizedDir))
+                addFileEntry(file.first);
+        }
+        for (const auto &dir : directories)
+        {
+            if (isInDirectory(dir, normalizedDir))
+            {
+                DirectoryEntry entry;
+                entry.name = getFileNameHelper(dir);
+                entry.isDirectory = true;
+                result.add(entry);
+            }
+        }
+        return result;
+    }
+
     juce::int64 getFileSize(const juce::String &path) override
     {
         auto normalizedPath = normalizePathHelper(path);
         accessedPaths.insert(normalizedPath);
+        ++statCalls;
 
         if (errors.find(normalizedPath) != errors.end())
         {
@@ -320,6 +439,7 @@ public:
     {
         auto normalizedPath = normalizePathHelper(path);
         accessedPaths.insert(normalizedPath);
+        ++statCalls;
 
         if (errors.find(normalizedPath) != errors.end())
         {
@@ -487,8 +607,11 @@ private:
     std::unordered_set<juce::String> directories;
     std::unordered_set<juce::String> errors;
     std::unordered_set<juce::String> accessedPaths;
+    std::unordered_set<juce::String> mappedPaths;
     std::unordered_map<juce::String, juce::int64> fileSizes;
     std::unordered_map<juce::String, juce::Time> fileTimes;
+    int listDirectoryCalls = 0; ///< listDirectory() calls since the counts were reset
+    int statCalls = 0;          ///< fileExists(), getFileSize() and getFileTime() calls since the counts were reset
 
     /**
      * @brief Check if a path is within a directory.
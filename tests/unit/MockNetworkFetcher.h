@@ -44,6 +44,7 @@ public:
      */
     void setResponse(const juce::String &url, const juce::String &response)
     {
+        const juce::ScopedLock sl(lock);
         responses[url] = response;
     }
 
@@ -55,6 +56,7 @@ public:
      */
     void setBinaryResponse(const juce::String &url, const juce::MemoryBlock &response)
     {
+        const juce::ScopedLock sl(lock);
         binaryResponses[url] = response;
     }
 
@@ -65,6 +67,7 @@ public:
      */
     void setError(const juce::String &url)
     {
+        const juce::ScopedLock sl(lock);
         errors.insert(url);
     }
 
@@ -76,6 +79,7 @@ public:
      */
     bool wasUrlRequested(const juce::String &url) const
     {
+        const juce::ScopedLock sl(lock);
         return requestedUrls.find(url) != requestedUrls.end();
     }
 
@@ -86,6 +90,7 @@ public:
      */
     void reset()
     {
+        const juce::ScopedLock sl(lock);
         responses.clear();
         binaryResponses.clear();
         errors.clear();
@@ -168,6 +173,7 @@ public:
      */
     juce::String fetchJsonBlocking(const juce::URL &url, bool &success) override
     {
+        const juce::ScopedLock sl(lock);
         auto urlString = url.toString(false);
         requestedUrls.insert(urlString);
 
@@ -197,6 +203,7 @@ public:
      */
     juce::MemoryBlock fetchBinaryBlocking(const juce::URL &url, bool &success) override
     {
+        const juce::ScopedLock sl(lock);
         auto urlString = url.toString(false);
         requestedUrls.insert(urlString);
 
@@ -223,4 +230,5 @@ private:
     std::map<juce::String, juce::MemoryBlock> binaryResponses;
     std::set<juce::String> errors;
     std::set<juce::String> requestedUrls;
+    mutable juce::CriticalSection lock; ///< Guards the maps; downloaders fetch from worker threads
 };
\ No newline at end of file
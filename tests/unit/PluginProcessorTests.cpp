@@ -199,9 +199,9 @@ public:
 
                     // Set control values
                     auto &peakReduction = testGear.controls.getReference(0);
-                    peakReduction.value = 200;
+                    peakReduction.initialValue = 200;
                     auto &gain = testGear.controls.getReference(1);
-                    gain.value = 70;
+                    gain.initialValue = 70;
 
                     // Set the gear item in the slot
                     if (auto *slot = rack->getSlot(0))
@@ -301,12 +301,9 @@ public:
             // Add the test gear to the gear library so it can be loaded later
             processor.getGearLibrary().addItem(testGear.unitId, testGear.name, testGear.categoryString, testGear.manufacturer, testGear.manufacturer, true);
 
-            // Get the added item and update it with our controls
-            auto *addedItem = processor.getGearLibrary().getGearItemByUnitId(testGear.unitId);
-            if (addedItem != nullptr)
-            {
-                addedItem->controls = testGear.controls;
-            }
+            // Give the added unit our controls, as it has no schema to load them from
+            auto &gearLibrary = processor.getGearLibrary();
+            gearLibrary.setItemControls(gearLibrary.getItemIndexByUnitId(testGear.unitId), testGear.controls);
 
             // Step 1: Add 1 instances of the same unit to different slots
             // Create first instance for slot 0
@@ -315,11 +312,11 @@ public:
             // Set control values for first instance
             if (instance1.controls.size() >= 2)
             {
-                instance1.controls.getReference(0).value = 0.3f; // Peak Reduction
-                instance1.controls.getReference(1).value = 0.4f; // Gain
-                instance1.controls.getReference(2).value = 0.5f; // Comp/Limit
-                instance1.controls.getReference(3).value = 0.6f; // On/Off
-                instance1.controls.getReference(4).value = 0.7f; // Frequency
+                instance1.setControlValue(0, 0.3f); // Peak Reduction
+                instance1.setControlValue(1, 0.4f); // Gain
+                instance1.setControlValue(2, 0.5f); // Comp/Limit
+                instance1.setControlValue(3, 0.6f); // On/Off
+                instance1.setControlValue(4, 0.7f); // Frequency
             }
 
             // Set the instances in a slots
@@ -335,11 +332,11 @@ public:
                 if (auto *item = slot0->getGearItem())
                 {
                     expect(item->isInstance, "Slot 0 item should be an instance");
-                    expectEquals(item->controls[0].value, 0.3f, "Slot 0 Peak Reduction should be 0.3");
-                    expectEquals(item->controls[1].value, 0.4f, "Slot 0 Gain should be 0.4");
-                    expectEquals(item->controls[2].value, 0.5f, "Slot 0 Comp/Limit should be 0.5");
-                    expectEquals(item->controls[3].value, 0.6f, "Slot 0 On/Off should be 0.6");
-                    expectEquals(item->controls[4].value, 0.7f, "Slot 0 Frequency should be 0.7");
+                    expectEquals(item->getControlValue(0), 0.3f, "Slot 0 Peak Reduction should be 0.3");
+                    expectEquals(item->getControlValue(1), 0.4f, "Slot 0 Gain should be 0.4");
+                    expectEquals(item->getControlValue(2), 0.5f, "Slot 0 Comp/Limit should be 0.5");
+                    expectEquals(item->getControlValue(3), 0.6f, "Slot 0 On/Off should be 0.6");
+                    expectEquals(item->getControlValue(4), 0.7f, "Slot 0 Frequency should be 0.7");
                 }
             }
 
@@ -373,11 +370,11 @@ public:
                 if (auto *item = slot0->getGearItem())
                 {
                     expect(item->isInstance, "Restored item in slot 0 should be an instance");
-                    expectEquals(item->controls[0].value, 0.3f, "Slot 0 Peak Reduction should be restored to 0.3");
-                    expectEquals(item->controls[1].value, 0.4f, "Slot 0 Gain should be restored to 0.4");
-                    expectEquals(item->controls[2].value, 0.5f, "Slot 0 Comp/Limit should be restored to 0.5");
-                    expectEquals(item->controls[3].value, 0.6f, "Slot 0 On/Off should be restored to 0.6");
-                    expectEquals(item->controls[4].value, 0.7f, "Slot 0 Frequency should be restored to 0.7");
+                    expectEquals(item->getControlValue(0), 0.3f, "Slot 0 Peak Reduction should be restored to 0.3");
+                    expectEquals(item->getControlValue(1), 0.4f, "Slot 0 Gain should be restored to 0.4");
+                    expectEquals(item->getControlValue(2), 0.5f, "Slot 0 Comp/Limit should be restored to 0.5");
+                    expectEquals(item->getControlValue(3), 0.6f, "Slot 0 On/Off should be restored to 0.6");
+                    expectEquals(item->getControlValue(4), 0.7f, "Slot 0 Frequency should be restored to 0.7");
                 }
             }
         }
@@ -419,12 +416,9 @@ public:
             // Add the test gear to the gear library so it can be loaded later
             processor.getGearLibrary().addItem(testGear.unitId, testGear.name, testGear.categoryString, testGear.manufacturer, testGear.manufacturer, true);
 
-            // Get the added item and update it with our controls
-            auto *addedItem = processor.getGearLibrary().getGearItemByUnitId(testGear.unitId);
-            if (addedItem != nullptr)
-            {
-                addedItem->controls = testGear.controls;
-            }
+            // Give the added unit our controls, as it has no schema to load them from
+            auto &gearLibrary = processor.getGearLibrary();
+            gearLibrary.setItemControls(gearLibrary.getItemIndexByUnitId(testGear.unitId), testGear.controls);
 
             // Step 1: Add 2 instances of the same unit to different slots
             // Create first instance for slot 0
@@ -433,8 +427,8 @@ public:
             // Set control values for first instance
             if (instance1.controls.size() >= 2)
             {
-                instance1.controls.getReference(0).value = 0.3f; // Peak Reduction
-                instance1.controls.getReference(1).value = 0.4f; // Gain
+                instance1.setControlValue(0, 0.3f); // Peak Reduction
+                instance1.setControlValue(1, 0.4f); // Gain
             }
 
             // Create second instance for slot 1
@@ -443,8 +437,8 @@ public:
             // Set control values for second instance
             if (instance2.controls.size() >= 2)
             {
-                instance2.controls.getReference(0).value = 0.7f; // Peak Reduction
-                instance2.controls.getReference(1).value = 0.8f; // Gain
+                instance2.setControlValue(0, 0.7f); // Peak Reduction
+                instance2.setControlValue(1, 0.8f); // Gain
             }
 
             // Set the instances in their respective slots
@@ -465,8 +459,8 @@ public:
                 if (auto *item = slot0->getGearItem())
                 {
                     expect(item->isInstance, "Slot 0 item should be an instance");
-                    expectEquals(item->controls[0].value, 0.3f, "Slot 0 Peak Reduction should be 0.3");
-                    expectEquals(item->controls[1].value, 0.4f, "Slot 0 Gain should be 0.4");
+                    expectEquals(item->getControlValue(0), 0.3f, "Slot 0 Peak Reduction should be 0.3");
+                    expectEquals(item->getControlValue(1), 0.4f, "Slot 0 Gain should be 0.4");
                 }
             }
 
@@ -476,8 +470,8 @@ public:
                 if (auto *item = slot1->getGearItem())
                 {
                     expect(item->isInstance, "Slot 1 item should be an instance");
-                    expectEquals(item->controls[0].value, 0.7f, "Slot 1 Peak Reduction should be 0.7");
-                    expectEquals(item->controls[1].value, 0.8f, "Slot 1 Gain should be 0.8");
+                    expectEquals(item->getControlValue(0), 0.7f, "Slot 1 Peak Reduction should be 0.7");
+                    expectEquals(item->getControlValue(1), 0.8f, "Slot 1 Gain should be 0.8");
                 }
             }
 
@@ -516,8 +510,8 @@ public:
                 if (auto *item = slot0->getGearItem())
                 {
                     expect(item->isInstance, "Restored item in slot 0 should be an instance");
-                    expectEquals(item->controls[0].value, 0.3f, "Slot 0 Peak Reduction should be restored to 0.3");
-                    expectEquals(item->controls[1].value, 0.4f, "Slot 0 Gain should be restored to 0.4");
+                    expectEquals(item->getControlValue(0), 0.3f, "Slot 0 Peak Reduction should be restored to 0.3");
+                    expectEquals(item->getControlValue(1), 0.4f, "Slot 0 Gain should be restored to 0.4");
                 }
             }
 
@@ -527,8 +521,8 @@ public:
                 if (auto *item = slot1->getGearItem())
                 {
                     expect(item->isInstance, "Restored item in slot 1 should be an instance");
-                    expectEquals(item->controls[0].value, 0.7f, "Slot 1 Peak Reduction should be restored to 0.7");
-                    expectEquals(item->controls[1].value, 0.8f, "Slot 1 Gain should be restored to 0.8");
+                    expectEquals(item->getControlValue(0), 0.7f, "Slot 1 Peak Reduction should be restored to 0.7");
+                    expectEquals(item->getControlValue(1), 0.8f, "Slot 1 Gain should be restored to 0.8");
                 }
             }
         }
@@ -698,7 +692,6 @@ public:
             // Add controls to first gear
             testGear1.controls.add(GearControl(GearControl::Type::Knob, "Peak Reduction", juce::Rectangle<float>(0, 0, 50, 50)));
             auto &peakReduction1 = testGear1.controls.getReference(0);
-            peakReduction1.value = 180;
             peakReduction1.initialValue = 180; // Set initial value for reset functionality
 
             // Create instance after setting value
@@ -725,7 +718,6 @@ public:
             // Add controls to second gear
             testGear2.controls.add(GearControl(GearControl::Type::Knob, "Peak Reduction", juce::Rectangle<float>(0, 0, 50, 50)));
             auto &peakReduction2 = testGear2.controls.getReference(0);
-            peakReduction2.value = 180;
             peakReduction2.initialValue = 180; // Set initial value for reset functionality
 
             // Create instance after setting value
@@ -753,7 +745,7 @@ public:
             {
                 if (auto *item = slot0->getGearItem())
                 {
-                    expectEquals(item->controls[0].value, 180.0f, "First gear Peak Reduction should have initial value 180");
+                    expectEquals(item->getControlValue(0), 180.0f, "First gear Peak Reduction should have initial value 180");
                 }
             }
 
@@ -761,7 +753,7 @@ public:
             {
                 if (auto *item = slot1->getGearItem())
                 {
-                    expectEquals(item->controls[0].value, 180.0f, "Second gear Peak Reduction should have initial value 180");
+                    expectEquals(item->getControlValue(0), 180.0f, "Second gear Peak Reduction should have initial value 180");
                 }
             }
 
@@ -770,8 +762,7 @@ public:
             {
                 if (auto *item = slot0->getGearItem())
                 {
-                    auto &control = item->controls.getReference(0);
-                    control.value = 200;
+                    item->setControlValue(0, 200);
                 }
             }
 
@@ -779,8 +770,7 @@ public:
             {
                 if (auto *item = slot1->getGearItem())
                 {
-                    auto &control = item->controls.getReference(0);
-                    control.value = 100;
+                    item->setControlValue(0, 100);
                 }
             }
 
@@ -792,7 +782,7 @@ public:
             {
                 if (auto *item = slot0->getGearItem())
                 {
-                    expectEquals(item->controls[0].value, 180.0f, "First gear Peak Reduction should be reset to 180");
+                    expectEquals(item->getControlValue(0), 180.0f, "First gear Peak Reduction should be reset to 180");
                 }
             }
 
@@ -800,7 +790,7 @@ public:
             {
                 if (auto *item = slot1->getGearItem())
                 {
-                    expectEquals(item->controls[0].value, 180.0f, "Second gear Peak Reduction should be reset to 180");
+                    expectEquals(item->getControlValue(0), 180.0f, "Second gear Peak Reduction should be reset to 180");
                 }
             }
         }
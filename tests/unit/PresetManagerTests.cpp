@@ -15,6 +15,7 @@
 #include "MockNetworkFetcher.h"
 #include "MockFileSystem.h"
 #include "CacheManager.h"
+#include "DirectoryWatcher.h"
 #include "TestImageHelper.h"
 
 using namespace juce;
@@ -168,6 +169,58 @@ public:
             auto displayName = presetManager.getPresetDisplayName("Preset A");
             expect(displayName.startsWith("Preset A ("), "Display name should start with preset name and opening parenthesis");
             expect(displayName.endsWith(")"), "Display name should end with closing parenthesis");
+
+            // The list and its timestamps come from one listing pass, without a stat per preset
+            mockFileSystem.resetCallCounts();
+            presetNames = presetManager.getPresetNames();
+            for (const auto &name : presetNames)
+                expect(presetManager.getPresetTimestamp(name) > 0, "Listed preset should have a timestamp");
+            expectEquals(mockFileSystem.getListDirectoryCallCount(), 1, "Names and timestamps should share one listing");
+            expectEquals(mockFileSystem.getStatCallCount(), 0, "Listing should not stat each preset");
+
+            // Saving and deleting invalidate the listing
+            presetManager.savePreset("Preset D", &rack);
+            expect(presetManager.getPresetTimestamp("Preset D") > 0, "Saved preset should be listed");
+            expect(presetManager.getPresetNames().contains("Preset D"), "Saved preset should be named");
+
+            expect(presetManager.deletePreset("Preset D"), "Deleting should succeed");
+            expect(!presetManager.getPresetNames().contains("Preset D"), "Deleted preset should leave the list");
+            expectEquals(presetManager.getPresetTimestamp("Preset D"), (juce::int64)0, "Deleted preset should have no timestamp");
+        }
+
+        beginTest("Preset List With A Watcher");
+        {
+            DirectoryWatcher watcher(mockFileSystem, 0); // Must outlive the preset manager
+            PresetManager watchedPresets(mockFileSystem, cacheManager);
+            watchedPresets.attachWatcher(watcher);
+            const juce::String externalPreset = mockFileSystem.joinPath(watchedPresets.getPresetsDirectory(), "External.json");
+
+            auto initialNames = watchedPresets.getPresetNames();
+            expect(initialNames.contains("Preset A"), "The first call should scan the directory");
+
+            // Unchanged, the list is answered without touching the file system
+            mockFileSystem.resetCallCounts();
+            expect(watchedPresets.getPresetNames() == initialNames, "An unchanged list should be kept");
+            watchedPresets.getPresetTimestamp("Preset A");
+            expectEquals(mockFileSystem.getListDirectoryCallCount(), 0, "An unchanged list should not be listed again");
+            expectEquals(mockFileSystem.getStatCallCount(), 0, "An unchanged list should not stat its presets");
+
+            // Another instance writes a preset
+            mockFileSystem.writeFile(externalPreset, juce::String("{\"timestamp\": 1700000000000}"));
+            watcher.checkForChanges();
+            mockFileSystem.resetCallCounts();
+            expect(watchedPresets.getPresetNames().contains("External"), "External preset should appear after the change");
+            expectEquals(watchedPresets.getPresetTimestamp("External"), (juce::int64)1700000000000, "External preset timestamp should be read");
+            expectEquals(mockFileSystem.getListDirectoryCallCount(), 0, "A reported change should not relist the directory");
+
+            // And rewrites it
+            mockFileSystem.writeFile(externalPreset, juce::String("{\"timestamp\": 1800000000000 }"));
+            watcher.checkForChanges();
+            expectEquals(watchedPresets.getPresetTimestamp("External"), (juce::int64)1800000000000, "A rewritten preset should be read again");
+
+            mockFileSystem.deleteFile(externalPreset);
+            watcher.checkForChanges();
+            expect(!watchedPresets.getPresetNames().contains("External"), "External preset should disappear after deletion");
         }
 
         beginTest("Preset Delete");
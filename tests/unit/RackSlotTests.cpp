@@ -117,9 +117,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -129,9 +129,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -175,9 +175,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -187,9 +187,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -230,9 +230,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -242,9 +242,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
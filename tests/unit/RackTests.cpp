@@ -118,9 +118,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -130,9 +130,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -179,9 +179,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -191,9 +191,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -251,9 +251,9 @@ public:
             peakReduction.name = "Peak Reduction";
             peakReduction.type = GearControl::Type::Knob;
             peakReduction.position = {0.68f, 0.44f};
-            peakReduction.value = 180;
-            peakReduction.startAngle = 40;
-            peakReduction.endAngle = 322;
+            peakReduction.initialValue = 180;
+            peakReduction.knob().startAngle = 40;
+            peakReduction.knob().endAngle = 322;
             peakReduction.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(peakReduction);
 
@@ -263,9 +263,9 @@ public:
             gain.name = "Gain";
             gain.type = GearControl::Type::Knob;
             gain.position = {0.257f, 0.44f};
-            gain.value = 180;
-            gain.startAngle = 40;
-            gain.endAngle = 322;
+            gain.initialValue = 180;
+            gain.knob().startAngle = 40;
+            gain.knob().endAngle = 322;
             gain.image = "assets/controls/knobs/bakelite-lg-black.png";
             controls.add(gain);
 
@@ -555,6 +555,62 @@ public:
             juce::Thread::sleep(100);
         }
 
+        beginTest("Shared Definitions");
+        {
+            setUpMocks(mockFetcher);
+            Rack rack(mockFetcher, mockFileSystem, cacheManager, presetManager, nullptr);
+
+            // A cached schema without assets loads synchronously
+            cacheManager.saveUnitToCache("shared-unit", R"({
+                "unitId": "shared-unit",
+                "controls": [
+                    { "id": "gain", "label": "Gain", "type": "knob", "value": 90 }
+                ]
+            })");
+
+            const juce::StringArray &tags = TestImageHelper::getEmptyTestTags();
+            juce::Array<GearControl> controls;
+            auto first = std::make_unique<GearItem>(
+                "shared-unit", "Shared Unit", "Manufacturer", "type", "1.0.0",
+                "units/shared-unit-1.0.0.json", "assets/shared-unit.jpg", tags,
+                mockFetcher, mockFileSystem, cacheManager,
+                GearType::Rack19Inch, GearCategory::Other, 1, controls);
+            auto second = std::make_unique<GearItem>(*first);
+
+            rack.getSlot(0)->setGearItem(first.get());
+            rack.getSlot(1)->setGearItem(second.get());
+
+            int completed = 0;
+            rack.fetchSchemaForGearItem(first.get(), [&completed]()
+                                        { ++completed; });
+            rack.fetchSchemaForGearItem(second.get(), [&completed]()
+                                        { ++completed; });
+
+            expectEquals(completed, 2, "Both instances should be completed");
+            expectEquals(rack.getNumDefinitions(), 1, "Instances of one unit should share one definition");
+            expect(first->definition != nullptr && first->definition.get() == second->definition.get());
+            expectEquals(second->controls.size(), 1, "The second instance should get the loaded controls");
+            expectEquals(second->getControlValue(0), 90.0f);
+            expect(first->instanceId != second->instanceId, "Instances should keep their own IDs");
+
+            // Values belong to the instance
+            first->setControlValue(0, 10.0f);
+            expectEquals(second->getControlValue(0), 90.0f, "Changing one instance should not change another");
+
+            // Decoded assets belong to the definition
+            juce::Image image(juce::Image::ARGB, 4, 4, true);
+            first->definition->faceplateImage = image;
+            first->definition->controls.getReference(0).loadedImage = image;
+            first->useDefinitionAssets();
+            second->useDefinitionAssets();
+            expect(second->getFaceplateImage() == image, "Instances should draw the shared faceplate");
+            expect(first->controls[0].loadedImage == second->controls[0].loadedImage, "Instances should share control pixels");
+            expectEquals(first->getControlValue(0), 10.0f, "Sharing assets should keep the instance's values");
+
+            rack.getSlot(0)->clearGearItem();
+            rack.getSlot(1)->clearGearItem();
+        }
+
         beginTest("Notification Methods");
         {
             setUpMocks(mockFetcher);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "GearItem.h"
 #include <memory>
 
 /**
@@ -233,4 +234,157 @@ public:
 
 private:
     juce::StringArray stringArray;
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Creates a two-way switch with a numbered ID, matching the controls createSchema() describes.
+ * @param i Number used in the control's ID and label
+ */
+inline GearControl createControl(int i)
+{
+    GearControl control(GearControl::Type::Switch, "Control " + juce::String(i), {0.1f, 0.1f, 0.05f, 0.05f});
+    control.id = "control-" + juce::String(i);
+    control.selector().options.add("low");
+    control.selector().options.add("high");
+    return control;
+}
+
+/**
+ * @brief Creates an item of a unit with a number of switches and no schema, using dummy services.
+ * @param unitId The unit the item belongs to
+ * @param numControls Number of switches to give it
+ */
+inline GearItem createItem(const juce::String &unitId, int numControls)
+{
+    juce::Array<GearControl> controls;
+    for (int i = 0; i < numControls; ++i)
+        controls.add(createControl(i));
+
+    return GearItem(unitId, "Unit", "Manufacturer", "other", "1.0.0", "", "", {}, INetworkFetcher::getDummy(),
+                    FileSystem::getDummy(), CacheManager::getDummy(), GearType::Rack19Inch, GearCategory::Other, 1,
+                    std::move(controls));
+}
+
+/**
+ * @brief Creates an item of a unit with a number of switches whose schema the rack can fetch.
+ * @param unitId The unit the item belongs to
+ * @param numControls Number of switches to give it
+ * @param networkFetcher The network fetcher the item loads resources with
+ * @param fileSystem The file system the item uses
+ * @param cacheManager The cache manager the item uses
+ */
+inline GearItem createItem(const juce::String &unitId, int numControls, INetworkFetcher &networkFetcher,
+                           IFileSystem &fileSystem, CacheManager &cacheManager)
+{
+    juce::Array<GearControl> controls;
+    for (int i = 0; i < numControls; ++i)
+        controls.add(createControl(i));
+
+    return GearItem(unitId, "Unit", "Manufacturer", "other", "1.0.0", "units/" + unitId + "-1.0.0.json",
+                    "assets/" + unitId + ".jpg", {"vintage", "hardware"}, networkFetcher, fileSystem, cacheManager,
+                    GearType::Rack19Inch, GearCategory::Other, 1, std::move(controls));
+}
+
+/**
+ * @brief Creates a schema of two-way switches without images, so it loads without downloads.
+ * @param unitId The unit the schema describes
+ * @param numControls Number of switches it defines
+ */
+inline juce::String createSchema(const juce::String &unitId, int numControls)
+{
+    juce::String controls;
+    for (int i = 0; i < numControls; ++i)
+    {
+        if (i > 0)
+            controls << ",";
+
+        controls << "{\"id\": \"control-" << i << "\", \"label\": \"Control " << i << "\", \"type\": \"switch\", \"currentIndex\": 0, "
+                 << "\"options\": [{\"value\": \"low\", \"label\": \"Low\"}, {\"value\": \"high\", \"label\": \"High\"}]}";
+    }
+
+    return "{\"unitId\": \"" + unitId + "\", \"controls\": [" + controls + "]}";
+}
+
+/**
+ * @brief Builds an index.json with the given number of units, shaped like the real one.
+ * @param unitCount Number of units to generate
+ */
+inline juce::String createSyntheticIndex(int unitCount)
+{
+    const juce::StringArray manufacturers{"Universal Audio", "Neve", "API", "SSL", "Teletronix", "Pultec", "Empirical Labs", "Tube-Tech"};
+    const juce::StringArray categories{"compressor", "equalizer", "preamp", "other"};
+
+    juce::MemoryOutputStream json;
+    json << "{\n  \"version\": \"1.0.0\",\n  \"units\": [\n";
+    for (int i = 0; i < unitCount; ++i)
+    {
+        auto unitId = "synthetic-" + juce::String(i);
+        json << "    {\"unitId\": \"" << unitId << "\", \"name\": \"Model " << i << "\", "
+             << "\"manufacturer\": \"" << manufacturers[(i / 8) % manufacturers.size()] << "\", "
+             << "\"category\": \"" << categories[i % categories.size()] << "\", \"version\": \"1.0.0\", "
+             << "\"schemaPath\": \"units/" << unitId << "-1.0.0.json\", "
+             << "\"thumbnailImage\": \"assets/thumbnails/" << unitId << "-1.0.0.jpg\", "
+             << "\"tags\": [\"vintage\", \"hardware\", \"series-" << (i % 50) << "\"], "
+             << "\"slotSize\": " << (1 + i % 3) << "}" << (i + 1 < unitCount ? ",\n" : "\n");
+    }
+    json << "  ]\n}\n";
+    return json.toUTF8();
+}
+
+/**
+ * @brief Builds a units index of searchable model names, spread evenly over four categories.
+ * @param unitCount Number of units to generate
+ */
+inline juce::String createSyntheticCatalogue(int unitCount)
+{
+    const juce::StringArray manufacturers{"Universal Audio", "Neve", "API", "SSL", "Teletronix", "Pultec", "Empirical Labs", "Tube-Tech"};
+    const juce::StringArray categories{"compressor", "equalizer", "preamp", "other"};
+    const juce::StringArray models{"1176", "LA-2A", "1073", "550A", "G-Comp", "EQP-1A", "Distressor", "CL 1B"};
+
+    juce::Array<juce::var> units;
+    for (int i = 0; i < unitCount; ++i)
+    {
+        juce::DynamicObject::Ptr unit = new juce::DynamicObject();
+        juce::String model = models[i % models.size()];
+        unit->setProperty("unitId", "synthetic-" + juce::String(i));
+        unit->setProperty("name", model + " Rev " + juce::String(i));
+        unit->setProperty("manufacturer", manufacturers[(i / models.size()) % manufacturers.size()]);
+        unit->setProperty("category", categories[i % categories.size()]);
+        unit->setProperty("version", "1.0.0");
+        unit->setProperty("tags", juce::Array<juce::var>{"vintage", "hardware", "series-" + juce::String(i % 50)});
+        units.add(juce::var(unit.get()));
+    }
+
+    juce::DynamicObject::Ptr root = new juce::DynamicObject();
+    root->setProperty("units", units);
+    return juce::JSON::toString(juce::var(root.get()));
+}
+
+/**
+ * @brief Searches a catalogue the way the library did before it kept search keys,
+ *        normalising every field of every item for each query.
+ * @param items The library's catalogue
+ * @param query The search text
+ * @return Indices of the matching items, in catalogue order
+ */
+template <typename Catalogue>
+juce::Array<int> scanWithoutSearchKeys(const Catalogue &items, const juce::String &query)
+{
+    auto normalize = [](const juce::String &text)
+    { return text.toLowerCase().removeCharacters("-_.()[]/\\&+=# "); };
+
+    juce::Array<int> matches;
+    juce::String normalizedQuery = normalize(query);
+    for (int i = 0; i < items.size(); ++i)
+    {
+        const auto &item = items[i];
+        bool matched = normalize(item.name).contains(normalizedQuery) ||
+                       normalize(item.manufacturer).contains(normalizedQuery) ||
+                       normalize(item.categoryString).contains(normalizedQuery);
+        for (int t = 0; !matched && t < item.tags.size(); ++t)
+            matched = normalize(item.tags[t]).contains(normalizedQuery);
+        if (matched)
+            matches.add(i);
+    }
+    return matches;
+}